@@ -2,12 +2,35 @@
 #define DYNAMIC_ARRAY_ALGORITHMS_HPP
 
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include <DynamicArray.hpp>
+#include <SimdKernels.hpp>
+#include <StructOfArrays.hpp>
 
 
 namespace algo {
 
 using data_structs::DynamicArray;
+using data_structs::StructOfArrays;
+namespace simd = data_structs::simd;
+
+// Every algorithm works on a std::span over contiguous memory; the
+// DynamicArray overloads forward array.span(). The kernels index raw pointers,
+// so the hot loops carry no bounds checks and can be auto-vectorized.
 
 /// Swap two elements
 template <typename Type>
@@ -18,575 +41,1985 @@ void swap(Type& a, Type& b) noexcept {
 }
 
 
+/// Ranges of at most this many elements are finished by insertion sort.
+inline constexpr std::size_t INTROSORT_INSERTION_THRESHOLD = 16;
+
+/// Ranges larger than this pick the pivot with Tukey's ninther instead of a
+/// plain median-of-three.
+inline constexpr std::size_t INTROSORT_NINTHER_THRESHOLD = 128;
+
+
 /**
- * @brief Merge two sorted sub-arrays into a single sorted array (numeric
- * types).
- *
- * Merges data_[left..mid] and data_[mid+1..right] using a single temporary
- * buffer. Original data is not modified until the temporary is fully built,
- * then we copy back in one pass.
+ * @brief Insertion sort (linear search) of the half-open range [left, right).
  *
- * Strong exception guarantee under numeric-type assumptions (no-throw ops).
+ * Kernel shared by InsertionSortWithLinearSearch and the small-range cutoff of
+ * the introsort and merge sort. Elements are moved, never copied. Stable. If
+ * a comparison throws, the range still holds all of its elements.
  *
- * @param array The array to sort.
- * @param left The left index of the first sub-array.
- * @param mid The middle index, end of the first sub-array.
- * @param right The right index of the second sub-array.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the sub-range (inclusive).
+ * @param right Last index of the sub-range (exclusive).
  */
 template <typename Type>
-void merge(DynamicArray<Type>& array, const std::size_t left,
-           const std::size_t mid, const std::size_t right) {
-    const std::size_t n1 = mid - left + 1;
-    const std::size_t n2 = right - mid;
-    const std::size_t n = n1 + n2;
+void insertionSortRange(Type* data, const std::size_t left,
+                        const std::size_t right) {
+    for (std::size_t i = left + 1; i < right; ++i) {
+        if (!(data[i] < data[i - 1]))
+            continue;
 
-    // Temporary merged buffer
-    Type* temp = new Type[n];
+        Type key = std::move(data[i]);
+        std::size_t j = i;
+        try {
+            do {
+                data[j] = std::move(data[j - 1]);
+                --j;
+            } while (j > left && key < data[j - 1]);
+        } catch (...) {
+            // Fill the hole so the range keeps all of its elements
+            data[j] = std::move(key);
+            throw;
+        }
+        data[j] = std::move(key);
+    }
+}
 
-    std::size_t i = left;
-    std::size_t j = mid + 1;
-    std::size_t k = 0;
 
-    // Merge into temp
-    while (i <= mid && j <= right) {
-        if (array[i] <= array[j])
-            temp[k++] = array[i++];
-        else
-            temp[k++] = array[j++];
+/// Orders data[a] <= data[b] <= data[c] with at most three swaps.
+template <typename Type>
+void sortThree(Type* data, const std::size_t a, const std::size_t b,
+               const std::size_t c) {
+    if (data[b] < data[a])
+        swap(data[a], data[b]);
+    if (data[c] < data[b]) {
+        swap(data[b], data[c]);
+        if (data[b] < data[a])
+            swap(data[a], data[b]);
     }
+}
 
-    while (i <= mid)
-        temp[k++] = array[i++];
-    while (j <= right)
-        temp[k++] = array[j++];
 
-    // Copy back
-    for (std::size_t t = 0; t < n; ++t)
-        array[left + t] = temp[t];
+/**
+ * @brief Choose the quicksort pivot of [left, right) and move it to
+ * data[left].
+ *
+ * Uses median-of-three (first, middle, last) for small ranges and Tukey's
+ * ninther (median of three medians-of-three) above
+ * INTROSORT_NINTHER_THRESHOLD. Either way, the remaining range is left with at
+ * least one element <= pivot and one element >= pivot, which act as sentinels
+ * for the unguarded scans of partition().
+ *
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the sub-range (inclusive).
+ * @param right Last index of the sub-range (exclusive); right - left >= 3.
+ */
+template <typename Type>
+void selectPivot(Type* data, const std::size_t left, const std::size_t right) {
+    const std::size_t size = right - left;
+    const std::size_t mid = left + size / 2;
+
+    if (size > INTROSORT_NINTHER_THRESHOLD) {
+        sortThree(data, left, mid, right - 1);
+        sortThree(data, left + 1, mid - 1, right - 2);
+        sortThree(data, left + 2, mid + 1, right - 3);
+        sortThree(data, mid - 1, mid, mid + 1);
+    } else {
+        sortThree(data, left, mid, right - 1);
+    }
 
-    delete[] temp;
+    swap(data[left], data[mid]);
 }
 
 
 /**
- * @brief Recursive merge sort implementation.
+ * @brief Hoare partition of [left + 1, right) around the pivot data[left].
  *
- * Recursively splits the array into halves until single-element arrays are
- * reached, then merges them back together in sorted order.
+ * Both scans stop on elements equal to the pivot, so duplicate-heavy inputs
+ * are split evenly instead of degrading to O(n^2). The pivot is compared in
+ * place (never copied), and the scans run without bounds checks thanks to the
+ * sentinels placed by selectPivot().
  *
- * @param array The array to sort
- * @param left Left index of the sub-array to sort.
- * @param right Right index of the sub-array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left Index of the pivot (first index of the sub-range).
+ * @param right Last index of the sub-range (exclusive).
+ * @return The cut: [left, cut) holds elements <= pivot, [cut, right) holds
+ * elements >= pivot, and left < cut < right.
  */
 template <typename Type>
-void mergeSortRecursive(DynamicArray<Type>& array, const std::size_t left,
-                        const std::size_t right) {
-    if (left >= right)
-        return;
+std::size_t partition(Type* data, const std::size_t left, std::size_t right) {
+    const Type& pivot = data[left];
+    std::size_t i = left + 1;
+
+    while (true) {
+        while (data[i] < pivot)
+            ++i;
+        --right;
+        while (pivot < data[right])
+            --right;
+        if (i >= right)
+            return i;
+        swap(data[i], data[right]);
+        ++i;
+    }
+}
 
-    const std::size_t mid = left + (right - left) / 2;
 
-    // Recursively sort both halves
-    mergeSortRecursive(array, left, mid);
-    mergeSortRecursive(array, mid + 1, right);
+/**
+ * @brief Restore the max-heap property below `root` in a heap of `size`
+ * elements stored at data[0..size).
+ *
+ * The sifted value is held aside and moved into its final slot once, instead
+ * of being swapped level by level.
+ */
+template <typename Type>
+void siftDown(Type* data, std::size_t root, const std::size_t size) {
+    Type value = std::move(data[root]);
 
-    if (array[mid] < array[mid + 1])
-        return;
+    while (true) {
+        std::size_t child = 2 * root + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && data[child] < data[child + 1])
+            ++child;
+        if (!(value < data[child]))
+            break;
+        data[root] = std::move(data[child]);
+        root = child;
+    }
 
-    // Merge the sorted halves
-    merge(array, left, mid, right);
+    data[root] = std::move(value);
 }
 
 
 /**
- * @brief Partition the array around a pivot for quicksort.
- *
- * Uses the Lomuto partition scheme, selecting the last element as the pivot.
- * Elements less than or equal to the pivot are moved to its left, and those
- * greater are moved to its right.
+ * @brief In-place heapsort of the half-open range [left, right).
  *
- * @param array The array to partition.
- * @param left Left index of the sub-array to partition.
- * @param right Right index of the sub-array to partition.
- * @return The final index of the pivot after partitioning.
+ * Used as the introsort fallback once the recursion depth limit is reached,
+ * which bounds the worst case at O(n log n).
  */
 template <typename Type>
-std::size_t partition(DynamicArray<Type>& array, const std::size_t left,
-                      const std::size_t right) {
-    Type pivot = array[right]; // Lomuto: pivot is last element
-    std::size_t i = left;
+void heapSortRange(Type* data, const std::size_t left,
+                   const std::size_t right) {
+    Type* base = data + left;
+    const std::size_t size = right - left;
+    if (size < 2)
+        return;
 
-    for (std::size_t j = left; j < right; ++j)
-        if (array[j] <= pivot)
-            swap(array[i++], array[j]);
+    for (std::size_t i = size / 2; i-- > 0;)
+        siftDown(base, i, size);
 
-    swap(array[i], array[right]);
-    return i;
+    for (std::size_t end = size - 1; end > 0; --end) {
+        swap(base[0], base[end]);
+        siftDown(base, 0, end);
+    }
 }
 
 
 /**
- * @brief Recursive quicksort implementation with tail recursion elimination.
+ * @brief Introsort main loop on the half-open range [left, right).
  *
- * Partitions the array around a pivot, then recursively sorts the partitions.
- * Tail recursion is eliminated by always recursing into the smaller partition
- * first and iterating on the larger one.
+ * Quicksort with selectPivot()/partition() while the range is larger than
+ * INTROSORT_INSERTION_THRESHOLD; small ranges are finished by insertion sort
+ * and, once `depth_limit` partitions have been spent on one path, the range is
+ * handed to heapsort. Recursion always goes into the smaller side and the
+ * loop continues on the larger one.
  *
- * @param array The array to sort.
- * @param left Left index of the sub-array to sort.
- * @param right Right index of the sub-array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the sub-range (inclusive).
+ * @param right Last index of the sub-range (exclusive).
+ * @param depth_limit Remaining partitioning depth before falling back to
+ * heapsort.
  */
 template <typename Type>
-void quickSortRecursive(DynamicArray<Type>& array, std::size_t left,
-                        std::size_t right) {
-    while (left < right) {
-        // Tail recursion elimination: recurse into smaller side first
-        if (const std::size_t p = partition(array, left, right);
-            p > 0 && (p - left) < (right - p)) {
-            quickSortRecursive(array, left, p - 1);
-            left = p + 1;
+void introSortLoop(Type* data, std::size_t left, std::size_t right,
+                   std::size_t depth_limit) {
+    while (right - left > INTROSORT_INSERTION_THRESHOLD) {
+        if (depth_limit == 0) {
+            heapSortRange(data, left, right);
+            return;
+        }
+        --depth_limit;
+
+        selectPivot(data, left, right);
+        const std::size_t cut = partition(data, left, right);
+
+        if (cut - left < right - cut) {
+            introSortLoop(data, left, cut, depth_limit);
+            left = cut;
         } else {
-            if (p + 1 < right)
-                quickSortRecursive(array, p + 1, right);
-            if (p == 0)
-                break; // prevent size_t underflow
-            right = p - 1;
+            introSortLoop(data, cut, right, depth_limit);
+            right = cut;
         }
     }
+
+    insertionSortRange(data, left, right);
 }
 
 
-/// Checks if the array is sorted in ascending order.
-template <typename Type>
-bool isSorted(const DynamicArray<Type>& array) noexcept {
-    for (std::size_t i = 1; i < array.size(); ++i)
-        if (array[i] < array[i - 1])
-            return false;
+/// Runs of at most this many elements are sorted by insertion sort before the
+/// bottom-up merge passes start.
+inline constexpr std::size_t MERGE_SORT_RUN_LENGTH = 32;
 
-    return true;
+
+/**
+ * @brief Number of elements of scratch storage MergeSort needs for a range of
+ * `size` elements.
+ *
+ * Every merge buffers only its shorter run, which never exceeds half of the
+ * range.
+ */
+constexpr std::size_t mergeSortScratchSize(const std::size_t size) noexcept {
+    return size / 2;
 }
 
 
-/*** Sorting Algorithms ***/
+/**
+ * @brief Uninitialized storage for `capacity` objects, released on scope exit.
+ *
+ * Owns raw memory only: the merge routines construct and destroy the objects
+ * they place in it, so Type needs no default constructor.
+ */
+template <typename Type>
+class ScratchBuffer {
+  public:
+    explicit ScratchBuffer(const std::size_t capacity)
+        : data_(capacity == 0
+                    ? nullptr
+                    : static_cast<Type*>(::operator new(
+                          sizeof(Type) * capacity,
+                          static_cast<std::align_val_t>(alignof(Type))))) {}
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    ~ScratchBuffer() {
+        if (data_ != nullptr)
+            ::operator delete(data_,
+                              static_cast<std::align_val_t>(alignof(Type)));
+    }
+
+    [[nodiscard]] Type* data() const noexcept { return data_; }
+
+  private:
+    Type* data_;
+};
 
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the Bubble
- * Sort algorithm.
- *
- * This method repeatedly steps through the list, compares adjacent elements,
- * and swaps them if they are in the wrong order. The process is repeated until
- * the list is sorted. Stable.
+ * @brief Merge the sorted runs [left, mid) and [mid, right) when the left run
+ * is the shorter one.
  *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
+ * The left run is moved into `scratch` and merged forwards into its old place.
+ * Ties are taken from the left run, so the merge is stable.
  *
- * @par Complexity
- * - O(n^2) time complexity in the average and worst cases.
- * - O(n) time complexity in the best case (when the array is already sorted).
- * - O(1) additional space complexity.
+ * @par Exception Safety
+ * - Basic: if a comparison throws, the buffered elements still in `scratch`
+ *   are moved back into the gap, so the range holds the same elements. If a
+ *   move throws, every element is left in a valid but unspecified state.
  *
- * @param array The array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the left run (inclusive).
+ * @param mid First index of the right run.
+ * @param right Last index of the right run (exclusive).
+ * @param scratch Uninitialized storage for at least mid - left elements.
  */
 template <typename Type>
-void BubbleSort(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
-        return;
+void mergeLow(Type* data, const std::size_t left, const std::size_t mid,
+              const std::size_t right, Type* scratch) {
+    const std::size_t length = mid - left;
+    std::uninitialized_move(data + left, data + mid, scratch);
+
+    std::size_t i = 0;
+    std::size_t j = mid;
+    std::size_t k = left;
 
-    for (std::size_t i = 0; i < array.size() - 1; ++i)
-        for (std::size_t j = 0; j < array.size() - i - 1; ++j)
-            if (array[j] > array[j + 1])
-                swap(array[j], array[j + 1]);
+    try {
+        while (i < length && j < right) {
+            if (data[j] < scratch[i])
+                data[k++] = std::move(data[j++]);
+            else
+                data[k++] = std::move(scratch[i++]);
+        }
+    } catch (...) {
+        std::move(scratch + i, scratch + length, data + k);
+        std::destroy(scratch, scratch + length);
+        throw;
+    }
+
+    // Whatever is left of the right run is already in place
+    std::move(scratch + i, scratch + length, data + k);
+    std::destroy(scratch, scratch + length);
 }
 
 
-/** @brief Sorts the array in ascending (non-decreasing) order using an improved
- * version of Bubble Sort.
- *
- * This method includes optimizations such as early-exit if no swaps are made
- * during a pass, and reducing the range of subsequent passes based on the last
- * swap position. Stable.
+/**
+ * @brief Merge the sorted runs [left, mid) and [mid, right) when the right run
+ * is the shorter one.
  *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
+ * Mirror image of mergeLow(): the right run is moved into `scratch` and merged
+ * backwards from the end. Ties are taken from the right run, so the merge is
+ * stable.
  *
- * @par Complexity
- * - O(n^2) time complexity in the average and worst cases.
- * - O(n) time complexity in the best case (when the array is already sorted).
- * - O(1) additional space complexity.
+ * @par Exception Safety
+ * - Basic: same guarantees as mergeLow().
  *
- * @param array The array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the left run (inclusive).
+ * @param mid First index of the right run.
+ * @param right Last index of the right run (exclusive).
+ * @param scratch Uninitialized storage for at least right - mid elements.
  */
 template <typename Type>
-void ImprovedBubbleSort(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
-        return;
+void mergeHigh(Type* data, const std::size_t left, const std::size_t mid,
+               const std::size_t right, Type* scratch) {
+    const std::size_t length = right - mid;
+    std::uninitialized_move(data + mid, data + right, scratch);
 
-    // Early-exit + shrinking boundary optimization
-    std::size_t n = array.size();
-    while (n > 1) {
-        bool swapped = false;
-        std::size_t last_swap = 0;
+    std::size_t i = mid;
+    std::size_t j = length;
+    std::size_t k = right;
 
-        for (std::size_t j = 0; j + 1 < n; ++j) {
-            if (array[j] > array[j + 1]) {
-                swap(array[j], array[j + 1]);
-                swapped = true;
-                last_swap = j + 1;
-            }
+    try {
+        while (i > left && j > 0) {
+            if (scratch[j - 1] < data[i - 1])
+                data[--k] = std::move(data[--i]);
+            else
+                data[--k] = std::move(scratch[--j]);
         }
-
-        if (!swapped)
-            break;
-        n = last_swap;
+    } catch (...) {
+        std::move(scratch, scratch + j, data + i);
+        std::destroy(scratch, scratch + length);
+        throw;
     }
+
+    // Whatever is left of the left run is already in place
+    std::move(scratch, scratch + j, data + left);
+    std::destroy(scratch, scratch + length);
 }
 
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the
- * Insertion Sort algorithm with linear search.
+ * @brief Merge the adjacent sorted runs [left, mid) and [mid, right).
  *
- * This method builds a sorted portion of the array by repeatedly taking the
- * next element and inserting it into its correct position within the sorted
- * portion using linear search. Stable.
- *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
- *
- * @par Complexity
- * - O(n^2) time complexity in the average and worst cases.
- * - O(n) time complexity in the best case (when the array is already sorted).
- * - O(1) additional space complexity.
- *
- * @param array The array to sort.
+ * Returns immediately when the runs are already in order; otherwise buffers
+ * the shorter run, so `scratch` never needs more than half of the range.
  */
 template <typename Type>
-void InsertionSortWithLinearSearch(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
+void merge(Type* data, const std::size_t left, const std::size_t mid,
+           const std::size_t right, Type* scratch) {
+    if (!(data[mid] < data[mid - 1]))
         return;
 
-    for (std::size_t i = 1; i < array.size(); ++i) {
-        Type key = array[i];
-        std::size_t j = i;
-        while (j > 0 && array[j - 1] > key) {
-            array[j] = array[j - 1];
-            --j;
-        }
-        array[j] = key;
-    }
+    if (mid - left <= right - mid)
+        mergeLow(data, left, mid, right, scratch);
+    else
+        mergeHigh(data, left, mid, right, scratch);
 }
 
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the
- * Insertion Sort algorithm with binary search.
- *
- * This method builds a sorted portion of the array by repeatedly taking the
- * next element and inserting it into its correct position within the sorted
- * portion using binary search to find the insertion point. Stable (uses
- * upper_bound-style insertion).
- *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
+ * @brief Bottom-up merge sort of data[0..size).
  *
- * @par Complexity
- * - O(n^2) time complexity in the average and worst cases due to shifting
- * elements.
- * - O(n log n) time complexity for finding the insertion point using binary
- * search.
- * - O(1) additional space complexity.
+ * Sorts runs of MERGE_SORT_RUN_LENGTH elements with insertion sort, then
+ * merges neighbouring runs in passes of doubling width. No recursion and no
+ * allocation: every merge reuses `scratch`.
  *
- * @param array The array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param size Number of elements in the range.
+ * @param scratch Uninitialized storage for at least
+ * mergeSortScratchSize(size) elements.
  */
 template <typename Type>
-void InsertionSortWithBinarySearch(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
-        return;
+void mergeSortBottomUp(Type* data, const std::size_t size, Type* scratch) {
+    for (std::size_t left = 0; left < size; left += MERGE_SORT_RUN_LENGTH)
+        insertionSortRange(data, left,
+                           std::min(left + MERGE_SORT_RUN_LENGTH, size));
+
+    for (std::size_t width = MERGE_SORT_RUN_LENGTH; width < size; width *= 2) {
+        for (std::size_t left = 0; left + width < size; left += 2 * width) {
+            const std::size_t mid = left + width;
+            merge(data, left, mid, std::min(mid + width, size), scratch);
+        }
+    }
+}
 
-    for (std::size_t i = 1; i < array.size(); ++i) {
-        Type key = array[i];
 
-        // Binary search for insertion position in [0, i)
-        std::size_t left = 0, right = i;
-        while (left < right) {
-            std::size_t mid = left + (right - left) / 2;
-            if (array[mid] <= key)
-                left = mid + 1;
-            else
-                right = mid;
-        }
+/// Ranges shorter than this are sorted by TimSort with a single binary
+/// insertion sort.
+inline constexpr std::size_t TIMSORT_MIN_MERGE = 64;
 
-        // Shift to make room
-        for (std::size_t j = i; j > left; --j)
-            array[j] = array[j - 1];
+/// Initial number of consecutive wins after which a TimSort merge switches
+/// to galloping.
+inline constexpr std::ptrdiff_t TIMSORT_MIN_GALLOP = 7;
 
-        array[left] = key;
-    }
-}
+/// Upper bound on the TimSort run stack. The stack invariants make run
+/// lengths grow at least like Fibonacci numbers, so 85 entries cover any
+/// range addressable with 64 bits.
+inline constexpr std::size_t TIMSORT_MAX_RUNS = 85;
 
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the Quick
- * Sort algorithm.
+ * @brief Minimum run length TimSort uses for a range of `size` elements.
  *
- * Partitions the array around a pivot and recursively sorts the partitions.
- * Implementation partitions with "<= pivot" on the left side (Lomuto), and is
- * not stable.
- *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
- *
- * @par Complexity
- * - O(n log n) average time complexity.
- * - O(n^2) worst-case time complexity (e.g., already-sorted or duplicate-heavy
- * arrays with last-element pivot).
- * - O(log n) space complexity due to recursion stack (tail recursion eliminated
- * on larger side).
- *
- * @param array The array to sort.
+ * Returns a value in [TIMSORT_MIN_MERGE / 2, TIMSORT_MIN_MERGE] such that
+ * size / minRun is a power of two or slightly less, which keeps the final
+ * merges balanced.
  */
-template <typename Type>
-void QuickSort(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
-        return;
-
-    quickSortRecursive(array, 0, array.size() - 1);
+constexpr std::size_t minRunLength(std::size_t size) noexcept {
+    std::size_t low_bits = 0;
+    while (size >= TIMSORT_MIN_MERGE) {
+        low_bits |= size & 1;
+        size >>= 1;
+    }
+    return size + low_bits;
 }
 
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the Merge
- * Sort algorithm.
- *
- * This method recursively divides the array into halves, sorts each half,
- * and then merges the sorted halves back together. It uses a temporary
- * buffer for merging. Stable.
- *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
+ * @brief Length of the natural run starting at data[left], bounded by
+ * `right`.
  *
- * @par Complexity
- * - O(n log n) time complexity in all cases (best, average, worst).
- * - O(n) additional space complexity for the temporary buffer.
+ * A run is either non-decreasing or strictly decreasing; a strictly
+ * decreasing run is reversed in place, which keeps the sort stable.
  *
- * @param array The array to sort.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the run (inclusive).
+ * @param right Last index of the range (exclusive); right > left.
+ * @return The run length, at least 1.
  */
 template <typename Type>
-void MergeSort(DynamicArray<Type>& array) {
-    if (array.size() <= 1 || isSorted(array))
-        return;
+std::size_t countRunAndMakeAscending(Type* data, const std::size_t left,
+                                     const std::size_t right) {
+    std::size_t end = left + 1;
+    if (end == right)
+        return 1;
+
+    if (data[end++] < data[left]) {
+        while (end < right && data[end] < data[end - 1])
+            ++end;
+        std::reverse(data + left, data + end);
+    } else {
+        while (end < right && !(data[end] < data[end - 1]))
+            ++end;
+    }
 
-    mergeSortRecursive(array, 0, array.size() - 1);
+    return end - left;
 }
 
 
 /**
- * @brief Bin Sort for a known 0-based universe.
- *
- * Universe: U = {0, 1, ..., universe_size-1}. Each element of the array must be
- * in U.
- *
- * Phase 1: For each element x in A, append x to the tail of bin B[x].
- * Phase 2: Traverse bins B[0]..B[m-1] and write their contents back to A in
- * order.
+ * @brief Extend the sorted prefix [left, start) to [left, right) by binary
+ * insertion.
  *
- * Stable, O(n + m) time, O(n + m) extra space, where n = size(), m =
- * universe_size.
+ * The insertion point is the upper bound of each element, so equal elements
+ * keep their order. Each element costs O(log n) comparisons and one block
+ * move.
  *
- * @param array The array to sort.
- * @param universe_size The size of the universe (m). Must be > 0.
- *
- * @throws std::out_of_range if a value is outside [0, universe_size).
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the range (inclusive).
+ * @param right Last index of the range (exclusive).
+ * @param start End of the already sorted prefix; left <= start <= right.
  */
 template <typename Type>
-void BinSort(DynamicArray<Type>& array, const std::size_t universe_size) {
-    static_assert(std::numeric_limits<Type>::is_integer,
-                  "BinSort(universe) requires an integral Type.");
-
-    if (array.size() <= 1 || universe_size == 0)
-        return;
-
-    struct Node {
-        Type value;
-        Node* next;
-    };
+void binaryInsertionSort(Type* data, const std::size_t left,
+                         const std::size_t right, std::size_t start) {
+    if (start == left)
+        ++start;
 
-    // Allocate bin heads and tails (ensure no leak if tails allocation throws)
-    Node** heads = new Node*[universe_size];
-    try {
-        Node** tails = new Node*[universe_size];
-        for (std::size_t b = 0; b < universe_size; ++b) {
-            heads[b] = nullptr;
-            tails[b] = nullptr;
-        }
+    for (; start < right; ++start) {
+        Type pivot = std::move(data[start]);
 
-        // Phase 1: distribute elements into bins
+        std::size_t low = left;
+        std::size_t high = start;
         try {
-            for (std::size_t i = 0; i < array.size(); ++i) {
-                const Type v = array[i];
-                const auto bin = static_cast<std::size_t>(v);
-                if (bin >= universe_size)
-                    throw std::out_of_range(
-                        "BinSort: value out of [0, m) universe");
-
-                Node* node = new Node{v, nullptr};
-                if (!heads[bin]) {
-                    heads[bin] = tails[bin] = node;
-                } else {
-                    tails[bin]->next = node;
-                    tails[bin] = node;
-                }
+            while (low < high) {
+                const std::size_t mid = low + (high - low) / 2;
+                if (pivot < data[mid])
+                    high = mid;
+                else
+                    low = mid + 1;
             }
         } catch (...) {
-            // Cleanup lists before rethrow
-            for (std::size_t b = 0; b < universe_size; ++b) {
-                Node* cur = heads[b];
-                while (cur) {
-                    Node* nxt = cur->next;
-                    delete cur;
-                    cur = nxt;
-                }
-            }
-            delete[] heads;
-            delete[] tails;
+            data[start] = std::move(pivot);
             throw;
         }
 
-        // Phase 2: collect back to A in increasing bin index
-        std::size_t write = 0;
-        for (std::size_t b = 0; b < universe_size; ++b) {
-            Node* cur = heads[b];
-            while (cur) {
-                array[write++] = cur->value;
-                Node* nxt = cur->next;
-                delete cur;
-                cur = nxt;
-            }
-        }
-
-        delete[] heads;
-        delete[] tails;
-    } catch (...) {
-        delete[] heads;
-        throw;
+        std::move_backward(data + low, data + start, data + start + 1);
+        data[low] = std::move(pivot);
     }
 }
 
 
 /**
- * @brief Bin Sort for a known contiguous universe range.
+ * @brief Leftmost position at which `key` can be inserted into the sorted
+ * run base[0..length).
  *
- * Universe: U = {min_value, min_value+1, ..., max_value}. Each element must lie
- * in this range. Internally maps key x to bin index (x - min_value), keeps
- * stability by appending to each bin, then writes bins back in ascending order.
+ * Gallops (probes hint +- 1, 3, 7, ...) from `hint` before a binary search,
+ * so finding a position k slots away from the hint costs O(log k)
+ * comparisons.
  *
- * Stable, O(n + m) time, O(n + m) extra space, where n = size(),
- * m = static_cast<std::size_t>(max_value - min_value + 1).
+ * @return k such that base[k - 1] < key <= base[k].
+ */
+template <typename Type>
+std::size_t gallopLeft(const Type& key, const Type* base,
+                       const std::size_t length, const std::size_t hint) {
+    const auto len = static_cast<std::ptrdiff_t>(length);
+    const auto at = static_cast<std::ptrdiff_t>(hint);
+    std::ptrdiff_t last_offset = 0;
+    std::ptrdiff_t offset = 1;
+
+    if (base[at] < key) {
+        // base[at + last_offset] < key <= base[at + offset]
+        const std::ptrdiff_t max_offset = len - at;
+        while (offset < max_offset && base[at + offset] < key) {
+            last_offset = offset;
+            offset = 2 * offset + 1;
+        }
+        offset = std::min(offset, max_offset);
+        last_offset += at;
+        offset += at;
+    } else {
+        // base[at - offset] < key <= base[at - last_offset]
+        const std::ptrdiff_t max_offset = at + 1;
+        while (offset < max_offset && !(base[at - offset] < key)) {
+            last_offset = offset;
+            offset = 2 * offset + 1;
+        }
+        offset = std::min(offset, max_offset);
+        const std::ptrdiff_t tmp = last_offset;
+        last_offset = at - offset;
+        offset = at - tmp;
+    }
+
+    // base[last_offset] < key <= base[offset]; binary search in between
+    ++last_offset;
+    while (last_offset < offset) {
+        const std::ptrdiff_t mid = last_offset + (offset - last_offset) / 2;
+        if (base[mid] < key)
+            last_offset = mid + 1;
+        else
+            offset = mid;
+    }
+    return static_cast<std::size_t>(offset);
+}
+
+
+/**
+ * @brief Rightmost position at which `key` can be inserted into the sorted
+ * run base[0..length).
  *
- * @param array The array to sort.
- * @param min_value Minimum value in the universe (inclusive).
- * @param max_value Maximum value in the universe (inclusive).
+ * Same search as gallopLeft(), but equal elements end up before `key`.
  *
- * @throws std::out_of_range if an element of the array is outside [min_value,
- * max_value].
+ * @return k such that base[k - 1] <= key < base[k].
  */
 template <typename Type>
-void BinSort(DynamicArray<Type>& array, const Type min_value,
-             const Type max_value) {
-    static_assert(std::numeric_limits<Type>::is_integer,
-                  "BinSort(range) requires an integral Type.");
+std::size_t gallopRight(const Type& key, const Type* base,
+                        const std::size_t length, const std::size_t hint) {
+    const auto len = static_cast<std::ptrdiff_t>(length);
+    const auto at = static_cast<std::ptrdiff_t>(hint);
+    std::ptrdiff_t last_offset = 0;
+    std::ptrdiff_t offset = 1;
+
+    if (key < base[at]) {
+        // base[at - offset] <= key < base[at - last_offset]
+        const std::ptrdiff_t max_offset = at + 1;
+        while (offset < max_offset && key < base[at - offset]) {
+            last_offset = offset;
+            offset = 2 * offset + 1;
+        }
+        offset = std::min(offset, max_offset);
+        const std::ptrdiff_t tmp = last_offset;
+        last_offset = at - offset;
+        offset = at - tmp;
+    } else {
+        // base[at + last_offset] <= key < base[at + offset]
+        const std::ptrdiff_t max_offset = len - at;
+        while (offset < max_offset && !(key < base[at + offset])) {
+            last_offset = offset;
+            offset = 2 * offset + 1;
+        }
+        offset = std::min(offset, max_offset);
+        last_offset += at;
+        offset += at;
+    }
 
-    if (array.size() <= 1 || max_value < min_value)
-        return;
+    // base[last_offset] <= key < base[offset]; binary search in between
+    ++last_offset;
+    while (last_offset < offset) {
+        const std::ptrdiff_t mid = last_offset + (offset - last_offset) / 2;
+        if (key < base[mid])
+            offset = mid;
+        else
+            last_offset = mid + 1;
+    }
+    return static_cast<std::size_t>(offset);
+}
 
-    // Define unsigned counterpart to avoid narrowing/UB
-    using U = std::make_unsigned_t<Type>;
 
-    // Map bounds to unsigned once
-    const U umin = static_cast<U>(min_value);
-    const U umax = static_cast<U>(max_value);
+/**
+ * @brief Run stack and merge machinery of TimSort.
+ *
+ * Pending runs are pushed in order and merged so that, from the top of the
+ * stack, run lengths satisfy A > B + C and B > C (checked on the top four
+ * entries, which is what makes the invariant hold for the whole stack).
+ * Merges buffer their shorter run in a caller-provided scratch area and
+ * switch to galloping while one run keeps winning; `min_gallop_` adapts to
+ * how often galloping pays off.
+ */
+template <typename Type>
+class TimSortRuns {
+  public:
+    /**
+     * @param data Pointer to the first element of the range being sorted.
+     * @param scratch Uninitialized storage for at least half of the range.
+     */
+    TimSortRuns(Type* data, Type* scratch) noexcept
+        : data_(data), scratch_(scratch) {}
+
+
+    /// Push the sorted run [base, base + length) onto the stack.
+    void pushRun(const std::size_t base, const std::size_t length) noexcept {
+        run_base_[run_count_] = base;
+        run_length_[run_count_] = length;
+        ++run_count_;
+    }
 
-    const U span = static_cast<U>(umax - umin);
 
-    // Ensure m = span + 1 fits into size_t to avoid overflow on allocation
-    if (span >= static_cast<U>(std::numeric_limits<std::size_t>::max()))
-        throw std::length_error("BinSort: universe too large to index");
+    /// Merge runs until the stack invariants hold again.
+    void mergeCollapse() {
+        while (run_count_ > 1) {
+            std::size_t n = run_count_ - 2;
+            if ((n > 0 && run_length_[n - 1] <=
+                              run_length_[n] + run_length_[n + 1]) ||
+                (n > 1 &&
+                 run_length_[n - 2] <= run_length_[n - 1] + run_length_[n])) {
+                if (run_length_[n - 1] < run_length_[n + 1])
+                    --n;
+            } else if (run_length_[n] > run_length_[n + 1]) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
 
-    const std::size_t m = static_cast<std::size_t>(span) + 1;
 
-    struct Node {
-        Type value;
-        Node* next;
-    };
+    /// Merge every pending run, leaving a single sorted run.
+    void mergeForceCollapse() {
+        while (run_count_ > 1) {
+            std::size_t n = run_count_ - 2;
+            if (n > 0 && run_length_[n - 1] < run_length_[n + 1])
+                --n;
+            mergeAt(n);
+        }
+    }
 
-    // Allocate bin heads and tails (ensure no leak if tails allocation throws)
-    Node** heads = new Node*[m];
-    try {
-        Node** tails = new Node*[m];
-        for (std::size_t b = 0; b < m; ++b) {
-            heads[b] = nullptr;
-            tails[b] = nullptr;
+  private:
+    Type* data_;
+    Type* scratch_;
+    std::ptrdiff_t min_gallop_ = TIMSORT_MIN_GALLOP;
+    std::size_t run_base_[TIMSORT_MAX_RUNS] = {};
+    std::size_t run_length_[TIMSORT_MAX_RUNS] = {};
+    std::size_t run_count_ = 0;
+
+
+    /**
+     * @brief Merge the stack entries i and i + 1.
+     *
+     * Elements of the first run that are already in place (not greater than
+     * the head of the second run) and elements of the second run that are
+     * already in place (not less than the tail of the first run) are skipped
+     * with a gallop before the merge proper.
+     */
+    void mergeAt(const std::size_t i) {
+        std::size_t base1 = run_base_[i];
+        std::size_t length1 = run_length_[i];
+        const std::size_t base2 = run_base_[i + 1];
+        std::size_t length2 = run_length_[i + 1];
+
+        run_length_[i] = length1 + length2;
+        if (i + 3 == run_count_) {
+            run_base_[i + 1] = run_base_[i + 2];
+            run_length_[i + 1] = run_length_[i + 2];
         }
+        --run_count_;
+
+        const std::size_t skip =
+            gallopRight(data_[base2], data_ + base1, length1, 0);
+        base1 += skip;
+        length1 -= skip;
+        if (length1 == 0)
+            return;
+
+        length2 = gallopLeft(data_[base1 + length1 - 1], data_ + base2,
+                             length2, length2 - 1);
+        if (length2 == 0)
+            return;
+
+        if (length1 <= length2)
+            mergeLo(base1, length1, base2, length2);
+        else
+            mergeHi(base1, length1, base2, length2);
+    }
+
+
+    /**
+     * @brief Galloping merge of two adjacent runs, the first being the
+     * shorter one.
+     *
+     * Requires data_[base2] < data_[base1] and the last element of the first
+     * run to be greater than every element of the second (mergeAt() trims the
+     * runs to ensure both). The first run is moved into scratch_ and merged
+     * forwards; the gap [dest, cursor2) always has room for the `remaining1`
+     * buffered elements, which are moved back into it if a comparison throws.
+     */
+    void mergeLo(const std::size_t base1, const std::size_t length1,
+                 const std::size_t base2, const std::size_t length2) {
+        Type* data = data_;
+        Type* tmp = scratch_;
+        std::uninitialized_move(data + base1, data + base1 + length1, tmp);
+
+        std::size_t cursor1 = 0;
+        std::size_t cursor2 = base2;
+        std::size_t dest = base1;
+        std::size_t remaining1 = length1;
+        std::size_t remaining2 = length2;
+
+        // Returns once the first run is down to one element or the second
+        // one is exhausted
+        const auto mergeRuns = [&]() {
+            data[dest++] = std::move(data[cursor2++]);
+            if (--remaining2 == 0 || remaining1 == 1)
+                return;
+
+            while (true) {
+                std::ptrdiff_t count1 = 0;
+                std::ptrdiff_t count2 = 0;
+
+                // One element at a time until one run wins min_gallop_ times
+                do {
+                    if (data[cursor2] < tmp[cursor1]) {
+                        data[dest++] = std::move(data[cursor2++]);
+                        ++count2;
+                        count1 = 0;
+                        if (--remaining2 == 0)
+                            return;
+                    } else {
+                        data[dest++] = std::move(tmp[cursor1++]);
+                        ++count1;
+                        count2 = 0;
+                        if (--remaining1 == 1)
+                            return;
+                    }
+                } while ((count1 | count2) < min_gallop_);
+
+                // Gallop while either run keeps winning in blocks
+                do {
+                    count1 = static_cast<std::ptrdiff_t>(gallopRight(
+                        data[cursor2], tmp + cursor1, remaining1, 0));
+                    if (count1 != 0) {
+                        std::move(tmp + cursor1, tmp + cursor1 + count1,
+                                  data + dest);
+                        dest += count1;
+                        cursor1 += count1;
+                        remaining1 -= count1;
+                        if (remaining1 <= 1)
+                            return;
+                    }
+                    data[dest++] = std::move(data[cursor2++]);
+                    if (--remaining2 == 0)
+                        return;
+
+                    count2 = static_cast<std::ptrdiff_t>(gallopLeft(
+                        tmp[cursor1], data + cursor2, remaining2, 0));
+                    if (count2 != 0) {
+                        std::move(data + cursor2, data + cursor2 + count2,
+                                  data + dest);
+                        dest += count2;
+                        cursor2 += count2;
+                        remaining2 -= count2;
+                        if (remaining2 == 0)
+                            return;
+                    }
+                    data[dest++] = std::move(tmp[cursor1++]);
+                    if (--remaining1 == 1)
+                        return;
+                    --min_gallop_;
+                } while (count1 >= TIMSORT_MIN_GALLOP ||
+                         count2 >= TIMSORT_MIN_GALLOP);
+
+                // Penalize leaving gallop mode
+                min_gallop_ = std::max<std::ptrdiff_t>(min_gallop_, 0) + 2;
+            }
+        };
 
-        // Phase 1: distribute elements into bins
         try {
-            for (std::size_t i = 0; i < array.size(); ++i) {
-                const Type v = array[i];
-                if (v < min_value || v > max_value)
-                    throw std::out_of_range(
-                        "BinSort: value out of [min,max] universe");
-
-                // Compute bin index in unsigned domain without narrowing
-                const auto bin =
-                    static_cast<std::size_t>(static_cast<U>(v) - umin);
-
-                Node* node = new Node{v, nullptr};
-                if (!heads[bin]) {
-                    heads[bin] = tails[bin] = node;
-                } else {
-                    tails[bin]->next = node;
-                    tails[bin] = node;
-                }
+            mergeRuns();
+            if (remaining1 == 1 && remaining2 > 0) {
+                // The last buffered element goes after the rest of run 2
+                std::move(data + cursor2, data + cursor2 + remaining2,
+                          data + dest);
+                dest += remaining2;
+                cursor2 += remaining2;
             }
         } catch (...) {
-            for (std::size_t b = 0; b < m; ++b) {
-                Node* cur = heads[b];
-                while (cur) {
-                    Node* nxt = cur->next;
-                    delete cur;
-                    cur = nxt;
-                }
-            }
-            delete[] heads;
-            delete[] tails;
+            std::move(tmp + cursor1, tmp + cursor1 + remaining1, data + dest);
+            std::destroy(tmp, tmp + length1);
             throw;
         }
 
-        // Phase 2: collect back to A in increasing bin index
-        std::size_t write = 0;
-        for (std::size_t b = 0; b < m; ++b) {
-            Node* cur = heads[b];
-            while (cur) {
-                array[write++] = cur->value;
-                Node* nxt = cur->next;
-                delete cur;
-                cur = nxt;
-            }
-        }
+        std::move(tmp + cursor1, tmp + cursor1 + remaining1, data + dest);
+        std::destroy(tmp, tmp + length1);
+    }
+
+
+    /**
+     * @brief Galloping merge of two adjacent runs, the second being the
+     * shorter one.
+     *
+     * Mirror image of mergeLo(): the second run is moved into scratch_ and
+     * merged backwards. The gap [end1, dest_end) always has room for the
+     * `remaining2` buffered elements tmp[0..remaining2).
+     */
+    void mergeHi(const std::size_t base1, const std::size_t length1,
+                 const std::size_t base2, const std::size_t length2) {
+        Type* data = data_;
+        Type* tmp = scratch_;
+        std::uninitialized_move(data + base2, data + base2 + length2, tmp);
+
+        std::size_t end1 = base1 + length1;
+        std::size_t dest_end = base2 + length2;
+        std::size_t remaining1 = length1;
+        std::size_t remaining2 = length2;
+
+        // Returns once the second run is down to one element or the first
+        // one is exhausted
+        const auto mergeRuns = [&]() {
+            data[--dest_end] = std::move(data[--end1]);
+            if (--remaining1 == 0 || remaining2 == 1)
+                return;
+
+            while (true) {
+                std::ptrdiff_t count1 = 0;
+                std::ptrdiff_t count2 = 0;
+
+                do {
+                    if (tmp[remaining2 - 1] < data[end1 - 1]) {
+                        data[--dest_end] = std::move(data[--end1]);
+                        ++count1;
+                        count2 = 0;
+                        if (--remaining1 == 0)
+                            return;
+                    } else {
+                        data[--dest_end] = std::move(tmp[--remaining2]);
+                        ++count2;
+                        count1 = 0;
+                        if (remaining2 == 1)
+                            return;
+                    }
+                } while ((count1 | count2) < min_gallop_);
+
+                do {
+                    count1 = static_cast<std::ptrdiff_t>(
+                        remaining1 - gallopRight(tmp[remaining2 - 1],
+                                                 data + base1, remaining1,
+                                                 remaining1 - 1));
+                    if (count1 != 0) {
+                        std::move_backward(data + end1 - count1, data + end1,
+                                           data + dest_end);
+                        dest_end -= count1;
+                        end1 -= count1;
+                        remaining1 -= count1;
+                        if (remaining1 == 0)
+                            return;
+                    }
+                    data[--dest_end] = std::move(tmp[--remaining2]);
+                    if (remaining2 == 1)
+                        return;
+
+                    count2 = static_cast<std::ptrdiff_t>(
+                        remaining2 - gallopLeft(data[end1 - 1], tmp,
+                                                remaining2, remaining2 - 1));
+                    if (count2 != 0) {
+                        dest_end -= count2;
+                        remaining2 -= count2;
+                        std::move(tmp + remaining2,
+                                  tmp + remaining2 + count2, data + dest_end);
+                        if (remaining2 <= 1)
+                            return;
+                    }
+                    data[--dest_end] = std::move(data[--end1]);
+                    if (--remaining1 == 0)
+                        return;
+                    --min_gallop_;
+                } while (count1 >= TIMSORT_MIN_GALLOP ||
+                         count2 >= TIMSORT_MIN_GALLOP);
+
+                min_gallop_ = std::max<std::ptrdiff_t>(min_gallop_, 0) + 2;
+            }
+        };
+
+        try {
+            mergeRuns();
+            if (remaining2 == 1 && remaining1 > 0) {
+                // The last buffered element goes before the rest of run 1
+                std::move_backward(data + base1, data + end1, data + dest_end);
+                dest_end -= remaining1;
+                end1 = base1;
+            }
+        } catch (...) {
+            std::move(tmp, tmp + remaining2, data + end1);
+            std::destroy(tmp, tmp + length2);
+            throw;
+        }
+
+        std::move(tmp, tmp + remaining2, data + end1);
+        std::destroy(tmp, tmp + length2);
+    }
+};
+
+
+/// Bits per radix sort digit; every pass distributes into 2^8 buckets.
+inline constexpr std::size_t RADIX_SORT_DIGIT_BITS = 8;
+inline constexpr std::size_t RADIX_SORT_BUCKETS = std::size_t{1}
+                                                  << RADIX_SORT_DIGIT_BITS;
+
+/// Ranges (and MSD buckets) of at most this many elements are finished by
+/// insertion sort.
+inline constexpr std::size_t RADIX_SORT_INSERTION_THRESHOLD = 64;
+
+
+/// Whether the radix sorts accept Type: integral types other than bool, and
+/// IEEE-754 float and double.
+template <typename Type>
+inline constexpr bool IS_RADIX_SORTABLE =
+    (std::is_integral_v<Type> && !std::is_same_v<Type, bool>) ||
+    (std::is_floating_point_v<Type> && std::numeric_limits<Type>::is_iec559 &&
+     (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+
+/// Unsigned integer of the same width as Type, in which radix keys are kept.
+template <typename Type>
+using RadixKey = typename std::conditional_t<
+    std::is_floating_point_v<Type>,
+    std::type_identity<std::conditional_t<sizeof(Type) == 4, std::uint32_t,
+                                          std::uint64_t>>,
+    std::make_unsigned<Type>>::type;
+
+
+/**
+ * @brief Map a value to an unsigned key whose unsigned order matches the
+ * value order.
+ *
+ * - Unsigned integers are used as they are.
+ * - Signed integers get their sign bit flipped, so negatives come first.
+ * - Floating-point values are reinterpreted as bits; negatives have every
+ *   bit flipped (reversing their order), non-negatives only the sign bit.
+ *   This orders -inf < negatives < -0.0 < +0.0 < positives < +inf; NaNs end
+ *   up at either end depending on their sign bit.
+ */
+template <typename Type>
+constexpr RadixKey<Type> toRadixKey(const Type value) noexcept {
+    using Key = RadixKey<Type>;
+    constexpr Key SIGN_BIT = Key{1}
+                             << (std::numeric_limits<Key>::digits - 1);
+
+    if constexpr (std::is_floating_point_v<Type>) {
+        const Key bits = std::bit_cast<Key>(value);
+        return (bits & SIGN_BIT) ? static_cast<Key>(~bits)
+                                 : static_cast<Key>(bits | SIGN_BIT);
+    } else if constexpr (std::is_signed_v<Type>) {
+        return static_cast<Key>(static_cast<Key>(value) ^ SIGN_BIT);
+    } else {
+        return static_cast<Key>(value);
+    }
+}
+
+
+/// Digit `digit` (0 = least significant) of the radix key of `value`.
+template <typename Type>
+constexpr std::size_t radixDigit(const Type value,
+                                 const std::size_t digit) noexcept {
+    return static_cast<std::size_t>(
+        (toRadixKey(value) >> (digit * RADIX_SORT_DIGIT_BITS)) &
+        (RADIX_SORT_BUCKETS - 1));
+}
+
+
+/// Insertion sort of [left, right) by radix key, so small ranges end up in
+/// the same order as the radix passes would put them.
+template <typename Type>
+void radixInsertionSort(Type* data, const std::size_t left,
+                        const std::size_t right) noexcept {
+    for (std::size_t i = left + 1; i < right; ++i) {
+        const Type value = data[i];
+        const RadixKey<Type> key = toRadixKey(value);
+        std::size_t j = i;
+        for (; j > left && key < toRadixKey(data[j - 1]); --j)
+            data[j] = data[j - 1];
+        data[j] = value;
+    }
+}
+
+
+/**
+ * @brief American flag sort (in-place MSD radix sort) of [left, right) on
+ * digit `digit` and every less significant one.
+ *
+ * Counts the digit's buckets, then permutes the elements into place by
+ * following cycles: each misplaced element is swapped straight into the next
+ * free slot of its bucket. Buckets are then sorted on the next digit; small
+ * buckets go to insertion sort, and a digit shared by the whole range is
+ * skipped without moving anything.
+ *
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the sub-range (inclusive).
+ * @param right Last index of the sub-range (exclusive).
+ * @param digit Index of the digit to distribute on (0 = least significant).
+ */
+template <typename Type>
+void americanFlagSort(Type* data, const std::size_t left,
+                      const std::size_t right, std::size_t digit) {
+    const std::size_t size = right - left;
+    if (size <= RADIX_SORT_INSERTION_THRESHOLD) {
+        radixInsertionSort(data, left, right);
+        return;
+    }
+
+    std::size_t counts[RADIX_SORT_BUCKETS];
+    while (true) {
+        std::fill(counts, counts + RADIX_SORT_BUCKETS, 0);
+        for (std::size_t i = left; i < right; ++i)
+            ++counts[radixDigit(data[i], digit)];
+
+        // A digit shared by every element does not split anything
+        if (counts[radixDigit(data[left], digit)] != size)
+            break;
+        if (digit == 0)
+            return;
+        --digit;
+    }
+
+    std::size_t heads[RADIX_SORT_BUCKETS];
+    std::size_t tails[RADIX_SORT_BUCKETS];
+    std::size_t offset = left;
+    for (std::size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+        heads[bucket] = offset;
+        offset += counts[bucket];
+        tails[bucket] = offset;
+    }
+
+    for (std::size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+        while (heads[bucket] < tails[bucket]) {
+            Type value = data[heads[bucket]];
+            std::size_t target = radixDigit(value, digit);
+            while (target != bucket) {
+                std::swap(value, data[heads[target]++]);
+                target = radixDigit(value, digit);
+            }
+            data[heads[bucket]++] = value;
+        }
+    }
+
+    if (digit == 0)
+        return;
+
+    std::size_t start = left;
+    for (std::size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+        if (counts[bucket] > 1)
+            americanFlagSort(data, start, start + counts[bucket], digit - 1);
+        start += counts[bucket];
+    }
+}
+
+
+/// Checks if the range is sorted in ascending order.
+template <typename Type>
+bool isSorted(const std::span<Type> range) noexcept {
+    const Type* data = range.data();
+    for (std::size_t i = 1; i < range.size(); ++i)
+        if (data[i] < data[i - 1])
+            return false;
+
+    return true;
+}
+
+
+/// Checks if the array is sorted in ascending order.
+template <typename Type, typename Allocator, typename GrowthPolicy>
+bool isSorted(
+    const DynamicArray<Type, Allocator, GrowthPolicy>& array) noexcept {
+    return isSorted(array.span());
+}
+
+
+/*** Sorting Algorithms ***/
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using the Bubble
+ * Sort algorithm.
+ *
+ * This method repeatedly steps through the list, compares adjacent elements,
+ * and swaps them if they are in the wrong order. The process is repeated until
+ * the list is sorted. Stable.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n^2) time complexity in the average and worst cases.
+ * - O(n) time complexity in the best case (when the array is already sorted).
+ * - O(1) additional space complexity.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void BubbleSort(const std::span<Type> range) {
+    if (range.size() <= 1 || isSorted(range))
+        return;
+
+    Type* data = range.data();
+    const std::size_t n = range.size();
+    for (std::size_t i = 0; i < n - 1; ++i)
+        for (std::size_t j = 0; j < n - i - 1; ++j)
+            if (data[j] > data[j + 1])
+                swap(data[j], data[j + 1]);
+}
+
+
+/// Sorts the array with BubbleSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void BubbleSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    BubbleSort(array.span());
+}
+
+
+/** @brief Sorts the array in ascending (non-decreasing) order using an improved
+ * version of Bubble Sort.
+ *
+ * This method includes optimizations such as early-exit if no swaps are made
+ * during a pass, and reducing the range of subsequent passes based on the last
+ * swap position. Stable.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n^2) time complexity in the average and worst cases.
+ * - O(n) time complexity in the best case (when the array is already sorted).
+ * - O(1) additional space complexity.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void ImprovedBubbleSort(const std::span<Type> range) {
+    if (range.size() <= 1 || isSorted(range))
+        return;
+
+    // Early-exit + shrinking boundary optimization
+    Type* data = range.data();
+    std::size_t n = range.size();
+    while (n > 1) {
+        bool swapped = false;
+        std::size_t last_swap = 0;
+
+        for (std::size_t j = 0; j + 1 < n; ++j) {
+            if (data[j] > data[j + 1]) {
+                swap(data[j], data[j + 1]);
+                swapped = true;
+                last_swap = j + 1;
+            }
+        }
+
+        if (!swapped)
+            break;
+        n = last_swap;
+    }
+}
+
+
+/// Sorts the array with ImprovedBubbleSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ImprovedBubbleSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    ImprovedBubbleSort(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using the
+ * Insertion Sort algorithm with linear search.
+ *
+ * This method builds a sorted portion of the array by repeatedly taking the
+ * next element and inserting it into its correct position within the sorted
+ * portion using linear search. Stable.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n^2) time complexity in the average and worst cases.
+ * - O(n) time complexity in the best case (when the array is already sorted).
+ * - O(1) additional space complexity.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void InsertionSortWithLinearSearch(const std::span<Type> range) {
+    if (range.size() <= 1 || isSorted(range))
+        return;
+
+    insertionSortRange(range.data(), 0, range.size());
+}
+
+
+/// Sorts the array with InsertionSortWithLinearSearch(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void InsertionSortWithLinearSearch(
+    DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    InsertionSortWithLinearSearch(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using the
+ * Insertion Sort algorithm with binary search.
+ *
+ * This method builds a sorted portion of the array by repeatedly taking the
+ * next element and inserting it into its correct position within the sorted
+ * portion using binary search to find the insertion point. Stable (uses
+ * upper_bound-style insertion).
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n^2) time complexity in the average and worst cases due to shifting
+ * elements.
+ * - O(n log n) time complexity for finding the insertion point using binary
+ * search.
+ * - O(1) additional space complexity.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void InsertionSortWithBinarySearch(const std::span<Type> range) {
+    if (range.size() <= 1 || isSorted(range))
+        return;
+
+    Type* data = range.data();
+    for (std::size_t i = 1; i < range.size(); ++i) {
+        Type key = std::move(data[i]);
+
+        // Binary search for insertion position in [0, i)
+        std::size_t left = 0, right = i;
+        while (left < right) {
+            std::size_t mid = left + (right - left) / 2;
+            if (data[mid] <= key)
+                left = mid + 1;
+            else
+                right = mid;
+        }
+
+        // Shift to make room
+        for (std::size_t j = i; j > left; --j)
+            data[j] = std::move(data[j - 1]);
+
+        data[left] = std::move(key);
+    }
+}
+
+
+/// Sorts the array with InsertionSortWithBinarySearch(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void InsertionSortWithBinarySearch(
+    DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    InsertionSortWithBinarySearch(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using the Heap
+ * Sort algorithm.
+ *
+ * Builds a max-heap in place (bottom-up), then repeatedly moves the maximum
+ * behind the shrinking heap. Not stable. Only `operator<` is used.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n log n) time complexity in all cases.
+ * - O(1) additional space complexity.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void HeapSort(const std::span<Type> range) {
+    heapSortRange(range.data(), 0, range.size());
+}
+
+
+/// Sorts the array with HeapSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void HeapSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    HeapSort(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using Quick Sort
+ * (introsort variant).
+ *
+ * Hybrid introsort: quicksort with a median-of-three / ninther pivot and Hoare
+ * partitioning, insertion sort for ranges of at most
+ * INTROSORT_INSERTION_THRESHOLD elements, and a heapsort fallback once the
+ * partitioning depth exceeds 2 * floor(log2(n)). Sorted, reversed, organ-pipe
+ * and all-equal inputs are split evenly, and no pre-pass over the input is
+ * made. Not stable. Only `operator<` is used.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n log n) average and worst-case time complexity.
+ * - O(log n) space complexity due to recursion stack (recursion always goes
+ * into the smaller side).
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void QuickSort(const std::span<Type> range) {
+    if (range.size() <= 1)
+        return;
+
+    std::size_t depth_limit = 0;
+    for (std::size_t n = range.size(); n > 1; n >>= 1)
+        depth_limit += 2;
+
+    introSortLoop(range.data(), 0, range.size(), depth_limit);
+}
+
+
+/// Sorts the array with QuickSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void QuickSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    QuickSort(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using the Merge
+ * Sort algorithm.
+ *
+ * Bottom-up (iterative) merge sort: runs of MERGE_SORT_RUN_LENGTH elements are
+ * sorted by insertion sort, then merged in passes of doubling width. Each merge
+ * moves only its shorter run into the scratch buffer, which is allocated once
+ * per sort with room for mergeSortScratchSize(n) uninitialized elements.
+ * Elements are moved, never copied, and Type does not need to be default
+ * constructible. Stable. Only `operator<` is used.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n log n) time complexity in the average and worst cases.
+ * - O(n) time complexity in the best case (when the range is already sorted).
+ * - O(n) additional space complexity (n / 2 elements), one allocation.
+ *
+ * @par Exception Safety
+ * - Basic: if a comparison throws, the range holds a permutation of its
+ *   original elements. If a move throws, the elements are valid but
+ *   unspecified.
+ *
+ * @param range The range to sort.
+ *
+ * @throws std::bad_alloc If the scratch buffer cannot be allocated.
+ */
+template <typename Type>
+void MergeSort(const std::span<Type> range) {
+    if (range.size() <= 1)
+        return;
+
+    ScratchBuffer<Type> scratch(mergeSortScratchSize(range.size()));
+    mergeSortBottomUp(range.data(), range.size(), scratch.data());
+}
+
+
+/**
+ * @brief Sorts the range with MergeSort(std::span) using caller-supplied
+ * scratch storage.
+ *
+ * Makes no allocation, so repeated sorts can share one buffer.
+ *
+ * @param range The range to sort.
+ * @param scratch Uninitialized storage, suitably aligned for Type, with room
+ * for at least mergeSortScratchSize(range.size()) elements. It holds no live
+ * objects on return.
+ */
+template <typename Type>
+void MergeSort(const std::span<Type> range, Type* scratch) {
+    if (range.size() <= 1)
+        return;
+
+    mergeSortBottomUp(range.data(), range.size(), scratch);
+}
+
+
+/// Sorts the array with MergeSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void MergeSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    MergeSort(array.span());
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using TimSort.
+ *
+ * Adaptive, stable merge sort over natural runs. The range is scanned for
+ * runs that are already non-decreasing or strictly decreasing (the latter are
+ * reversed in place); runs shorter than minRunLength(n) are extended with
+ * binary insertion sort. Runs are merged through a stack whose invariants
+ * keep merges balanced, and each merge gallops (exponential search) through
+ * long stretches taken from the same run. Already sorted, reversed and
+ * nearly-sorted inputs (appended or lightly edited data) sort in close to
+ * linear time. Only `operator<` is used.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n log n) time complexity in the worst case.
+ * - O(n) time complexity when the range consists of a few runs.
+ * - O(n) additional space complexity (n / 2 elements), allocated only if
+ *   there is something to merge.
+ *
+ * @par Exception Safety
+ * - Basic: if a comparison throws, the range holds a permutation of its
+ *   original elements. If a move throws, the elements are valid but
+ *   unspecified.
+ *
+ * @param range The range to sort.
+ *
+ * @throws std::bad_alloc If the scratch buffer cannot be allocated.
+ */
+template <typename Type>
+void TimSort(const std::span<Type> range) {
+    Type* data = range.data();
+    const std::size_t size = range.size();
+    if (size < 2)
+        return;
+
+    std::size_t run = countRunAndMakeAscending(data, 0, size);
+    if (size < TIMSORT_MIN_MERGE) {
+        binaryInsertionSort(data, 0, size, run);
+        return;
+    }
+    if (run == size)
+        return;
+
+    ScratchBuffer<Type> scratch(size / 2);
+    TimSortRuns<Type> runs(data, scratch.data());
+    const std::size_t min_run = minRunLength(size);
+
+    for (std::size_t left = 0;;) {
+        if (run < min_run) {
+            const std::size_t forced = std::min(min_run, size - left);
+            binaryInsertionSort(data, left, left + forced, left + run);
+            run = forced;
+        }
+
+        runs.pushRun(left, run);
+        runs.mergeCollapse();
+
+        left += run;
+        if (left == size)
+            break;
+        run = countRunAndMakeAscending(data, left, size);
+    }
+
+    runs.mergeForceCollapse();
+}
+
+
+/// Sorts the array with TimSort(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void TimSort(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    TimSort(array.span());
+}
+
+
+/**
+ * @brief Bin Sort for a known 0-based universe.
+ *
+ * Universe: U = {0, 1, ..., universe_size-1}. Each element of the array must be
+ * in U.
+ *
+ * Counting sort: one pass counts the occurrences of every key (and validates
+ * it), then the keys are written back in order straight from the counts. No
+ * per-element allocation is made, and the range is left untouched if a value
+ * is out of range.
+ *
+ * Stable (equal integers are indistinguishable), O(n + m) time, O(m) extra
+ * space, where n = size(), m = universe_size.
+ *
+ * @param range The range to sort.
+ * @param universe_size The size of the universe (m). Must be > 0.
+ *
+ * @throws std::out_of_range if a value is outside [0, universe_size).
+ * @throws std::bad_alloc if the count array cannot be allocated.
+ */
+template <typename Type>
+void BinSort(const std::span<Type> range, const std::size_t universe_size) {
+    static_assert(std::numeric_limits<Type>::is_integer,
+                  "BinSort(universe) requires an integral Type.");
+
+    if (range.size() <= 1 || universe_size == 0)
+        return;
+
+    Type* data = range.data();
+    const auto counts = std::make_unique<std::size_t[]>(universe_size);
+
+    // Phase 1: count (and validate) every key before anything is modified
+    for (std::size_t i = 0; i < range.size(); ++i) {
+        const auto bin = static_cast<std::size_t>(data[i]);
+        if (bin >= universe_size)
+            throw std::out_of_range("BinSort: value out of [0, m) universe");
+        ++counts[bin];
+    }
+
+    // Phase 2: write every key back as many times as it occurred
+    Type* out = data;
+    for (std::size_t bin = 0; bin < universe_size; ++bin)
+        out = std::fill_n(out, counts[bin], static_cast<Type>(bin));
+}
+
+
+/// Sorts the array with BinSort(std::span, universe_size).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void BinSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+             const std::size_t universe_size) {
+    BinSort(array.span(), universe_size);
+}
+
+
+/**
+ * @brief Bin Sort for a known contiguous universe range.
+ *
+ * Universe: U = {min_value, min_value+1, ..., max_value}. Each element must lie
+ * in this range. Internally maps key x to bin index (x - min_value), counts
+ * the keys and writes them back in ascending order, as the 0-based overload.
+ *
+ * Stable, O(n + m) time, O(m) extra space, where n = size(),
+ * m = static_cast<std::size_t>(max_value - min_value + 1).
+ *
+ * @param range The range to sort.
+ * @param min_value Minimum value in the universe (inclusive).
+ * @param max_value Maximum value in the universe (inclusive).
+ *
+ * @throws std::out_of_range if an element of the range is outside [min_value,
+ * max_value]; the range is then left unchanged.
+ * @throws std::length_error if the universe does not fit into size_t.
+ * @throws std::bad_alloc if the count array cannot be allocated.
+ */
+template <typename Type>
+void BinSort(const std::span<Type> range,
+             const std::type_identity_t<Type> min_value,
+             const std::type_identity_t<Type> max_value) {
+    static_assert(std::numeric_limits<Type>::is_integer,
+                  "BinSort(range) requires an integral Type.");
+
+    if (range.size() <= 1 || max_value < min_value)
+        return;
+
+    Type* data = range.data();
+
+    // Define unsigned counterpart to avoid narrowing/UB
+    using U = std::make_unsigned_t<Type>;
+
+    // Map bounds to unsigned once
+    const U umin = static_cast<U>(min_value);
+    const U umax = static_cast<U>(max_value);
+
+    const U span = static_cast<U>(umax - umin);
 
-        delete[] heads;
-        delete[] tails;
+    // Ensure m = span + 1 fits into size_t to avoid overflow on allocation
+    if (static_cast<std::uintmax_t>(span) >=
+        std::numeric_limits<std::size_t>::max())
+        throw std::length_error("BinSort: universe too large to index");
+
+    const std::size_t m = static_cast<std::size_t>(span) + 1;
+    const auto counts = std::make_unique<std::size_t[]>(m);
+
+    // Phase 1: count (and validate) every key before anything is modified
+    for (std::size_t i = 0; i < range.size(); ++i) {
+        const Type v = data[i];
+        if (v < min_value || v > max_value)
+            throw std::out_of_range("BinSort: value out of [min,max] universe");
+
+        // Compute bin index in unsigned domain; the cast back to U undoes
+        // the integer promotion of narrow types
+        ++counts[static_cast<std::size_t>(
+            static_cast<U>(static_cast<U>(v) - umin))];
+    }
+
+    // Phase 2: write every key back as many times as it occurred
+    Type* out = data;
+    for (std::size_t bin = 0; bin < m; ++bin)
+        out = std::fill_n(out, counts[bin],
+                          static_cast<Type>(static_cast<U>(umin + bin)));
+}
+
+
+/// Sorts the array with BinSort(std::span, min_value, max_value).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void BinSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+             const std::type_identity_t<Type> min_value,
+             const std::type_identity_t<Type> max_value) {
+    BinSort(array.span(), min_value, max_value);
+}
+
+
+/**
+ * @brief Stable Bin Sort of arbitrary elements by a small integral key.
+ *
+ * Sorts records by `key_of(element)`, which must lie in the 0-based universe
+ * {0, 1, ..., universe_size-1}. Counting sort: one pass counts (and validates)
+ * the keys, a prefix sum turns the counts into bucket offsets, and the
+ * elements are scattered (moved) into one auxiliary buffer, then moved back.
+ * Elements with equal keys keep their relative order.
+ *
+ * `key_of` is called twice per element and must return the same key both
+ * times.
+ *
+ * @par Complexity
+ * - O(n + m) time, where n = size(), m = universe_size.
+ * - O(n + m) additional space: the buffer and two offset arrays.
+ *
+ * @par Exception Safety
+ * - Strong if a key is out of range (nothing has been moved yet).
+ * - Basic otherwise: if `key_of` or a move throws during the scatter, the
+ *   elements moved so far are moved back, in unspecified order.
+ *
+ * @param range The range to sort.
+ * @param universe_size The size of the key universe (m). Must be > 0.
+ * @param key_of Callable returning the integral key of an element.
+ *
+ * @throws std::out_of_range if a key is outside [0, universe_size).
+ * @throws std::bad_alloc if the buffers cannot be allocated.
+ */
+template <typename Type, typename KeyOf>
+    requires std::invocable<KeyOf&, const Type&> &&
+             std::is_integral_v<
+                 std::remove_cvref_t<std::invoke_result_t<KeyOf&, const Type&>>>
+void BinSort(const std::span<Type> range, const std::size_t universe_size,
+             KeyOf key_of) {
+    const std::size_t size = range.size();
+    if (size <= 1 || universe_size == 0)
+        return;
+
+    Type* data = range.data();
+    const auto binOf = [&](const Type& element) {
+        return static_cast<std::size_t>(std::invoke(key_of, element));
+    };
+
+    // Phase 1: count (and validate) every key; starts[b + 1] counts bin b
+    const auto starts = std::make_unique<std::size_t[]>(universe_size + 1);
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::size_t bin = binOf(data[i]);
+        if (bin >= universe_size)
+            throw std::out_of_range("BinSort: key out of [0, m) universe");
+        ++starts[bin + 1];
+    }
+
+    // Phase 2: prefix sums give the first slot of every bin
+    for (std::size_t bin = 1; bin <= universe_size; ++bin)
+        starts[bin] += starts[bin - 1];
+
+    const auto cursors = std::make_unique<std::size_t[]>(universe_size);
+    std::copy(starts.get(), starts.get() + universe_size, cursors.get());
+
+    // Phase 3: scatter into the buffer in input order (this keeps it stable)
+    ScratchBuffer<Type> buffer(size);
+    Type* out = buffer.data();
+    try {
+        for (std::size_t i = 0; i < size; ++i) {
+            std::size_t& slot = cursors[binOf(data[i])];
+            ::new (static_cast<void*>(out + slot)) Type(std::move(data[i]));
+            ++slot;
+        }
     } catch (...) {
-        delete[] heads;
+        // The scattered elements go back into the moved-from prefix
+        Type* back = data;
+        for (std::size_t bin = 0; bin < universe_size; ++bin) {
+            back = std::move(out + starts[bin], out + cursors[bin], back);
+            std::destroy(out + starts[bin], out + cursors[bin]);
+        }
         throw;
     }
+
+    std::move(out, out + size, data);
+    std::destroy(out, out + size);
+}
+
+
+/// Sorts the array with BinSort(std::span, universe_size, key_of).
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename KeyOf>
+    requires std::invocable<KeyOf&, const Type&>
+void BinSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+             const std::size_t universe_size, KeyOf key_of) {
+    BinSort(array.span(), universe_size, std::move(key_of));
+}
+
+
+/**
+ * @brief Sorts the range in ascending (non-decreasing) order using LSD
+ * (least significant digit first) Radix Sort.
+ *
+ * Works for any integral type (except bool) and for IEEE-754 float and
+ * double; values are mapped to order-preserving unsigned keys with
+ * toRadixKey(). One pass over the input builds the histograms of all
+ * 8-bit digits, then each digit is distributed with prefix sums from one
+ * buffer into the other. Digits that are equal across the whole range (for
+ * example the high bytes of small IDs) are skipped. Stable.
+ *
+ * Floating-point keys order -0.0 before +0.0; NaNs are placed at either end.
+ *
+ * @par Complexity
+ * - O(w * n) time complexity, where w = sizeof(Type) digits.
+ * - O(n) additional space complexity: one auxiliary buffer, no per-element
+ *   allocation.
+ *
+ * @param range The range to sort.
+ *
+ * @throws std::bad_alloc If the auxiliary buffer cannot be allocated.
+ */
+template <typename Type>
+void RadixSortLSD(const std::span<Type> range) {
+    static_assert(IS_RADIX_SORTABLE<Type>,
+                  "RadixSortLSD requires an integral or IEEE-754 float/double "
+                  "Type.");
+
+    constexpr std::size_t DIGITS = sizeof(Type);
+    Type* data = range.data();
+    const std::size_t size = range.size();
+    if (size <= RADIX_SORT_INSERTION_THRESHOLD) {
+        radixInsertionSort(data, 0, size);
+        return;
+    }
+
+    std::size_t counts[DIGITS][RADIX_SORT_BUCKETS] = {};
+    for (std::size_t i = 0; i < size; ++i) {
+        const RadixKey<Type> key = toRadixKey(data[i]);
+        for (std::size_t digit = 0; digit < DIGITS; ++digit)
+            ++counts[digit][(key >> (digit * RADIX_SORT_DIGIT_BITS)) &
+                            (RADIX_SORT_BUCKETS - 1)];
+    }
+
+    ScratchBuffer<Type> buffer(size);
+    Type* source = data;
+    Type* target = buffer.data();
+
+    for (std::size_t digit = 0; digit < DIGITS; ++digit) {
+        std::size_t* count = counts[digit];
+        if (count[radixDigit(source[0], digit)] == size)
+            continue;
+
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < RADIX_SORT_BUCKETS; ++bucket) {
+            const std::size_t bucket_size = count[bucket];
+            count[bucket] = offset;
+            offset += bucket_size;
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+            target[count[radixDigit(source[i], digit)]++] = source[i];
+        std::swap(source, target);
+    }
+
+    if (source != data)
+        std::copy(source, source + size, data);
+}
+
+
+/// Sorts the array with RadixSortLSD(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void RadixSortLSD(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    RadixSortLSD(array.span());
+}
+
+
+/**
+ * @brief Sorts the range in ascending (non-decreasing) order using in-place
+ * MSD (most significant digit first) Radix Sort, also known as American flag
+ * sort.
+ *
+ * Accepts the same types and key mapping as RadixSortLSD(). Elements are
+ * permuted into their 8-bit buckets in place, most significant digit first,
+ * and each bucket is sorted recursively on the next digit; buckets of at most
+ * RADIX_SORT_INSERTION_THRESHOLD elements are finished by insertion sort.
+ * Needs no auxiliary buffer, and stops early on ranges whose keys differ only
+ * in their high digits. Not stable.
+ *
+ * @par Complexity
+ * - O(w * n) time complexity, where w = sizeof(Type) digits.
+ * - O(w * 2^8) additional space for the bucket counters of the recursion.
+ *
+ * @param range The range to sort.
+ */
+template <typename Type>
+void RadixSortMSD(const std::span<Type> range) {
+    static_assert(IS_RADIX_SORTABLE<Type>,
+                  "RadixSortMSD requires an integral or IEEE-754 float/double "
+                  "Type.");
+
+    if (range.size() <= 1)
+        return;
+
+    americanFlagSort(range.data(), 0, range.size(), sizeof(Type) - 1);
+}
+
+
+/// Sorts the array with RadixSortMSD(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void RadixSortMSD(DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    RadixSortMSD(array.span());
+}
+
+
+/**
+ * @brief Sort key of one table row: the key (or, if it is not trivially
+ * copyable, a pointer to it) and the row index.
+ *
+ * Equal keys are ordered by row index, so every sort orders the rows
+ * stably.
+ */
+template <typename Key>
+struct RowKey {
+    static constexpr bool BY_VALUE = std::is_trivially_copyable_v<Key>;
+
+    std::conditional_t<BY_VALUE, Key, const Key*> key;
+    std::size_t row;
+
+    const Key& value() const noexcept {
+        if constexpr (BY_VALUE)
+            return key;
+        else
+            return *key;
+    }
+
+    bool operator<(const RowKey& other) const {
+        if (value() < other.value())
+            return true;
+        return !(other.value() < value()) && row < other.row;
+    }
+};
+
+
+/**
+ * @brief Sorts the rows of a StructOfArrays by column I, using `sort` on the
+ * keys.
+ *
+ * Only the key column is read while sorting: its keys are collected with
+ * their row indices into one array, which `sort` orders (any sort of this
+ * file taking a span will do, e.g. `[](auto keys) { algo::TimSort(keys); }`).
+ * The resulting order is then applied to every column with
+ * StructOfArrays::permute. Equal keys keep their relative order, whether or
+ * not `sort` is stable. Only `operator<` of the key is used.
+ *
+ * Note for float/double: Keys containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @tparam I Index of the key column.
+ * @param table The table to sort.
+ * @param sort Callable sorting a std::span<RowKey<Key>> by operator<.
+ *
+ * @par Complexity
+ * - The sort's complexity on n keys, plus O(n) per column for the
+ *   permutation (skipped if the rows are already in order).
+ * - O(n) additional space for the keys and the order, plus one column at a
+ *   time while permuting.
+ *
+ * @par Exception Safety
+ * - Strong: the table is unchanged if sorting or permuting throws.
+ */
+template <std::size_t I, typename Row, typename Allocator,
+          typename GrowthPolicy, typename Sort>
+void SortByColumn(StructOfArrays<Row, Allocator, GrowthPolicy>& table,
+                  Sort sort) {
+    using Table = StructOfArrays<Row, Allocator, GrowthPolicy>;
+    using Key = typename Table::template ColumnType<I>;
+
+    const std::span<const Key> keys = table.template column<I>();
+    const std::size_t size = keys.size();
+    if (size <= 1)
+        return;
+
+    DynamicArray<RowKey<Key>> sorted;
+    sorted.reserve(size);
+    for (std::size_t row = 0; row < size; ++row) {
+        if constexpr (RowKey<Key>::BY_VALUE)
+            sorted.addLast(RowKey<Key>{keys[row], row});
+        else
+            sorted.addLast(RowKey<Key>{&keys[row], row});
+    }
+    sort(sorted.span());
+
+    DynamicArray<std::size_t> order;
+    order.reserve(size);
+    bool in_order = true;
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::size_t row = sorted.getUnchecked(i).row;
+        in_order = in_order && row == i;
+        order.addLast(row);
+    }
+
+    if (!in_order)
+        table.permute(order.span());
+}
+
+
+/// Sorts the rows of a StructOfArrays by column I with QuickSort.
+template <std::size_t I, typename Row, typename Allocator,
+          typename GrowthPolicy>
+void SortByColumn(StructOfArrays<Row, Allocator, GrowthPolicy>& table) {
+    SortByColumn<I>(table, [](const auto keys) { QuickSort(keys); });
 }
 
 
 /*** Searching Algorithms ***/
 
 
+/**
+ * @brief Performs a linear search in the range for the given element.
+ *
+ * Scans the range from start to end, comparing each element to the target.
+ * Returns the index of the first occurrence of the element, or size() if not
+ * found. Ranges of integers, float and double are scanned with
+ * data_structs::simd::findFirst(), up to 64 elements per instruction.
+ *
+ * @param range The range to search in.
+ * @param element The element to search for.
+ * @return The index of the found element, or size() if not found.
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+std::size_t LinearSearch(const std::span<Type> range,
+                         const std::type_identity_t<Type>& element) noexcept {
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>)
+        return simd::findFirst<Value>(range.data(), range.size(), element);
+
+    const Type* data = range.data();
+    for (std::size_t i = 0; i < range.size(); ++i)
+        if (data[i] == element)
+            return i;
+    return range.size();
+}
+
+
 /**
  * @brief Performs a linear search in the array for the given element.
  *
@@ -602,51 +2035,296 @@ void BinSort(DynamicArray<Type>& array, const Type min_value,
  * - O(n) time.
  * - O(1) space.
  */
-template <typename Type>
-std::size_t LinearSearch(const DynamicArray<Type>& array,
-                         const Type& element) noexcept {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+std::size_t LinearSearch(
+    const DynamicArray<Type, Allocator, GrowthPolicy>& array,
+    const Type& element) noexcept {
     return array.contains(element);
 }
 
 
+/**
+ * @brief Counts the elements of the range equal to the given element.
+ *
+ * Ranges of integers, float and double are counted with
+ * data_structs::simd::count().
+ *
+ * @param range The range to search in.
+ * @param element The element to count.
+ * @return The number of elements equal to element.
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+std::size_t Count(const std::span<Type> range,
+                  const std::type_identity_t<Type>& element) {
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>) {
+        return simd::count<Value>(range.data(), range.size(), element);
+    } else {
+        std::size_t matches = 0;
+        for (const Type& value : range)
+            if (value == element)
+                ++matches;
+        return matches;
+    }
+}
+
+
+/// Counts the matching elements of the array with Count(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+std::size_t Count(const DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                  const Type& element) {
+    return Count(array.span(), element);
+}
+
+
+/**
+ * @brief Collects the indices of every element of the range equal to the
+ * given element.
+ *
+ * Ranges of integers, float and double are scanned with
+ * data_structs::simd::findAll().
+ *
+ * @param range The range to search in.
+ * @param element The element to search for.
+ * @return The matching indices in increasing order.
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(k) space for k matches.
+ */
+template <typename Type>
+DynamicArray<std::size_t> FindAll(const std::span<Type> range,
+                                  const std::type_identity_t<Type>& element) {
+    DynamicArray<std::size_t> indices;
+    const auto append = [&indices](const std::size_t i) {
+        indices.addLast(i);
+    };
+
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>) {
+        simd::findAll<Value>(range.data(), range.size(), element, append);
+    } else {
+        for (std::size_t i = 0; i < range.size(); ++i)
+            if (range[i] == element)
+                append(i);
+    }
+    return indices;
+}
+
+
+/// Collects the matching indices of the array with FindAll(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+DynamicArray<std::size_t>
+FindAll(const DynamicArray<Type, Allocator, GrowthPolicy>& array,
+        const Type& element) {
+    return FindAll(array.span(), element);
+}
+
+
+/**
+ * @brief Returns the index of the first element not less than the given one
+ * (lower_bound), or size() if every element is less.
+ *
+ * Requires the range to be sorted in non-decreasing order. The search is
+ * branchless: every step halves the remaining length and moves the base by a
+ * conditional select rather than a branch, so a lookup pays no branch
+ * mispredictions. Both possible probes of the next step are prefetched, so
+ * on large ranges the cache misses of consecutive steps overlap. For
+ * read-mostly tables, data_structs::EytzingerIndex lays the same search out
+ * so that the probes share cache lines.
+ *
+ * Note for float/double: Ranges containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @param range The sorted range to search in.
+ * @param element The element to search for.
+ * @return The lower-bound index in [0, size()].
+ *
+ * @par Complexity
+ * - O(log n) time, exactly ceil(log2(n)) + 1 comparisons for n > 0.
+ * - O(1) space.
+ */
+template <typename Type>
+std::size_t LowerBound(const std::span<Type> range,
+                       const std::type_identity_t<Type>& element) noexcept {
+    if (range.empty())
+        return 0;
+
+    const Type* base = range.data();
+    std::size_t length = range.size();
+    while (length > 1) {
+        const std::size_t half = length / 2;
+        const std::size_t next_half = (length - half) / 2;
+        simd::prefetch(base, next_half * sizeof(Type));
+        simd::prefetch(base, (half + next_half) * sizeof(Type));
+
+        base = base[half] < element ? base + half : base;
+        length -= half;
+    }
+
+    return static_cast<std::size_t>(base - range.data()) +
+           static_cast<std::size_t>(*base < element);
+}
+
+
+/// Lower bound in the array with LowerBound(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+std::size_t LowerBound(const DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                       const Type& element) noexcept {
+    return LowerBound(array.span(), element);
+}
+
+
 /**
  * @brief Performs a binary search for the given element.
  *
  * Requires the array to be sorted in non-decreasing (ascending) order.
- * Returns the index of the first position where element could be inserted
- * without violating the order among equals (lower_bound semantics).
+ * Returns the index of the first occurrence of the element, found with the
+ * branchless LowerBound().
  *
  * Note for float/double: Arrays containing NaN are unsupported for ordering;
  * results are unspecified.
  *
- * @param array The array to search in.
+ * @param range The range to search in.
  * @param element The element to search for.
- * @return The index of the found element, or size_ if not found.
+ * @return The index of the found element, or size() if not found.
  *
  * @par Complexity
  * - O(log n) time.
  * - O(1) space.
  */
 template <typename Type>
-std::size_t BinarySearch(const DynamicArray<Type>& array,
-                         const Type& element) noexcept {
-    // left: inclusive lower bound, right: exclusive upper bound
-    std::size_t left = 0;
-    std::size_t right = array.size();
+std::size_t BinarySearch(const std::span<Type> range,
+                         const std::type_identity_t<Type>& element) noexcept {
+    const std::size_t index = LowerBound(range, element);
+    if (index < range.size() && range[index] == element)
+        return index;
 
-    while (left < right) {
-        std::size_t middle = left + (right - left) / 2;
-        if (array[middle] < element)
-            left = middle + 1;
-        else
-            right = middle;
+    return range.size();
+}
+
+
+/// Binary search over the array with BinarySearch(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+std::size_t BinarySearch(
+    const DynamicArray<Type, Allocator, GrowthPolicy>& array,
+    const Type& element) noexcept {
+    return BinarySearch(array.span(), element);
+}
+
+
+/*** Reductions ***/
+
+
+/**
+ * @brief Returns the smallest element of a non-empty range.
+ *
+ * Ranges of integers, float and double are reduced with
+ * data_structs::simd::minimum(); otherwise the first of several smallest
+ * elements is returned.
+ *
+ * Note for float/double: Ranges containing NaN are unsupported; results are
+ * unspecified.
+ *
+ * @param range The range to reduce.
+ * @return A copy of the smallest element.
+ *
+ * @throws std::invalid_argument If the range is empty.
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+std::remove_cv_t<Type> Min(const std::span<Type> range) {
+    if (range.empty())
+        throw std::invalid_argument("Min of an empty range");
+
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>) {
+        return simd::minimum<Value>(range.data(), range.size());
+    } else {
+        const Type* smallest = &range[0];
+        for (const Type& value : range)
+            if (value < *smallest)
+                smallest = &value;
+        return *smallest;
+    }
+}
+
+
+/// Smallest element of the array with Min(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type Min(const DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    return Min(array.span());
+}
+
+
+/// Returns the largest element of a non-empty range; see Min(std::span).
+template <typename Type>
+std::remove_cv_t<Type> Max(const std::span<Type> range) {
+    if (range.empty())
+        throw std::invalid_argument("Max of an empty range");
+
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>) {
+        return simd::maximum<Value>(range.data(), range.size());
+    } else {
+        const Type* largest = &range[0];
+        for (const Type& value : range)
+            if (*largest < value)
+                largest = &value;
+        return *largest;
+    }
+}
+
+
+/// Largest element of the array with Max(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type Max(const DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    return Max(array.span());
+}
+
+
+/**
+ * @brief Returns the sum of the elements of the range, Type{} if it is
+ * empty.
+ *
+ * Ranges of integers, float and double are reduced with
+ * data_structs::simd::sum(): integer sums wrap around modulo 2^bits, and
+ * floating-point sums are accumulated in interleaved partial sums, so their
+ * rounding differs from a left-to-right loop. Other types are added left to
+ * right with operator+=.
+ *
+ * @param range The range to reduce.
+ * @return The sum of the elements.
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+std::remove_cv_t<Type> Sum(const std::span<Type> range) {
+    using Value = std::remove_cv_t<Type>;
+    if constexpr (simd::IS_VECTORIZABLE<Value>) {
+        return simd::sum<Value>(range.data(), range.size());
+    } else {
+        Value total{};
+        for (const Type& value : range)
+            total += value;
+        return total;
     }
+}
 
-    // left is the first index not less than element
-    if (left < array.size() && array[left] == element)
-        return left;
 
-    return array.size();
+/// Sum of the elements of the array with Sum(std::span).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type Sum(const DynamicArray<Type, Allocator, GrowthPolicy>& array) {
+    return Sum(array.span());
 }
 
 } // namespace algo
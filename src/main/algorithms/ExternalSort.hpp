@@ -0,0 +1,491 @@
+#ifndef EXTERNAL_SORT_HPP
+#define EXTERNAL_SORT_HPP
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <DynamicArrayAlgorithms.hpp>
+#include <MinHeap.hpp>
+#include <ThreadPool.hpp>
+
+
+namespace algo {
+
+// External merge sort for files of raw, trivially copyable elements that do
+// not fit in memory. The input is read in chunks sized by a memory budget;
+// each chunk is sorted in memory by one of the existing kernels and spilled
+// to a temporary run file, and the runs are then merged through a MinHeap.
+// All file I/O happens on a dedicated thread: chunks and run blocks are read
+// ahead and output blocks written behind, so the disk stays busy while the
+// calling thread sorts and merges.
+
+
+/// Tuning knobs for ExternalSort().
+struct ExternalSortOptions {
+    /// Bytes of element buffers the sort may hold at once.
+    std::size_t memory_budget = std::size_t{256} << 20;
+
+    /// Directory for the run files; empty means the system temp directory.
+    std::filesystem::path temp_directory;
+
+    /// Most runs merged in one pass; more runs are merged in several passes.
+    std::size_t max_fan_in = 64;
+};
+
+
+/// Closes a std::FILE when its owner goes out of scope.
+struct FileCloser {
+    void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+};
+
+using FileHandle = std::unique_ptr<std::FILE, FileCloser>;
+
+
+[[noreturn]] inline void throwFileError(const std::string& operation,
+                                        const std::filesystem::path& path) {
+    throw std::system_error(errno, std::generic_category(),
+                            operation + " " + path.string());
+}
+
+
+inline FileHandle openFile(const std::filesystem::path& path,
+                           const char* mode) {
+    FileHandle file(std::fopen(path.c_str(), mode));
+    if (!file)
+        throwFileError("Cannot open", path);
+    return file;
+}
+
+
+/// Reads up to `count` elements; fewer are returned only at the end of file.
+template <typename Type>
+std::size_t readElements(std::FILE* file, Type* target,
+                         const std::size_t count) {
+    const std::size_t read = std::fread(target, sizeof(Type), count, file);
+    if (read < count && std::ferror(file))
+        throw std::system_error(errno, std::generic_category(), "fread");
+    return read;
+}
+
+
+template <typename Type>
+void writeElements(std::FILE* file, const Type* source,
+                   const std::size_t count) {
+    if (std::fwrite(source, sizeof(Type), count, file) != count)
+        throw std::system_error(errno, std::generic_category(), "fwrite");
+}
+
+
+/**
+ * @brief Temporary run files of one external sort.
+ *
+ * Names are unique per instance; every file still listed is removed when
+ * the set is destroyed, so an aborted sort leaves nothing behind.
+ */
+class RunFiles {
+  public:
+    explicit RunFiles(std::filesystem::path directory)
+        : directory_(directory.empty() ? std::filesystem::temp_directory_path()
+                                       : std::move(directory)),
+          prefix_("external_sort_" + std::to_string(std::random_device{}()) +
+                  "_") {}
+
+    RunFiles(const RunFiles&) = delete;
+    RunFiles& operator=(const RunFiles&) = delete;
+
+    ~RunFiles() {
+        std::error_code ignored;
+        for (const std::filesystem::path& path : paths_)
+            std::filesystem::remove(path, ignored);
+    }
+
+
+    /// Name for a new run file, removed with the set.
+    std::filesystem::path create() {
+        std::filesystem::path path;
+        do {
+            path = directory_ /
+                   (prefix_ + std::to_string(counter_++) + ".run");
+        } while (std::filesystem::exists(path));
+        paths_.push_back(path);
+        return path;
+    }
+
+
+    /// Removes a run that has been merged.
+    void remove(const std::filesystem::path& path) {
+        std::filesystem::remove(path);
+        std::erase(paths_, path);
+    }
+
+  private:
+    std::filesystem::path directory_;
+    std::string prefix_;
+    std::size_t counter_ = 0;
+    std::vector<std::filesystem::path> paths_;
+};
+
+
+/**
+ * @brief Sequential reader of a run file with one block of read-ahead.
+ *
+ * While the caller consumes one block, the next one is being read on the
+ * I/O pool into a second buffer.
+ */
+template <typename Type>
+class RunReader {
+  public:
+    RunReader(const std::filesystem::path& path, const std::size_t block,
+              ThreadPool& io)
+        : file_(openFile(path, "rb")), block_(block), io_(io),
+          first_(block), second_(block), current_(first_.data()),
+          next_(second_.data()) {
+        readAhead();
+    }
+
+    RunReader(const RunReader&) = delete;
+    RunReader& operator=(const RunReader&) = delete;
+
+    /// Waits for the outstanding read, which still uses the buffers.
+    ~RunReader() {
+        if (pending_.valid())
+            pending_.wait();
+    }
+
+
+    /// Moves the next element into `out`; false once the run is exhausted.
+    bool next(Type& out) {
+        if (position_ == available_ && !refill())
+            return false;
+        out = current_[position_++];
+        return true;
+    }
+
+  private:
+    void readAhead() {
+        pending_ = io_.submit([file = file_.get(), target = next_,
+                               count = block_] {
+            return readElements(file, target, count);
+        });
+    }
+
+
+    bool refill() {
+        if (!pending_.valid())
+            return false;
+
+        available_ = pending_.get();
+        position_ = 0;
+        std::swap(current_, next_);
+        if (available_ == 0)
+            return false;
+
+        readAhead();
+        return true;
+    }
+
+
+    FileHandle file_;
+    std::size_t block_;
+    ThreadPool& io_;
+    ScratchBuffer<Type> first_;
+    ScratchBuffer<Type> second_;
+    Type* current_;
+    Type* next_;
+    std::size_t position_ = 0;
+    std::size_t available_ = 0;
+    std::future<std::size_t> pending_;
+};
+
+
+/**
+ * @brief Sequential writer of a file with one block of write-behind.
+ *
+ * A full block is handed to the I/O pool while the caller fills the second
+ * buffer.
+ */
+template <typename Type>
+class RunWriter {
+  public:
+    RunWriter(const std::filesystem::path& path, const std::size_t block,
+              ThreadPool& io)
+        : file_(openFile(path, "wb")), path_(path), block_(block), io_(io),
+          first_(block), second_(block), current_(first_.data()),
+          next_(second_.data()) {}
+
+    RunWriter(const RunWriter&) = delete;
+    RunWriter& operator=(const RunWriter&) = delete;
+
+    /// Waits for the outstanding write, which still uses the buffers.
+    ~RunWriter() {
+        if (pending_.valid())
+            pending_.wait();
+    }
+
+
+    void push(const Type& element) {
+        current_[fill_++] = element;
+        if (fill_ == block_)
+            flush();
+    }
+
+
+    /// Writes the last block and closes the file.
+    void finish() {
+        flush();
+        if (pending_.valid())
+            pending_.get();
+        if (std::fclose(file_.release()) != 0)
+            throwFileError("Cannot close", path_);
+    }
+
+  private:
+    void flush() {
+        if (fill_ == 0)
+            return;
+        if (pending_.valid())
+            pending_.get();
+
+        pending_ = io_.submit([file = file_.get(), source = current_,
+                               count = fill_] {
+            writeElements(file, source, count);
+        });
+        std::swap(current_, next_);
+        fill_ = 0;
+    }
+
+
+    FileHandle file_;
+    std::filesystem::path path_;
+    std::size_t block_;
+    ThreadPool& io_;
+    ScratchBuffer<Type> first_;
+    ScratchBuffer<Type> second_;
+    Type* current_;
+    Type* next_;
+    std::size_t fill_ = 0;
+    std::future<void> pending_;
+};
+
+
+/**
+ * @brief Reads `input` chunk by chunk, sorts every chunk with `sort` and
+ * writes it to a new run file.
+ *
+ * Three chunk buffers rotate: while one is sorted, the next chunk is read
+ * into the second and the previous run is written from the third.
+ *
+ * @return The run files, in input order.
+ */
+template <typename Type, typename Sort>
+std::vector<std::filesystem::path>
+makeSortedRuns(const std::filesystem::path& input, const std::size_t chunk,
+               Sort& sort, RunFiles& run_files) {
+    std::vector<std::filesystem::path> runs;
+    const FileHandle file = openFile(input, "rb");
+    ScratchBuffer<Type> buffers[] = {ScratchBuffer<Type>(chunk),
+                                     ScratchBuffer<Type>(chunk),
+                                     ScratchBuffer<Type>(chunk)};
+
+    // Declared after the buffers: on an exception the pool is destroyed
+    // first, finishing the queued reads and writes while they still exist
+    ThreadPool io(1);
+
+    const auto readChunk = [&](Type* target) {
+        return io.submit([source = file.get(), target, chunk] {
+            return readElements(source, target, chunk);
+        });
+    };
+
+    std::future<std::size_t> pending_read = readChunk(buffers[0].data());
+    std::future<void> pending_write;
+
+    for (std::size_t i = 0;; ++i) {
+        const std::size_t count = pending_read.get();
+        if (count == 0)
+            break;
+
+        // The buffer read next was last written two chunks ago, and that
+        // write has been waited for before the previous one was queued
+        Type* const data = buffers[i % 3].data();
+        pending_read = readChunk(buffers[(i + 1) % 3].data());
+
+        sort(std::span<Type>(data, count));
+
+        if (pending_write.valid())
+            pending_write.get();
+        runs.push_back(run_files.create());
+        pending_write = io.submit([path = runs.back(), data, count] {
+            const FileHandle run = openFile(path, "wb");
+            writeElements(run.get(), data, count);
+        });
+
+        if (count < chunk)
+            break;
+    }
+
+    if (pending_write.valid())
+        pending_write.get();
+    return runs;
+}
+
+
+/**
+ * @brief Merges the sorted `runs` into `output` through a MinHeap holding
+ * the head of every run.
+ *
+ * Equal elements are taken from the earlier run first, so the merge is
+ * stable.
+ */
+template <typename Type>
+void mergeRuns(const std::span<const std::filesystem::path> runs,
+               const std::filesystem::path& output, const std::size_t block) {
+    struct Head {
+        Type value;
+        std::size_t run;
+
+        bool operator<(const Head& other) const {
+            if (value < other.value)
+                return true;
+            if (other.value < value)
+                return false;
+            return run < other.run;
+        }
+
+        // Every run holds at most one head, so the run identifies it
+        bool operator==(const Head& other) const { return run == other.run; }
+    };
+
+    // Readers and the writer wait for their own I/O, so they may go first
+    ThreadPool io(1);
+    std::vector<std::unique_ptr<RunReader<Type>>> readers;
+    readers.reserve(runs.size());
+    RunWriter<Type> writer(output, block, io);
+    data_structs::MinHeap<Head> heap;
+
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        readers.push_back(
+            std::make_unique<RunReader<Type>>(runs[run], block, io));
+        Head head{Type{}, run};
+        if (readers.back()->next(head.value))
+            heap.insert(head);
+    }
+
+    while (!heap.isEmpty()) {
+        Head head = heap.extractRoot();
+        writer.push(head.value);
+        if (readers[head.run]->next(head.value))
+            heap.insert(head);
+    }
+
+    writer.finish();
+}
+
+
+/**
+ * @brief Sorts a file of raw `Type` elements that may be far larger than
+ * memory, writing the result to `output`.
+ *
+ * The input is read in chunks of a third of the memory budget (one chunk is
+ * sorted while the next is read and the previous one written); each chunk
+ * is sorted by `sort` and spilled to a run file in
+ * `options.temp_directory`. The runs are then merged at most
+ * `options.max_fan_in` at a time through a MinHeap, every run and the
+ * output getting two blocks of the budget for read-ahead and write-behind.
+ * If `sort` is stable the whole sort is stable.
+ *
+ * The file format is that of MappedDynamicArray: the elements' bytes, back
+ * to back, in native byte order. `output` may name the input file, which is
+ * read completely before the output is opened.
+ *
+ * @par Complexity
+ * - O(n log n) comparisons; the input is read and written once per merge
+ *   pass plus once for the runs.
+ * - O(memory_budget) memory, plus whatever `sort` allocates.
+ *
+ * @par Exception Safety
+ * - Basic: the run files are removed, `output` may be partially written and
+ *   the input is unchanged unless it is also the output.
+ *
+ * @param input File to sort.
+ * @param output File to write the sorted elements to.
+ * @param options Memory budget, temporary directory and merge fan-in.
+ * @param sort Called with a std::span<Type> of every chunk to sort it in
+ * place, e.g. a lambda around MergeSort or ParallelQuickSort.
+ *
+ * @throws std::invalid_argument If the input size is not a multiple of
+ * sizeof(Type).
+ * @throws std::system_error If a file cannot be opened, read or written.
+ * @throws std::bad_alloc If the buffers cannot be allocated.
+ */
+template <typename Type, typename Sort>
+void ExternalSort(const std::filesystem::path& input,
+                  const std::filesystem::path& output,
+                  const ExternalSortOptions& options, Sort sort) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "ExternalSort stores raw element bytes in files");
+    static_assert(std::is_default_constructible_v<Type>,
+                  "ExternalSort requires default constructible elements");
+
+    if (std::filesystem::file_size(input) % sizeof(Type) != 0)
+        throw std::invalid_argument(
+            "Input size is not a multiple of the element size");
+
+    const std::size_t budget = options.memory_budget / sizeof(Type);
+    const std::size_t fan_in = std::max<std::size_t>(options.max_fan_in, 2);
+    const std::size_t chunk = std::max<std::size_t>(budget / 3, 1);
+    const std::size_t block =
+        std::max<std::size_t>(budget / (2 * (fan_in + 1)), 1);
+
+    RunFiles run_files(options.temp_directory);
+    std::vector<std::filesystem::path> runs =
+        makeSortedRuns<Type>(input, chunk, sort, run_files);
+
+    // Intermediate passes merge consecutive groups, keeping the run order
+    while (runs.size() > fan_in) {
+        std::vector<std::filesystem::path> merged;
+        for (std::size_t first = 0; first < runs.size(); first += fan_in) {
+            const std::span<const std::filesystem::path> group(
+                runs.data() + first, std::min(fan_in, runs.size() - first));
+            merged.push_back(run_files.create());
+            mergeRuns<Type>(group, merged.back(), block);
+            for (const std::filesystem::path& run : group)
+                run_files.remove(run);
+        }
+        runs = std::move(merged);
+    }
+
+    mergeRuns<Type>(runs, output, block);
+}
+
+
+/**
+ * @brief Sorts a file of raw `Type` elements with
+ * ExternalSort(input, output, options, sort), sorting the chunks with
+ * QuickSort.
+ */
+template <typename Type>
+void ExternalSort(const std::filesystem::path& input,
+                  const std::filesystem::path& output,
+                  const ExternalSortOptions& options = {}) {
+    ExternalSort<Type>(input, output, options,
+                       [](const std::span<Type> chunk) { QuickSort(chunk); });
+}
+
+} // namespace algo
+
+#endif // EXTERNAL_SORT_HPP
@@ -0,0 +1,393 @@
+#ifndef PARALLEL_ALGORITHMS_HPP
+#define PARALLEL_ALGORITHMS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <DynamicArray.hpp>
+#include <DynamicArrayAlgorithms.hpp>
+#include <ThreadPool.hpp>
+
+
+namespace algo {
+
+// Parallel variants of the sorts in DynamicArrayAlgorithms.hpp. Recursive
+// halves are forked onto a work-stealing ThreadPool; below
+// PARALLEL_SORT_CUTOFF elements the sequential kernels take over, so the
+// per-task overhead stays negligible.
+
+/// Ranges of at most this many elements are sorted sequentially.
+inline constexpr std::size_t PARALLEL_SORT_CUTOFF = std::size_t{1} << 14;
+
+/// Merges producing at most this many elements run sequentially; larger ones
+/// are split into chunks of this size by co-ranking.
+inline constexpr std::size_t PARALLEL_MERGE_CHUNK = std::size_t{1} << 15;
+
+
+/**
+ * @brief Co-rank of output position k in the stable merge of a[0..a_size)
+ * and b[0..b_size).
+ *
+ * Returns the number of elements i taken from `a` among the first k merged
+ * elements (the other k - i come from `b`). Ties are resolved in favour of
+ * `a`, matching a stable merge. Splitting the output at several positions
+ * this way yields independent sub-merges.
+ *
+ * @par Complexity
+ * - O(log min(k, a_size)) comparisons.
+ */
+template <typename Type>
+std::size_t coRank(const std::size_t k, const Type* a, const std::size_t a_size,
+                   const Type* b, const std::size_t b_size) {
+    std::size_t low = k > b_size ? k - b_size : 0;
+    std::size_t high = std::min(k, a_size);
+
+    while (true) {
+        const std::size_t i = low + (high - low) / 2;
+        const std::size_t j = k - i;
+
+        if (i < a_size && j > 0 && !(b[j - 1] < a[i])) {
+            // a[i] <= b[j - 1]: a[i] belongs among the first k, take more
+            low = i + 1;
+        } else if (i > 0 && j < b_size && b[j] < a[i - 1]) {
+            // b[j] < a[i - 1]: a[i - 1] does not, take fewer
+            high = i - 1;
+        } else {
+            return i;
+        }
+    }
+}
+
+
+/**
+ * @brief Stable sequential merge of a[0..a_size) and b[0..b_size) into
+ * `out`, moving the elements.
+ *
+ * `out` must hold live objects and must not overlap the inputs.
+ */
+template <typename Type>
+void moveMerge(Type* a, const std::size_t a_size, Type* b,
+               const std::size_t b_size, Type* out) {
+    Type* const a_end = a + a_size;
+    Type* const b_end = b + b_size;
+
+    while (a != a_end && b != b_end) {
+        if (*b < *a)
+            *out++ = std::move(*b++);
+        else
+            *out++ = std::move(*a++);
+    }
+
+    out = std::move(a, a_end, out);
+    std::move(b, b_end, out);
+}
+
+
+/**
+ * @brief Stable merge of a[0..a_size) and b[0..b_size) into `out`, split
+ * into chunks of PARALLEL_MERGE_CHUNK output elements.
+ *
+ * The boundaries of every chunk are located with coRank() up front, then the
+ * chunks are merged independently by the pool.
+ */
+template <typename Type>
+void parallelMoveMerge(ThreadPool& pool, Type* a, const std::size_t a_size,
+                       Type* b, const std::size_t b_size, Type* out) {
+    const std::size_t total = a_size + b_size;
+    if (total <= PARALLEL_MERGE_CHUNK) {
+        moveMerge(a, a_size, b, b_size, out);
+        return;
+    }
+
+    const std::size_t chunks =
+        (total + PARALLEL_MERGE_CHUNK - 1) / PARALLEL_MERGE_CHUNK;
+
+    // All split points are found before any element is moved: a chunk's
+    // co-rank search reads elements that neighbouring chunks move
+    DynamicArray<std::size_t> a_splits;
+    a_splits.reserve(chunks + 1);
+    for (std::size_t chunk = 0; chunk <= chunks; ++chunk)
+        a_splits.addLast(coRank(chunk * total / chunks, a, a_size, b, b_size));
+
+    pool.parallelFor(chunks, [&](const std::size_t chunk) {
+        const std::size_t first = chunk * total / chunks;
+        const std::size_t last = (chunk + 1) * total / chunks;
+        const std::size_t a_first = a_splits.getUnchecked(chunk);
+        const std::size_t a_last = a_splits.getUnchecked(chunk + 1);
+
+        moveMerge(a + a_first, a_last - a_first, b + (first - a_first),
+                  (last - a_last) - (first - a_first), out + first);
+    });
+}
+
+
+/**
+ * @brief Parallel merge sort of src[0..size) with a ping-pong buffer.
+ *
+ * Both halves are sorted (in parallel) into the buffer opposite to the
+ * target, then merged into the target with parallelMoveMerge(), so no level
+ * copies its result back. Both buffers must hold live objects.
+ *
+ * @param pool Pool running the forked halves and merge chunks.
+ * @param src The range to sort.
+ * @param dst Buffer of `size` elements used alongside `src`.
+ * @param size Number of elements.
+ * @param into_dst Whether the sorted result must end up in `dst` (true) or
+ * in `src` (false).
+ */
+template <typename Type>
+void parallelMergeSortInto(ThreadPool& pool, Type* src, Type* dst,
+                           const std::size_t size, const bool into_dst) {
+    if (size <= PARALLEL_SORT_CUTOFF) {
+        MergeSort(std::span<Type>(src, size));
+        if (into_dst)
+            std::move(src, src + size, dst);
+        return;
+    }
+
+    const std::size_t half = size / 2;
+    pool.parallelInvoke(
+        [&] { parallelMergeSortInto(pool, src, dst, half, !into_dst); },
+        [&] {
+            parallelMergeSortInto(pool, src + half, dst + half, size - half,
+                                  !into_dst);
+        });
+
+    Type* from = into_dst ? src : dst;
+    Type* to = into_dst ? dst : src;
+    parallelMoveMerge(pool, from, half, from + half, size - half, to);
+}
+
+
+/**
+ * @brief Introsort whose two partitions are forked onto the pool while they
+ * are larger than PARALLEL_SORT_CUTOFF.
+ *
+ * @param pool Pool running the forked partitions.
+ * @param data Pointer to the first element of the range being sorted.
+ * @param left First index of the sub-range (inclusive).
+ * @param right Last index of the sub-range (exclusive).
+ * @param depth_limit Remaining partitioning depth before falling back to
+ * heapsort.
+ */
+template <typename Type>
+void parallelIntroSort(ThreadPool& pool, Type* data, const std::size_t left,
+                       const std::size_t right, std::size_t depth_limit) {
+    if (right - left <= PARALLEL_SORT_CUTOFF) {
+        introSortLoop(data, left, right, depth_limit);
+        return;
+    }
+    if (depth_limit == 0) {
+        heapSortRange(data, left, right);
+        return;
+    }
+    --depth_limit;
+
+    selectPivot(data, left, right);
+    const std::size_t cut = partition(data, left, right);
+
+    pool.parallelInvoke(
+        [&] { parallelIntroSort(pool, data, left, cut, depth_limit); },
+        [&] { parallelIntroSort(pool, data, cut, right, depth_limit); });
+}
+
+
+/// Number of threads to use when the caller passes 0: one per hardware
+/// thread, at least one.
+inline std::size_t defaultThreadCount() noexcept {
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+
+/*** Parallel Sorting Algorithms ***/
+
+
+/**
+ * @brief Sorts the range in ascending (non-decreasing) order with a parallel
+ * Merge Sort running on `pool`.
+ *
+ * The range is moved into a scratch buffer of n elements, then the halves are
+ * sorted recursively as pool tasks (sequential MergeSort below
+ * PARALLEL_SORT_CUTOFF elements) and merged back and forth between the two
+ * buffers. Merges larger than PARALLEL_MERGE_CHUNK are split by co-ranking
+ * and merged in parallel as well, so the final merges do not serialize the
+ * sort. Stable. Only `operator<` is used.
+ *
+ * Types whose move constructor may throw are sorted by the sequential
+ * MergeSort instead.
+ *
+ * @par Complexity
+ * - O(n log n) work; O(log^2 n) span apart from the sequential leaves.
+ * - O(n) additional space for the scratch buffer.
+ *
+ * @par Exception Safety
+ * - Basic: if a comparison or assignment throws, the exception is rethrown
+ *   once every task has finished, and the elements are valid but
+ *   unspecified.
+ *
+ * @param range The range to sort.
+ * @param pool Pool whose workers (and the calling thread) do the work.
+ *
+ * @throws std::bad_alloc If the scratch buffer cannot be allocated.
+ */
+template <typename Type>
+void ParallelMergeSort(const std::span<Type> range, ThreadPool& pool) {
+    const std::size_t size = range.size();
+    if constexpr (!std::is_nothrow_move_constructible_v<Type>) {
+        MergeSort(range);
+        return;
+    }
+    if (size <= PARALLEL_SORT_CUTOFF) {
+        MergeSort(range);
+        return;
+    }
+
+    Type* data = range.data();
+    ScratchBuffer<Type> scratch(size);
+    Type* buffer = scratch.data();
+
+    const std::size_t chunks =
+        (size + PARALLEL_MERGE_CHUNK - 1) / PARALLEL_MERGE_CHUNK;
+    const auto chunkBounds = [&](const std::size_t chunk) {
+        return std::pair{chunk * size / chunks, (chunk + 1) * size / chunks};
+    };
+
+    pool.parallelFor(chunks, [&](const std::size_t chunk) {
+        const auto [first, last] = chunkBounds(chunk);
+        std::uninitialized_move(data + first, data + last, buffer + first);
+    });
+
+    try {
+        parallelMergeSortInto(pool, buffer, data, size, true);
+    } catch (...) {
+        std::destroy(buffer, buffer + size);
+        throw;
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        pool.parallelFor(chunks, [&](const std::size_t chunk) {
+            const auto [first, last] = chunkBounds(chunk);
+            std::destroy(buffer + first, buffer + last);
+        });
+    }
+}
+
+
+/**
+ * @brief Sorts the range with ParallelMergeSort(std::span, ThreadPool&) on a
+ * temporary pool.
+ *
+ * @param range The range to sort.
+ * @param thread_count Total number of threads, including the calling one;
+ * 0 means one per hardware thread. With 1, the sequential MergeSort is used.
+ */
+template <typename Type>
+void ParallelMergeSort(const std::span<Type> range,
+                       std::size_t thread_count = 0) {
+    if (thread_count == 0)
+        thread_count = defaultThreadCount();
+    if (thread_count == 1 || range.size() <= PARALLEL_SORT_CUTOFF) {
+        MergeSort(range);
+        return;
+    }
+
+    ThreadPool pool(thread_count - 1);
+    ParallelMergeSort(range, pool);
+}
+
+
+/// Sorts the array with ParallelMergeSort(std::span, ThreadPool&).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ParallelMergeSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                       ThreadPool& pool) {
+    ParallelMergeSort(array.span(), pool);
+}
+
+
+/// Sorts the array with ParallelMergeSort(std::span, std::size_t).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ParallelMergeSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                       const std::size_t thread_count = 0) {
+    ParallelMergeSort(array.span(), thread_count);
+}
+
+
+/**
+ * @brief Sorts the range in ascending (non-decreasing) order with a parallel
+ * Quick Sort (introsort) running on `pool`.
+ *
+ * Same introsort as QuickSort(), except that both partitions of a range
+ * larger than PARALLEL_SORT_CUTOFF are sorted as separate pool tasks. The
+ * partitioning itself is sequential, so the first levels bound the speedup
+ * more than in ParallelMergeSort; in exchange no extra memory is used. Not
+ * stable. Only `operator<` is used.
+ *
+ * @par Complexity
+ * - O(n log n) average and worst-case work; O(n) span.
+ * - O(log n) stack space per thread.
+ *
+ * @param range The range to sort.
+ * @param pool Pool whose workers (and the calling thread) do the work.
+ */
+template <typename Type>
+void ParallelQuickSort(const std::span<Type> range, ThreadPool& pool) {
+    if (range.size() <= PARALLEL_SORT_CUTOFF) {
+        QuickSort(range);
+        return;
+    }
+
+    std::size_t depth_limit = 0;
+    for (std::size_t n = range.size(); n > 1; n >>= 1)
+        depth_limit += 2;
+
+    parallelIntroSort(pool, range.data(), 0, range.size(), depth_limit);
+}
+
+
+/**
+ * @brief Sorts the range with ParallelQuickSort(std::span, ThreadPool&) on a
+ * temporary pool.
+ *
+ * @param range The range to sort.
+ * @param thread_count Total number of threads, including the calling one;
+ * 0 means one per hardware thread. With 1, the sequential QuickSort is used.
+ */
+template <typename Type>
+void ParallelQuickSort(const std::span<Type> range,
+                       std::size_t thread_count = 0) {
+    if (thread_count == 0)
+        thread_count = defaultThreadCount();
+    if (thread_count == 1 || range.size() <= PARALLEL_SORT_CUTOFF) {
+        QuickSort(range);
+        return;
+    }
+
+    ThreadPool pool(thread_count - 1);
+    ParallelQuickSort(range, pool);
+}
+
+
+/// Sorts the array with ParallelQuickSort(std::span, ThreadPool&).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ParallelQuickSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                       ThreadPool& pool) {
+    ParallelQuickSort(array.span(), pool);
+}
+
+
+/// Sorts the array with ParallelQuickSort(std::span, std::size_t).
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ParallelQuickSort(DynamicArray<Type, Allocator, GrowthPolicy>& array,
+                       const std::size_t thread_count = 0) {
+    ParallelQuickSort(array.span(), thread_count);
+}
+
+} // namespace algo
+
+#endif // PARALLEL_ALGORITHMS_HPP
@@ -0,0 +1,317 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace algo {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size work-stealing thread pool for fork-join parallelism.
+ *
+ * Every worker owns a task deque: tasks spawned by a worker are pushed to the
+ * back of its own deque and popped back LIFO (hot in cache), while idle
+ * workers steal from the front of other deques, which holds the oldest and
+ * therefore largest pieces of a recursive computation. Tasks submitted from
+ * threads outside the pool go to a shared injection deque.
+ *
+ * A thread waiting for a forked task (parallelInvoke(), parallelFor()) does
+ * not block: it keeps running queued tasks until its own has finished, so
+ * arbitrarily deep fork-join recursion never deadlocks and never needs more
+ * threads than the pool has.
+ *
+ * Idle workers sleep on a condition variable and are woken when work is
+ * pushed.
+ */
+class ThreadPool {
+  public:
+    /**
+     * @brief Start a pool with `thread_count` worker threads.
+     *
+     * A pool of zero workers is valid: forked work then runs on the thread
+     * that waits for it.
+     *
+     * @param thread_count Number of worker threads to start.
+     *
+     * @throws std::system_error If a thread cannot be started.
+     */
+    explicit ThreadPool(
+        const std::size_t thread_count = std::thread::hardware_concurrency())
+        : worker_count_(thread_count) {
+        queues_.reserve(worker_count_ + 1);
+        for (std::size_t i = 0; i <= worker_count_; ++i)
+            queues_.push_back(std::make_unique<TaskQueue>());
+
+        threads_.reserve(worker_count_);
+        try {
+            for (std::size_t i = 0; i < worker_count_; ++i)
+                threads_.emplace_back([this, i] { workerLoop(i); });
+        } catch (...) {
+            shutdown();
+            throw;
+        }
+    }
+
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+
+    /// Runs every queued task, then joins the workers.
+    ~ThreadPool() { shutdown(); }
+
+
+    /// Number of worker threads.
+    [[nodiscard]] std::size_t size() const noexcept { return worker_count_; }
+
+
+    /**
+     * @brief Queue `function` for execution and return a future for its
+     * result.
+     *
+     * An exception thrown by `function` is stored in the future.
+     *
+     * @param function Callable taking no arguments.
+     * @return Future that becomes ready when `function` has run.
+     */
+    template <typename Function>
+    std::future<std::invoke_result_t<std::decay_t<Function>>>
+    submit(Function&& function) {
+        using Result = std::invoke_result_t<std::decay_t<Function>>;
+
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            std::forward<Function>(function));
+        std::future<Result> result = task->get_future();
+        push([task] { (*task)(); });
+        return result;
+    }
+
+
+    /**
+     * @brief Run `first` and `second`, potentially in parallel, and return
+     * when both have finished.
+     *
+     * `second` is pushed onto the calling thread's deque, where an idle
+     * worker can steal it, while the calling thread runs `first`. If nobody
+     * stole `second`, the calling thread runs it itself.
+     *
+     * @par Exception Safety
+     * - If either callable throws, the other one still runs to completion,
+     *   then the first exception (that of `first` if both throw) is
+     *   rethrown.
+     */
+    template <typename First, typename Second>
+    void parallelInvoke(First&& first, Second&& second) {
+        std::atomic<bool> done{false};
+        std::exception_ptr second_error;
+
+        push([&second, &done, &second_error] {
+            try {
+                second();
+            } catch (...) {
+                second_error = std::current_exception();
+            }
+            done.store(true, std::memory_order_release);
+        });
+
+        std::exception_ptr first_error;
+        try {
+            first();
+        } catch (...) {
+            first_error = std::current_exception();
+        }
+
+        // Help with queued work instead of blocking
+        const std::size_t self = currentQueue();
+        while (!done.load(std::memory_order_acquire))
+            if (!runOneTask(self))
+                std::this_thread::yield();
+
+        if (first_error)
+            std::rethrow_exception(first_error);
+        if (second_error)
+            std::rethrow_exception(second_error);
+    }
+
+
+    /**
+     * @brief Call function(i) for every i in [0, count), potentially in
+     * parallel, and return when all calls have finished.
+     *
+     * The index range is split recursively with parallelInvoke(), so the
+     * work is spread by stealing rather than by a central queue.
+     *
+     * @par Exception Safety
+     * - Every call runs even if some throw; one of the exceptions is
+     *   rethrown afterwards.
+     */
+    template <typename Function>
+    void parallelFor(const std::size_t count, Function&& function) {
+        if (count != 0)
+            parallelForRange(0, count, function);
+    }
+
+  private:
+    using Task = std::function<void()>;
+
+    /// A worker's task deque, guarded by its own mutex.
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::size_t worker_count_;
+
+    /// queues_[i] belongs to worker i; queues_[worker_count_] is the
+    /// injection queue used by threads outside the pool.
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    /// Tasks pushed but not yet taken by any thread.
+    std::atomic<std::size_t> pending_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    bool stopping_ = false;
+
+    /// The pool the current thread works for, and its queue index there.
+    static inline thread_local const ThreadPool* current_pool_ = nullptr;
+    static inline thread_local std::size_t current_index_ = 0;
+
+
+    /// Index of the queue the calling thread pushes to and pops from.
+    [[nodiscard]] std::size_t currentQueue() const noexcept {
+        return current_pool_ == this ? current_index_ : worker_count_;
+    }
+
+
+    /// Push a task onto the calling thread's queue and wake a sleeper.
+    void push(Task task) {
+        // Counted before it becomes visible, so the count never underflows
+        pending_.fetch_add(1, std::memory_order_seq_cst);
+
+        TaskQueue& queue = *queues_[currentQueue()];
+        try {
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        } catch (...) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+
+        // Taking the lock orders this wake-up after a sleeper's predicate
+        // check, so the notification cannot be lost
+        { std::lock_guard lock(sleep_mutex_); }
+        sleep_condition_.notify_one();
+    }
+
+
+    /**
+     * @brief Take one task, preferring the back of the own queue and then
+     * the front of the others (starting after the own one), and run it.
+     *
+     * @return false if every queue was empty.
+     */
+    bool runOneTask(const std::size_t self) {
+        Task task;
+        if (!popBack(*queues_[self], task)) {
+            const std::size_t queue_count = queues_.size();
+            bool stolen = false;
+            for (std::size_t k = 1; k < queue_count && !stolen; ++k)
+                stolen = popFront(*queues_[(self + k) % queue_count], task);
+            if (!stolen)
+                return false;
+        }
+
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+
+    static bool popBack(TaskQueue& queue, Task& task) {
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+
+    static bool popFront(TaskQueue& queue, Task& task) {
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+
+
+    void workerLoop(const std::size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        while (true) {
+            if (runOneTask(index))
+                continue;
+
+            std::unique_lock lock(sleep_mutex_);
+            sleep_condition_.wait(lock, [this] {
+                return stopping_ || pending_.load(std::memory_order_seq_cst);
+            });
+            if (stopping_ && pending_.load(std::memory_order_seq_cst) == 0)
+                return;
+        }
+    }
+
+
+    /// Let the workers drain the queues, then join them.
+    void shutdown() noexcept {
+        {
+            std::lock_guard lock(sleep_mutex_);
+            stopping_ = true;
+        }
+        sleep_condition_.notify_all();
+
+        for (std::thread& thread : threads_)
+            if (thread.joinable())
+                thread.join();
+
+        // Without workers, queued tasks are run here
+        while (runOneTask(worker_count_)) {
+        }
+    }
+
+
+    template <typename Function>
+    void parallelForRange(const std::size_t begin, const std::size_t end,
+                          Function& function) {
+        if (end - begin == 1) {
+            function(begin);
+            return;
+        }
+
+        const std::size_t mid = begin + (end - begin) / 2;
+        parallelInvoke([&] { parallelForRange(begin, mid, function); },
+                       [&] { parallelForRange(mid, end, function); });
+    }
+};
+
+} // namespace algo
+
+#endif // THREAD_POOL_HPP
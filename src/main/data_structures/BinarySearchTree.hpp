@@ -17,6 +17,7 @@ namespace data_structs {
  * N->right are > N->data. Equal values are ignored (no duplicate insert).
  *
  * @tparam Type Element type.
+ * @tparam Allocator Node allocator; see BinaryTree.
  *
  * @par Type requirements
  * - `Type` must be MoveConstructible or CopyConstructible (node storage).
@@ -38,8 +39,11 @@ namespace data_structs {
  *   construction/move/assign. Insert offers a strong guarantee (tree
  *   unchanged on failure).
  */
-template <typename Type>
-class BinarySearchTree : public BinaryTree<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class BinarySearchTree : public BinaryTree<Type, Allocator> {
+
+    using Base = BinaryTree<Type, Allocator>;
+
 
     /**
      * Recursively inserts an element into a binary search tree.
@@ -63,7 +67,7 @@ class BinarySearchTree : public BinaryTree<Type> {
                       "Element must be constructible into Type");
 
         if (node == nullptr) {
-            node = new Node<Type>(std::forward<U>(element));
+            node = this->createNode(std::forward<U>(element));
             node->parent = parent;
             ++this->size_;
             return;
@@ -102,7 +106,7 @@ class BinarySearchTree : public BinaryTree<Type> {
         } else {
             if (node->left == nullptr && node->right == nullptr) {
                 --this->size_;
-                delete node;
+                this->destroyNode(node);
                 node = nullptr;
             } else if (node->left == nullptr) {
                 --this->size_;
@@ -110,14 +114,14 @@ class BinarySearchTree : public BinaryTree<Type> {
                 node = node->right;
                 if (node)
                     node->parent = temp->parent;
-                delete temp;
+                this->destroyNode(temp);
             } else if (node->right == nullptr) {
                 --this->size_;
                 Node<Type>* temp = node;
                 node = node->left;
                 if (node)
                     node->parent = temp->parent;
-                delete temp;
+                this->destroyNode(temp);
             } else {
                 Node<Type>* temp = findMinNode(node->right);
                 node->data = std::move(temp->data);
@@ -242,9 +246,20 @@ class BinarySearchTree : public BinaryTree<Type> {
     }
 
 
+  protected:
+    [[nodiscard]]
+    SerializedKind serializedKind() const noexcept override {
+        return SerializedKind::BINARY_SEARCH_TREE;
+    }
+
+
   public:
     /// Default constructor
-    BinarySearchTree() : BinaryTree<Type>() {}
+    BinarySearchTree() : Base() {}
+
+    /// Creates an empty tree whose nodes come from `allocator`.
+    explicit BinarySearchTree(const Allocator& allocator) noexcept
+        : Base(allocator) {}
 
     /**
      * Constructor that initializes the binary search tree with an array of
@@ -257,29 +272,32 @@ class BinarySearchTree : public BinaryTree<Type> {
      * @param array Pointer to the array of elements to be inserted into the
      * binary search tree.
      * @param size The number of elements in the array.
+     * @param allocator Source of the tree's nodes.
      */
-    BinarySearchTree(const Type* array, const std::size_t size)
-        : BinaryTree<Type>() {
+    BinarySearchTree(const Type* array, const std::size_t size,
+                     const Allocator& allocator = Allocator())
+        : Base(allocator) {
         for (std::size_t i = 0; i < size; ++i)
             this->insert(array[i]);
     }
 
     /// Copy constructor
-    BinarySearchTree(const BinarySearchTree& other) : BinaryTree<Type>(other) {}
+    BinarySearchTree(const BinarySearchTree& other) : Base(other) {}
 
     /// Move constructor
     BinarySearchTree(BinarySearchTree&& other) noexcept
-        : BinaryTree<Type>(std::move(other)) {}
+        : Base(std::move(other)) {}
 
     /// Copy assignment operator
     BinarySearchTree& operator=(const BinarySearchTree& other) {
-        BinaryTree<Type>::operator=(other);
+        Base::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
-    BinarySearchTree& operator=(BinarySearchTree&& other) noexcept {
-        BinaryTree<Type>::operator=(std::move(other));
+    BinarySearchTree& operator=(BinarySearchTree&& other) noexcept(
+        Base::NOTHROW_MOVE_ASSIGNABLE) {
+        Base::operator=(std::move(other));
         return *this;
     }
 
@@ -408,9 +426,40 @@ class BinarySearchTree : public BinaryTree<Type> {
     }
 
 
+    /**
+     * @brief Read a tree written by serialize().
+     *
+     * The pre-order encoding restores the exact shape in O(n): nodes are
+     * linked where they were, without the O(h) descent of insert() per
+     * element. The ordering is verified once afterwards.
+     *
+     * @throws std::runtime_error If the data is not a serialized search tree
+     * of Type, is corrupt, or violates the BST invariant.
+     */
+    static BinarySearchTree deserialize(
+        std::istream& in, const Allocator& allocator = Allocator()) {
+        BinarySearchTree tree(allocator);
+        tree.readTree(in, SerializedKind::BINARY_SEARCH_TREE);
+        if (!tree.isValidBST())
+            throw std::runtime_error("Serialized tree is not a search tree");
+        return tree;
+    }
+
+
     ~BinarySearchTree() override = default;
 };
 
+
+namespace pmr {
+
+/// BinarySearchTree whose nodes come from a std::pmr::memory_resource.
+template <typename Type>
+using BinarySearchTree =
+    data_structs::BinarySearchTree<Type,
+                                   std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // BINARYSEARCHTREE_HPP
@@ -3,10 +3,14 @@
 
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "NodePool.hpp"
 #include "Queue.hpp"
 
 
@@ -49,6 +53,11 @@ struct Node {
  * as possible without being a heap or a search tree.
  *
  * @tparam Type Element type stored by the tree.
+ * @tparam Allocator std::allocator-compatible allocator. Nodes (also those
+ * of the derived search trees and heaps) live in a NodePool whose chunks
+ * come from it, so inserting and removing does not call the allocator once
+ * the tree has reached its working size. Propagation on copy and move
+ * follows std::allocator_traits.
  *
  * @par Semantics
  * - Equality/ordering between nodes is not defined by the tree; search APIs
@@ -62,22 +71,61 @@ struct Node {
  * - `insert` (level-order): O(n) in the worst case (queue traversal).
  * - `findNode` (DFS) / `findNodeLevelOrder` (BFS): O(n).
  * - `isCompleteTree`: O(n).
- * - `clear`: O(n).
+ * - `clear`: O(n); O(chunks) if `Type` is trivially destructible.
  *
  * @par Exception safety
  * - Most public operations propagate exceptions from `Type` (copy/move/compare)
  *   and allocations. See `recursiveCopyNode` for copy semantics.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class BinaryTree {
 
   protected:
+    using NodeTraits = std::allocator_traits<
+        typename NodePool<Node<Type>, Allocator>::NodeAllocator>;
+
+    /// Move assignment only throws when nodes must be rebuilt because the
+    /// allocators differ and do not propagate.
+    static constexpr bool NOTHROW_MOVE_ASSIGNABLE =
+        NodeTraits::propagate_on_container_move_assignment::value ||
+        NodeTraits::is_always_equal::value;
+
+    NodePool<Node<Type>, Allocator> pool_;
     Node<Type>* root_ = nullptr;
     std::size_t size_ = 0;
 
 
     /**
-     * Recursively copies a node and its subtree.
+     * Takes a node from the pool and constructs it from `element`.
+     * Strong: nothing leaks if the construction throws.
+     *
+     * @return The new, unlinked node.
+     */
+    template <typename U>
+    Node<Type>* createNode(U&& element) {
+        Node<Type>* node = pool_.allocate();
+        try {
+            ::new (static_cast<void*>(node))
+                Node<Type>(std::forward<U>(element));
+        } catch (...) {
+            pool_.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+
+    /// Destroys a node created by createNode and returns its storage to the
+    /// pool.
+    void destroyNode(Node<Type>* node) noexcept {
+        node->~Node<Type>();
+        pool_.deallocate(node);
+    }
+
+
+    /**
+     * Recursively copies a node and its subtree into nodes of this tree's
+     * pool. Passing a non-const subtree moves the elements instead.
      *
      * @param otherNode Pointer to the subtree root to copy (may be nullptr).
      * @param parent    Parent to set on the newly created node (may be
@@ -89,21 +137,29 @@ class BinaryTree {
      *
      * @par Exception safety
      * This implementation propagates exceptions from allocations and `Type`
-     * construction. If an exception is thrown mid-copy, already-allocated nodes
-     * in the partially built subtree are not reclaimed here (leak risk).
-     * For a strong guarantee, switch to an RAII/commit pattern (build the
-     * subtree with smart pointers and only release ownership on success).
+     * construction. If an exception is thrown mid-copy, the partially built
+     * subtree is released before the exception propagates.
      */
-    Node<Type>* recursiveCopyNode(const Node<Type>* otherNode,
+    template <typename SourceNode>
+    Node<Type>* recursiveCopyNode(SourceNode* otherNode,
                                   Node<Type>* parent = nullptr) {
         if (otherNode == nullptr)
             return nullptr;
 
-        auto* newNode = new Node<Type>(otherNode->data);
+        Node<Type>* newNode;
+        if constexpr (std::is_const_v<SourceNode>)
+            newNode = createNode(otherNode->data);
+        else
+            newNode = createNode(std::move(otherNode->data));
         newNode->parent = parent;
 
-        newNode->left = recursiveCopyNode(otherNode->left, newNode);
-        newNode->right = recursiveCopyNode(otherNode->right, newNode);
+        try {
+            newNode->left = recursiveCopyNode(otherNode->left, newNode);
+            newNode->right = recursiveCopyNode(otherNode->right, newNode);
+        } catch (...) {
+            recursiveClear(newNode);
+            throw;
+        }
         return newNode;
     }
 
@@ -116,7 +172,7 @@ class BinaryTree {
      * current tree.
      */
     void recursiveCopy(const BinaryTree& other) {
-        root_ = recursiveCopyNode(other.root_);
+        root_ = recursiveCopyNode<const Node<Type>>(other.root_);
     }
 
 
@@ -152,7 +208,7 @@ class BinaryTree {
 
         recursiveClear(node->left);
         recursiveClear(node->right);
-        delete node;
+        destroyNode(node);
     }
 
 
@@ -237,17 +293,98 @@ class BinaryTree {
     }
 
 
+    /// Container kind written to the header by serialize().
+    [[nodiscard]]
+    virtual SerializedKind serializedKind() const noexcept {
+        return SerializedKind::BINARY_TREE;
+    }
+
+
+    static constexpr std::uint8_t HAS_LEFT = 1;
+    static constexpr std::uint8_t HAS_RIGHT = 2;
+
+
+    /**
+     * Rebuilds the tree from the pre-order records written by serialize(),
+     * attaching every node where the encoding places it: no comparisons,
+     * rebalancing or heapify. Iterative, so degenerate trees do not
+     * exhaust the call stack.
+     *
+     * @param in Stream positioned at the header.
+     * @param kind Container kind the header must record.
+     *
+     * Complexity: O(n) time, O(h) auxiliary space.
+     *
+     * @par Exception safety
+     * - Basic: on failure the tree is left empty.
+     *
+     * @pre The tree is empty.
+     * @throws std::runtime_error If the data is not a serialized `kind` of
+     * Type, is truncated, or encodes an impossible shape.
+     */
+    void readTree(std::istream& in, const SerializedKind kind) {
+        assert(isEmpty());
+        const std::size_t count = serialization::readHeader<Type>(in, kind);
+
+        DynamicArray<Node<Type>*> awaiting_right;
+        Node<Type>* parent = nullptr;
+        Node<Type>** slot = &root_;
+
+        try {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (slot == nullptr)
+                    throw std::runtime_error(
+                        "Serialized tree shape is corrupt");
+
+                std::uint8_t children;
+                serialization::readBytes(in, &children, sizeof(children));
+                Node<Type>* node =
+                    createNode(serialization::readElement<Type>(in));
+                node->parent = parent;
+                *slot = node;
+                ++size_;
+
+                if (children & HAS_RIGHT)
+                    awaiting_right.addLast(node);
+
+                if (children & HAS_LEFT) {
+                    parent = node;
+                    slot = &node->left;
+                } else if (!awaiting_right.isEmpty()) {
+                    parent = awaiting_right.removeLast();
+                    slot = &parent->right;
+                } else {
+                    slot = nullptr;
+                }
+            }
+
+            if (slot != nullptr && count > 0)
+                throw std::runtime_error("Serialized tree shape is corrupt");
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+
   public:
     /// Default constructor
-    BinaryTree() noexcept : root_() {}
+    BinaryTree() noexcept(noexcept(Allocator())) : BinaryTree(Allocator()) {}
+
+    /// Creates an empty tree whose nodes come from `allocator`.
+    explicit BinaryTree(const Allocator& allocator) noexcept
+        : pool_(allocator), root_() {}
 
     /**
      * Constructor that creates a binary tree from an array using level-order
      * insertion.
      * @param array Pointer to the array of elements.
      * @param size Number of elements in the array.
+     * @param allocator Source of the tree's nodes.
      */
-    BinaryTree(const Type* array, const std::size_t size) : root_() {
+    BinaryTree(const Type* array, const std::size_t size,
+               const Allocator& allocator = Allocator())
+        : pool_(allocator), root_() {
         if (array == nullptr && size != 0)
             throw std::invalid_argument(
                 "Array pointer cannot be null when size is non-zero");
@@ -255,14 +392,22 @@ class BinaryTree {
             BinaryTree::insert(array[i]);
     }
 
-    /// Copy constructor
-    BinaryTree(const BinaryTree& other) : root_(), size_(other.size_) {
+    /// Copy constructor; the allocator is chosen by
+    /// select_on_container_copy_construction.
+    BinaryTree(const BinaryTree& other)
+        : BinaryTree(other, NodeTraits::select_on_container_copy_construction(
+                                other.pool_.getAllocator())) {}
+
+    /// Copy constructor taking the nodes from `allocator`.
+    BinaryTree(const BinaryTree& other, const Allocator& allocator)
+        : pool_(allocator), root_(), size_(other.size_) {
         recursiveCopy(other);
     }
 
     /// Move constructor
     BinaryTree(BinaryTree&& other) noexcept
-        : root_(other.root_), size_(other.size_) {
+        : pool_(std::move(other.pool_)), root_(other.root_),
+          size_(other.size_) {
         other.root_ = nullptr;
         other.size_ = 0;
     }
@@ -274,18 +419,43 @@ class BinaryTree {
             return *this;
 
         clear();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::
+                          value)
+            pool_.getAllocator() = other.pool_.getAllocator();
         recursiveCopy(other);
         size_ = other.size_;
         return *this;
     }
 
 
-    /// Move assignment operator
-    BinaryTree& operator=(BinaryTree&& other) noexcept {
+    /**
+     * Move assignment operator
+     *
+     * Takes over other's nodes when the allocator propagates or both
+     * allocators are equal. Otherwise this tree's allocator cannot free those
+     * nodes, so the same shape is rebuilt from its own nodes with the
+     * elements moved over (which may throw), and other is left empty.
+     */
+    BinaryTree& operator=(BinaryTree&& other) noexcept(
+        NOTHROW_MOVE_ASSIGNABLE) {
         if (this == &other)
             return *this;
 
         clear();
+        constexpr bool propagate =
+            NodeTraits::propagate_on_container_move_assignment::value;
+        if constexpr (!NOTHROW_MOVE_ASSIGNABLE) {
+            if (pool_.getAllocator() != other.pool_.getAllocator()) {
+                root_ = recursiveCopyNode(other.root_);
+                size_ = other.size_;
+                other.clear();
+                return *this;
+            }
+        } else if constexpr (propagate) {
+            pool_.getAllocator() = std::move(other.pool_.getAllocator());
+        }
+
+        pool_.adopt(other.pool_);
         root_ = other.root_;
         size_ = other.size_;
         other.root_ = nullptr;
@@ -389,7 +559,7 @@ class BinaryTree {
                       "Only types constructible into Type are allowed");
 
         if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
+            root_ = createNode(std::forward<U>(element));
             size_++;
             return;
         }
@@ -398,7 +568,7 @@ class BinaryTree {
         while (current->right != nullptr)
             current = current->right;
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = createNode(std::forward<U>(element));
         newNode->parent = current;
         current->right = newNode;
         size_++;
@@ -437,7 +607,7 @@ class BinaryTree {
                       "Only types constructible into Type are allowed");
 
         if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
+            root_ = createNode(std::forward<U>(element));
             size_++;
             return;
         }
@@ -446,7 +616,7 @@ class BinaryTree {
         while (current->left != nullptr)
             current = current->left;
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = createNode(std::forward<U>(element));
         newNode->parent = current;
         current->left = newNode;
         size_++;
@@ -490,7 +660,7 @@ class BinaryTree {
                       "Element must be constructible into Type");
 
         if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
+            root_ = createNode(std::forward<U>(element));
             size_++;
             return;
         }
@@ -503,7 +673,7 @@ class BinaryTree {
 
             // Check if left child is available
             if (current->left == nullptr) {
-                auto* newNode = new Node<Type>(std::forward<U>(element));
+                auto* newNode = createNode(std::forward<U>(element));
                 newNode->parent = current;
                 current->left = newNode;
                 size_++;
@@ -512,7 +682,7 @@ class BinaryTree {
 
             // Check if right child is available
             if (current->right == nullptr) {
-                auto* newNode = new Node<Type>(std::forward<U>(element));
+                auto* newNode = createNode(std::forward<U>(element));
                 newNode->parent = current;
                 current->right = newNode;
                 size_++;
@@ -615,22 +785,90 @@ class BinaryTree {
 
 
     /**
-     * Clears the binary tree by deallocating all nodes and resetting to empty.
+     * Clears the binary tree by destroying all nodes and resetting to empty.
+     * The node pool's chunks are returned to the allocator in one sweep.
      *
-     * Complexity: O(n) deleting every node exactly once.
+     * Complexity: O(n) destroying every node exactly once; O(chunks) if
+     * `Type` is trivially destructible.
      * Exception safety: No-throw.
      */
     void clear() noexcept {
-        recursiveClear(root_);
+        if constexpr (!std::is_trivially_destructible_v<Type>)
+            recursiveClear(root_);
+        pool_.release();
         root_ = nullptr;
         size_ = 0;
     }
 
 
+    /**
+     * Writes the tree in the binary container format (see
+     * Serialization.hpp): after the header, one record per node in
+     * pre-order, holding a byte with the node's HAS_LEFT / HAS_RIGHT flags
+     * and then its element. The shape is stored exactly, so deserialize()
+     * rebuilds the same tree in O(n).
+     *
+     * Complexity: O(n) time, O(h) auxiliary space.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void serialize(std::ostream& out) const {
+        serialization::writeHeader<Type>(out, serializedKind(), size_);
+
+        DynamicArray<const Node<Type>*> pending;
+        if (root_ != nullptr)
+            pending.addLast(root_);
+
+        while (!pending.isEmpty()) {
+            const Node<Type>* node = pending.removeLast();
+            const std::uint8_t children =
+                (node->left ? HAS_LEFT : 0) | (node->right ? HAS_RIGHT : 0);
+            serialization::writeBytes(out, &children, sizeof(children));
+            serialization::writeElement(out, node->data);
+
+            if (node->right != nullptr)
+                pending.addLast(node->right);
+            if (node->left != nullptr)
+                pending.addLast(node->left);
+        }
+    }
+
+
+    /**
+     * Reads a tree written by serialize(), restoring its exact shape.
+     *
+     * @throws std::runtime_error If the data is not a serialized binary
+     * tree of Type, or is corrupt.
+     */
+    static BinaryTree deserialize(std::istream& in,
+                                  const Allocator& allocator = Allocator()) {
+        BinaryTree tree(allocator);
+        tree.readTree(in, SerializedKind::BINARY_TREE);
+        return tree;
+    }
+
+
+    /// Returns a copy of the allocator supplying the tree's nodes.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return Allocator(pool_.getAllocator());
+    }
+
+
     /// Destructor
     virtual ~BinaryTree() noexcept { clear(); }
 };
 
+
+namespace pmr {
+
+/// BinaryTree whose nodes come from a std::pmr::memory_resource.
+template <typename Type>
+using BinaryTree =
+    data_structs::BinaryTree<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // BINARYTREE_HPP
@@ -3,16 +3,138 @@
 
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <new>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 
+#include "Serialization.hpp"
+#include "SimdKernels.hpp"
+
 
 namespace data_structs {
 
 
+/**
+ * @brief Opt-in trait: a Type object can be relocated (moved to new storage,
+ * with the source's lifetime ended) by copying its bytes.
+ *
+ * Defaults to std::is_trivially_copyable. Types that merely own resources
+ * through pointers and never point into themselves (handles, most
+ * smart-pointer wrappers) may opt in by specializing it:
+ *
+ *     template <>
+ *     struct data_structs::IsTriviallyRelocatable<Handle> : std::true_type {};
+ *
+ * DynamicArray then grows, inserts and erases such elements with memcpy /
+ * memmove instead of a move-construct and destroy per element.
+ */
+template <typename Type>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<Type> {};
+
+template <typename Type>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE =
+    IsTriviallyRelocatable<Type>::value;
+
+
+/**
+ * @brief Capacity management of DynamicArray: when and how far it grows and
+ * shrinks, and how requested capacities are rounded.
+ *
+ * A policy is a class with the static members below. Custom policies derive
+ * from this one and redeclare only what they change:
+ *
+ *     struct StackPolicy : data_structs::DefaultGrowthPolicy {
+ *         static constexpr std::size_t INITIAL_CAPACITY = 0;
+ *         static constexpr bool SHRINKS = false;
+ *     };
+ *     data_structs::DynamicArray<int, std::allocator<int>, StackPolicy> a;
+ *
+ * The defaults double the capacity, allocate 5 slots up front, and halve
+ * the capacity once the array is three-quarters empty.
+ */
+struct DefaultGrowthPolicy {
+    /// Capacity of a default-constructed or cleared array. 0 defers the
+    /// first allocation to the first insertion.
+    static constexpr std::size_t INITIAL_CAPACITY = 5;
+
+    /// Smallest capacity allocated, and the floor for shrinking.
+    static constexpr std::size_t MIN_CAPACITY = 5;
+
+    /// Elements stored inside the array object itself, before the first
+    /// allocation; see InlineDynamicArray.
+    static constexpr std::size_t INLINE_CAPACITY = 0;
+
+    /// A full array grows to capacity * GROWTH_NUMERATOR /
+    /// GROWTH_DENOMINATOR (at least by one slot); 3 / 2 trades more
+    /// frequent growth for less unused capacity.
+    static constexpr std::size_t GROWTH_NUMERATOR = 2;
+    static constexpr std::size_t GROWTH_DENOMINATOR = 1;
+
+    /// Whether removals shrink the capacity automatically. shrinkToFit()
+    /// is available either way.
+    static constexpr bool SHRINKS = true;
+
+    /// Removals shrink the capacity to capacity / SHRINK_DIVISOR once
+    /// size() <= capacity / SHRINK_THRESHOLD. The threshold must exceed the
+    /// divisor, so that a shrunk array has room left and a push right after
+    /// a shrink cannot trigger a regrowth.
+    static constexpr std::size_t SHRINK_THRESHOLD = 4;
+    static constexpr std::size_t SHRINK_DIVISOR = 2;
+
+    /// Capacity actually allocated for a request of `capacity` elements of
+    /// `element_size` bytes (never less than `capacity`).
+    static constexpr std::size_t
+    roundCapacity(const std::size_t capacity,
+                  [[maybe_unused]] const std::size_t element_size) noexcept {
+        return capacity;
+    }
+};
+
+
+/**
+ * @brief Growth policy that rounds every allocation up to a size the
+ * underlying allocator would hand out anyway.
+ *
+ * Blocks up to a page are rounded to a power of two (the size classes of
+ * common malloc implementations), blocks up to 2 MiB to whole 4 KiB pages,
+ * and larger blocks to whole 2 MiB huge pages, so that transparent huge
+ * pages can back them. The slack that would otherwise be lost to
+ * the allocator becomes usable capacity.
+ */
+struct SizeClassGrowthPolicy : DefaultGrowthPolicy {
+    static constexpr std::size_t PAGE_SIZE = std::size_t{1} << 12;
+    static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t{1} << 21;
+
+    static constexpr std::size_t
+    roundCapacity(const std::size_t capacity,
+                  const std::size_t element_size) noexcept {
+        if (capacity > std::numeric_limits<std::size_t>::max() /
+                           element_size / 2)
+            return capacity;
+
+        const std::size_t bytes = capacity * element_size;
+        std::size_t rounded;
+        if (bytes <= PAGE_SIZE)
+            rounded = std::bit_ceil(bytes);
+        else if (bytes <= HUGE_PAGE_SIZE)
+            rounded = (bytes + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+        else
+            rounded = (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        return rounded / element_size;
+    }
+};
+
+
 /**
  * @class DynamicArray
  * @brief A vector-like, resizable, contiguous container with explicit lifetime
@@ -25,8 +147,9 @@ namespace data_structs {
  *   - Support appends, prepends, middle inserts, and removals.
  *   - Offer strong exception safety for the operations that change capacity or
  * rebuild storage.
- *   - Correctly handle over-aligned types by using the aligned forms of
- * ::operator new/delete.
+ *   - Take raw storage from a pluggable, std::allocator-compatible Allocator
+ * (std::allocator by default, which handles over-aligned types with the
+ * aligned forms of ::operator new/delete).
  *
  * Elements are only constructed for the logical size; capacity refers to the
  * amount of raw storage available to hold additional elements without
@@ -34,18 +157,32 @@ namespace data_structs {
  * (construct/destroy) independently from raw storage (allocate/deallocate).
  *
  * @tparam Type The element type stored by the container.
+ * @tparam Allocator Source of the raw storage. Only allocate/deallocate are
+ * used; elements are still constructed with placement new. Propagation on
+ * copy, move and swap follows std::allocator_traits, as in the standard
+ * containers. pmr::DynamicArray uses std::pmr::polymorphic_allocator.
+ * @tparam GrowthPolicy Capacity management; see DefaultGrowthPolicy.
  *
  * @par Design Highlights
  * - Contiguous storage for cache locality and pointer/pointer-range iteration.
- * - Amortized O(1) append via doubling growth policy (up to MAX_CAPACITY).
+ * - Amortized O(1) append via geometric growth (up to MAX_CAPACITY).
  * - Strong exception safety for capacity-changing operations using the
  * allocate+construct+commit pattern.
- * - Over-alignment correctness by passing `std::align_val_t(alignof(Type))` to
- * allocation/deallocation.
+ * - Over-alignment correctness through the allocator (std::allocator passes
+ * `std::align_val_t(alignof(Type))` to the aligned ::operator new).
+ * - Middle inserts shift the suffix in place when there is spare capacity,
+ * and insertRange/eraseRange shift it once per batch.
+ * - Bulk relocation for IS_TRIVIALLY_RELOCATABLE types: growth, middle
+ * inserts and erases are single memcpy/memmove calls, and growth of
+ * suitably aligned types reallocates in place with std::realloc when it can.
+ * - Optional inline storage (GrowthPolicy::INLINE_CAPACITY, see
+ * InlineDynamicArray): the first elements live inside the object and only
+ * larger arrays allocate.
  *
  * @par Growth Policy
- * - Capacity doubles on demand until MAX_CAPACITY. When near the limit, it
- * clamps to MAX_CAPACITY.
+ * - Set by the GrowthPolicy parameter. By default, capacity doubles on
+ * demand and halves when the array is three-quarters empty, with a floor of
+ * 5 slots. Near MAX_CAPACITY, growth clamps to MAX_CAPACITY.
  *
  * @par Exception Safety
  * - insert / emplaceAt: strong guarantee (the array is unchanged on failure).
@@ -56,25 +193,153 @@ namespace data_structs {
  *
  * @par Invalidation
  * - Any insert/remove/resize operation invalidates all pointers, references,
- * and iterators.
+ * and iterators. With inline storage, so does moving or swapping the array
+ * while its elements are inline.
  *
  * @par Moved-from State
- * - A moved-from DynamicArray is valid and empty (begin()==end()).
+ * - A moved-from DynamicArray is valid and empty (begin()==end()). With
+ * inline storage, it keeps its (empty) inline buffer.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = DefaultGrowthPolicy>
 class DynamicArray {
 
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, Type>,
+                  "Allocator::value_type must be Type");
+    static_assert(std::is_same_v<typename AllocatorTraits::pointer, Type*>,
+                  "Fancy pointers are not supported");
+
+    static constexpr std::size_t INLINE_CAPACITY =
+        GrowthPolicy::INLINE_CAPACITY;
+
+    /// Raw storage for the inline elements; an empty member without any.
+    struct InlineBuffer {
+        alignas(Type) unsigned char bytes[INLINE_CAPACITY * sizeof(Type)];
+    };
+    struct NoInlineBuffer {};
+
+    [[no_unique_address]] Allocator allocator_;
     Type* data_;
     std::size_t size_;
     std::size_t capacity_;
-
-    static constexpr std::size_t DEFAULT_CAPACITY = 5;
+    [[no_unique_address]] std::conditional_t<INLINE_CAPACITY == 0,
+                                             NoInlineBuffer, InlineBuffer>
+        inline_;
 
     static constexpr std::size_t MAX_CAPACITY =
         std::numeric_limits<std::size_t>::max() / sizeof(Type);
 
-    static constexpr std::size_t MAX_SAFE_CAPACITY =
-        std::numeric_limits<std::size_t>::max() / sizeof(Type) / 2;
+    static constexpr std::size_t MIN_CAPACITY = GrowthPolicy::MIN_CAPACITY;
+
+    static constexpr std::size_t INITIAL_CAPACITY =
+        GrowthPolicy::INITIAL_CAPACITY;
+
+    static_assert(MIN_CAPACITY > 0, "MIN_CAPACITY must be positive");
+    static_assert(INITIAL_CAPACITY == 0 || INITIAL_CAPACITY >= MIN_CAPACITY,
+                  "INITIAL_CAPACITY must be 0 or at least MIN_CAPACITY");
+    static_assert(GrowthPolicy::GROWTH_DENOMINATOR > 0 &&
+                      GrowthPolicy::GROWTH_NUMERATOR >
+                          GrowthPolicy::GROWTH_DENOMINATOR,
+                  "The growth factor must exceed 1");
+    static_assert(!GrowthPolicy::SHRINKS ||
+                      (GrowthPolicy::SHRINK_DIVISOR > 1 &&
+                       GrowthPolicy::SHRINK_THRESHOLD >
+                           GrowthPolicy::SHRINK_DIVISOR),
+                  "Shrinking needs SHRINK_THRESHOLD > SHRINK_DIVISOR > 1");
+    static_assert(INLINE_CAPACITY == 0 ||
+                      std::is_nothrow_move_constructible_v<Type>,
+                  "Inline elements are moved one by one when the array is "
+                  "moved, which must not throw");
+
+    static constexpr bool RELOCATES_BYTEWISE = IS_TRIVIALLY_RELOCATABLE<Type>;
+
+    /// Shifting elements in place cannot throw for these types, so middle
+    /// inserts can shift the suffix and still keep the strong guarantee.
+    static constexpr bool SHIFTS_IN_PLACE =
+        std::is_nothrow_move_constructible_v<Type> &&
+        std::is_nothrow_move_assignable_v<Type>;
+
+    /// Storage for these types comes from std::malloc instead of the default
+    /// allocator, so that growth can use std::realloc (which extends the
+    /// block in place when possible). Custom allocators are always used.
+    static constexpr bool USES_REALLOC =
+        RELOCATES_BYTEWISE && alignof(Type) <= alignof(std::max_align_t) &&
+        std::is_same_v<Allocator, std::allocator<Type>> &&
+        INLINE_CAPACITY == 0;
+
+
+    /// The inline buffer (nullptr without inline storage).
+    Type* inlineData() noexcept {
+        if constexpr (INLINE_CAPACITY == 0)
+            return nullptr;
+        else
+            return reinterpret_cast<Type*>(inline_.bytes);
+    }
+
+    const Type* inlineData() const noexcept {
+        return const_cast<DynamicArray*>(this)->inlineData();
+    }
+
+
+    /// Capacity of an empty array: the inline buffer, or the growth
+    /// policy's INITIAL_CAPACITY.
+    static constexpr std::size_t emptyCapacity() noexcept {
+        if constexpr (INLINE_CAPACITY > 0)
+            return INLINE_CAPACITY;
+        else
+            return INITIAL_CAPACITY == 0 ? 0
+                                         : roundedCapacity(INITIAL_CAPACITY);
+    }
+
+
+    /// Capacity allocated so that `required` elements fit: the inline
+    /// buffer if they fit there, otherwise at least MIN_CAPACITY rounded by
+    /// the growth policy.
+    static constexpr std::size_t
+    capacityFor(const std::size_t required) noexcept {
+        if (INLINE_CAPACITY > 0 && required <= INLINE_CAPACITY)
+            return INLINE_CAPACITY;
+        return roundedCapacity(std::max(required, MIN_CAPACITY));
+    }
+
+
+    /// Point at the empty inline buffer (or at nothing) without releasing
+    /// anything; the elements must already be destroyed or moved away.
+    void resetToEmptyStorage() noexcept {
+        data_ = inlineData();
+        size_ = 0;
+        capacity_ = INLINE_CAPACITY;
+    }
+
+
+    /**
+     * @brief Take over other's elements; this array must own no elements
+     * and no heap storage.
+     *
+     * A heap buffer simply changes hands. Elements in other's inline buffer
+     * cannot, so they are relocated into this array's inline buffer (one
+     * memcpy for trivially relocatable types, otherwise a nothrow move and
+     * destruction each). Either way, other is left empty.
+     */
+    void takeStorage(DynamicArray& other) noexcept {
+        if (INLINE_CAPACITY > 0 && other.isInline()) {
+            data_ = inlineData();
+            if constexpr (RELOCATES_BYTEWISE) {
+                relocateBytes(data_, other.data_, other.size_);
+            } else {
+                moveConstructElements(other.data_, other.data_ + other.size_,
+                                      data_);
+                other.destroyArrayElements();
+            }
+        } else {
+            data_ = other.data_;
+        }
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.resetToEmptyStorage();
+    }
 
 
     /**
@@ -84,7 +349,9 @@ class DynamicArray {
      * Allocates a single contiguous block of bytes sufficient to hold the
      * requested number of objects of Type, aligned to alignof(Type). No
      * constructors are run here; the caller is responsible for constructing
-     * elements via placement new.
+     * elements via placement new. Hands out the inline buffer when the
+     * request fits and the buffer is not in use; otherwise uses std::malloc
+     * when USES_REALLOC, or the allocator.
      *
      * @param storage_size Number of elements' worth of storage to allocate. May
      * be zero.
@@ -100,35 +367,71 @@ class DynamicArray {
      * @throws std::bad_alloc If storage_size > MAX_CAPACITY or the allocation
      * fails.
      */
-    static Type* allocate(const std::size_t storage_size) {
+    Type* allocate(const std::size_t storage_size) {
         if (storage_size == 0)
             return nullptr;
 
         if (storage_size > MAX_CAPACITY)
             throw std::bad_alloc();
 
-        return static_cast<Type*>(operator new(
-            sizeof(Type) * storage_size,
-            static_cast<std::align_val_t>(alignof(Type))));
+        if constexpr (INLINE_CAPACITY > 0) {
+            if (storage_size <= INLINE_CAPACITY && !isInline())
+                return inlineData();
+        }
+
+        if constexpr (USES_REALLOC) {
+            void* storage = std::malloc(sizeof(Type) * storage_size);
+            if (storage == nullptr)
+                throw std::bad_alloc();
+            return static_cast<Type*>(storage);
+        }
+
+        return AllocatorTraits::allocate(allocator_, storage_size);
     }
 
 
     /**
      * @brief Deallocate raw storage previously obtained via allocate.
      *
-     * Calls the aligned form of ::operator delete. Passing nullptr is allowed
-     * and is a no-op. The caller must ensure that all constructed objects in
-     * the storage have been destroyed prior to deallocation.
+     * Returns the block to the allocator (or std::free when USES_REALLOC).
+     * Passing nullptr or the inline buffer is allowed and is a no-op. The
+     * caller must ensure that all constructed objects in the storage have
+     * been destroyed prior to deallocation.
      *
      * @param storage Pointer returned by allocate. May be nullptr.
+     * @param storage_size The size the block was allocated (or last
+     * reallocated) with.
      *
      * @par Exception Safety
      * - No-throw.
      */
-    static void deallocate(Type* storage) noexcept {
-        if (storage != nullptr)
-            ::operator delete(storage,
-                              static_cast<std::align_val_t>(alignof(Type)));
+    void deallocate(Type* storage, const std::size_t storage_size) noexcept {
+        if constexpr (INLINE_CAPACITY > 0) {
+            if (storage == inlineData())
+                return;
+        }
+
+        if constexpr (USES_REALLOC)
+            std::free(storage);
+        else if (storage != nullptr)
+            AllocatorTraits::deallocate(allocator_, storage, storage_size);
+    }
+
+
+    /**
+     * @brief Relocate `count` elements from source to destination by copying
+     * their bytes (the ranges may overlap). The objects now live at
+     * destination; no constructor or destructor runs.
+     *
+     * Only valid for IS_TRIVIALLY_RELOCATABLE types.
+     */
+    static void relocateBytes(Type* destination, const Type* source,
+                              const std::size_t count) noexcept {
+        static_assert(RELOCATES_BYTEWISE);
+        if (count != 0)
+            std::memmove(static_cast<void*>(destination),
+                         static_cast<const void*>(source),
+                         count * sizeof(Type));
     }
 
 
@@ -175,6 +478,14 @@ class DynamicArray {
                                 const Type* source_end, Type* destination) const
         noexcept(std::is_nothrow_copy_constructible_v<Type>) {
         assert(destination != nullptr);
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            const auto count =
+                static_cast<std::size_t>(source_end - source_begin);
+            if (count != 0)
+                std::memcpy(destination, source_begin, count * sizeof(Type));
+            return destination + count;
+        }
+
         Type* current = destination;
         try {
             for (const Type* it = source_begin; it != source_end;
@@ -231,11 +542,14 @@ class DynamicArray {
     /**
      * @brief Resize the underlying capacity to a new value (size unchanged).
      *
-     * If the requested capacity differs from the current capacity, this
-     * function allocates a new buffer, move-/copy-constructs all existing
-     * elements into it (preferring nothrow-move where available), destroys the
-     * old elements, and then replaces the old storage. The logical size is
-     * preserved.
+     * The request is raised to MIN_CAPACITY and rounded by the growth
+     * policy (or becomes the inline capacity if it fits there). If the
+     * result differs from the current capacity, this function allocates a
+     * new buffer, move-/copy-constructs all existing elements into it
+     * (preferring nothrow-move where available), destroys the old elements,
+     * and then replaces the old storage. The logical size is preserved.
+     * Trivially relocatable elements are instead moved with one
+     * std::realloc (or one memcpy for over-aligned types).
      *
      * @param new_capacity Requested capacity in elements.
      *
@@ -251,18 +565,34 @@ class DynamicArray {
      * fails.
      */
     void resize(std::size_t new_capacity) {
-        if (new_capacity == capacity_)
-            return;
-
-        if (new_capacity < DEFAULT_CAPACITY)
-            new_capacity = DEFAULT_CAPACITY;
-
         if (new_capacity < size_)
             throw std::invalid_argument("New capacity is too small");
 
         if (new_capacity > MAX_CAPACITY)
             throw std::bad_alloc();
 
+        new_capacity = capacityFor(new_capacity);
+        if (new_capacity == capacity_)
+            return;
+
+        if constexpr (USES_REALLOC) {
+            // On failure the old block is left untouched
+            void* storage = std::realloc(static_cast<void*>(data_),
+                                         sizeof(Type) * new_capacity);
+            if (storage == nullptr)
+                throw std::bad_alloc();
+            data_ = static_cast<Type*>(storage);
+            capacity_ = new_capacity;
+            return;
+        } else if constexpr (RELOCATES_BYTEWISE) {
+            Type* new_data = allocate(new_capacity);
+            relocateBytes(new_data, data_, size_);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            return;
+        }
+
         Type* new_data = allocate(new_capacity);
         Type* new_data_end = new_data;
         try {
@@ -276,39 +606,67 @@ class DynamicArray {
         } catch (...) {
             for (Type* it = new_data; it != new_data_end; ++it)
                 it->~Type();
-            deallocate(new_data);
+            deallocate(new_data, new_capacity);
             throw;
         }
 
         destroyArrayElements();
-        deallocate(data_);
+        deallocate(data_, capacity_);
         data_ = new_data;
         capacity_ = new_capacity;
     }
 
 
+    /// Capacity the growth policy allocates for a request (clamped to
+    /// MAX_CAPACITY).
+    static constexpr std::size_t
+    roundedCapacity(const std::size_t capacity) noexcept {
+        return std::min(GrowthPolicy::roundCapacity(capacity, sizeof(Type)),
+                        MAX_CAPACITY);
+    }
+
+
+    /// Capacity that a full array of `capacity` slots grows to: one growth
+    /// factor more, at least one slot more, and at most MAX_CAPACITY.
+    static constexpr std::size_t
+    scaledCapacity(const std::size_t capacity) noexcept {
+        if (capacity > MAX_CAPACITY / GrowthPolicy::GROWTH_NUMERATOR)
+            return MAX_CAPACITY;
+
+        const std::size_t scaled = capacity * GrowthPolicy::GROWTH_NUMERATOR /
+                                   GrowthPolicy::GROWTH_DENOMINATOR;
+        return std::max(scaled, capacity + 1);
+    }
+
+
     /**
-     * @brief Shrink capacity by half when the array becomes sparse.
+     * @brief Shrink the capacity when the array becomes sparse, if the growth
+     * policy shrinks at all.
      *
-     * If size() <= capacity()/4 and capacity() > DEFAULT_CAPACITY, the capacity
-     * is reduced by half (not below the default). This reallocation is
-     * performed with the same strong exception-safety as resize.
+     * If size() <= capacity() / SHRINK_THRESHOLD and capacity() >
+     * MIN_CAPACITY, the capacity is divided by SHRINK_DIVISOR (not below
+     * MIN_CAPACITY); 4 and 2 by default. This reallocation is performed with
+     * the same strong exception-safety as resize.
      *
      * @par Complexity
      * - O(size()) constructions/destructions only when a shrink occurs.
      */
     void shrinkIfNecessary() {
-        if (size_ <= capacity_ / 4 && capacity_ > DEFAULT_CAPACITY)
-            resize(capacity_ / 2);
+        if constexpr (GrowthPolicy::SHRINKS) {
+            if (size_ <= capacity_ / GrowthPolicy::SHRINK_THRESHOLD &&
+                capacity_ > MIN_CAPACITY)
+                resize(capacity_ / GrowthPolicy::SHRINK_DIVISOR);
+        }
     }
 
 
     /**
-     * @brief Ensure there is room for one more element (grow by doubling if
-     * full).
+     * @brief Ensure there is room for one more element (grow by the policy's
+     * factor if full).
      *
-     * If size() == capacity(), this doubles capacity (clamped to MAX_CAPACITY).
-     * The growth uses resize, preserving the strong exception guarantee.
+     * An array without storage gets MIN_CAPACITY slots; a full one grows as
+     * described by scaledCapacity. The growth uses resize, preserving the
+     * strong exception guarantee.
      *
      * @par Exception Safety
      * - Strong (via resize).
@@ -317,15 +675,74 @@ class DynamicArray {
      */
     void ensureCapacity() {
         if (capacity_ == 0) {
-            resize(DEFAULT_CAPACITY);
+            resize(MIN_CAPACITY);
             return;
         }
 
         if (size_ == capacity_) {
             if (capacity_ == MAX_CAPACITY)
                 throw std::length_error("DynamicArray capacity limit");
-            resize(capacity_ > MAX_SAFE_CAPACITY ? MAX_CAPACITY
-                                                 : capacity_ * 2);
+            resize(scaledCapacity(capacity_));
+        }
+    }
+
+
+    /**
+     * @brief Capacity to grow to so that `required` elements fit: one growth
+     * step from the current capacity, or more if that is still too small.
+     *
+     * @throws std::length_error If required > MAX_CAPACITY.
+     */
+    std::size_t grownCapacity(const std::size_t required) const {
+        if (required > MAX_CAPACITY)
+            throw std::length_error("DynamicArray capacity limit");
+
+        return std::max({required, scaledCapacity(capacity_), MIN_CAPACITY});
+    }
+
+
+    /**
+     * @brief Construct a new element at index idx < size(), shifting the
+     * suffix one slot to the right.
+     *
+     * The new element is constructed aside first, so arguments that refer
+     * into the array stay valid and a throwing constructor leaves the array
+     * unchanged. Then:
+     * - trivially relocatable suffixes are shifted with one memmove and the
+     *   element is relocated into the gap;
+     * - SHIFTS_IN_PLACE suffixes are shifted by move-constructing the last
+     *   element into the free slot and move-assigning the rest backwards;
+     * - for other types (whose moves may throw) the buffer is rebuilt.
+     *
+     * The callers reserve the free slot first (ensureCapacity).
+     *
+     * @par Complexity
+     * - O(size() - idx) moves; no allocation unless rebuilding.
+     *
+     * @par Exception Safety
+     * - Strong.
+     */
+    template <typename... CtorArgs>
+    void insertMiddle(const std::size_t idx, CtorArgs&&... args) {
+        assert(idx < size_ && size_ < capacity_);
+
+        if constexpr (RELOCATES_BYTEWISE) {
+            alignas(Type) unsigned char slot[sizeof(Type)];
+            Type* element = ::new (static_cast<void*>(slot))
+                Type(std::forward<CtorArgs>(args)...);
+            relocateBytes(data_ + idx + 1, data_ + idx, size_ - idx);
+            relocateBytes(data_ + idx, element, 1);
+            ++size_;
+        } else if constexpr (SHIFTS_IN_PLACE) {
+            Type element(std::forward<CtorArgs>(args)...);
+            ::new (static_cast<void*>(data_ + size_))
+                Type(std::move(data_[size_ - 1]));
+            std::move_backward(data_ + idx, data_ + size_ - 1,
+                               data_ + size_);
+            data_[idx] = std::move(element);
+            ++size_;
+        } else {
+            rebuildBuffer(idx, std::forward<CtorArgs>(args)...);
         }
     }
 
@@ -340,6 +757,8 @@ class DynamicArray {
      * size()). On any failure, all partially constructed elements in the new
      * buffer are destroyed and the original array is left unchanged.
      *
+     * Only used by insertMiddle for types whose moves may throw.
+     *
      * @tparam CtorArgs Argument types forwarded to Type's constructor for the
      * inserted element.
      * @param idx Insertion index (must satisfy 0 <= idx < size() when called
@@ -356,6 +775,7 @@ class DynamicArray {
     template <typename... CtorArgs>
     void rebuildBuffer(const std::size_t idx, CtorArgs&&... args) {
         static_assert(std::is_constructible_v<Type, CtorArgs&&...>);
+
         Type* new_data = allocate(capacity_);
         Type* constructed_end = new_data;
 
@@ -381,12 +801,12 @@ class DynamicArray {
         } catch (...) {
             for (Type* it = new_data; it != constructed_end; ++it)
                 it->~Type();
-            deallocate(new_data);
+            deallocate(new_data, capacity_);
             throw;
         }
 
         destroyArrayElements();
-        deallocate(data_);
+        deallocate(data_, capacity_);
         data_ = new_data;
         ++size_;
     }
@@ -395,23 +815,26 @@ class DynamicArray {
     /**
      * @brief Erase by left-shifting using assignment (for assignable types).
      *
-     * Overwrites the range [from_idx .. size()-2] by assigning from the
-     * subsequent element, destroys the last element, and decrements the size.
+     * Overwrites the range [from_idx .. size()-count-1] by assigning from the
+     * element `count` positions further, destroys the last `count` elements,
+     * and decreases the size by `count`.
      *
-     * @param from_idx Index of the element to remove (0 <= from_idx < size()).
+     * @param from_idx Index of the first element to remove.
+     * @param count Number of elements to remove (from_idx + count <= size()).
      *
      * @par Complexity
-     * - O(n) assignments and one destruction.
+     * - O(n) assignments and `count` destructions.
      *
      * @par Exception Safety
      * - Basic: if an assignment throws, the invariant size() is left unchanged
      * and all elements remain valid (the container can be cleared).
      */
-    void shiftLeftAssignables(const std::size_t from_idx) {
-        for (std::size_t i = from_idx; i < size_ - 1; ++i)
-            data_[i] = std::move(data_[i + 1]);
-        data_[size_ - 1].~Type();
-        --size_;
+    void shiftLeftAssignables(const std::size_t from_idx,
+                              const std::size_t count) {
+        std::move(data_ + from_idx + count, data_ + size_, data_ + from_idx);
+        for (std::size_t i = size_ - count; i < size_; ++i)
+            data_[i].~Type();
+        size_ -= count;
     }
 
 
@@ -419,13 +842,15 @@ class DynamicArray {
      * @brief Erase by left-shifting via construct+destroy relocation (for
      * non-assignable types).
      *
-     * Destroys the element at from_idx, then for each subsequent position
-     * constructs a new object in-place from the next element (move if nothrow;
-     * otherwise copy), and destroys the old source. If a construction throws,
-     * partially constructed elements are destroyed and the size is reset to the
-     * last successfully relocated index.
+     * Destroys the `count` elements starting at from_idx, then for each
+     * subsequent position constructs a new object in-place from the element
+     * `count` positions further (move if nothrow; otherwise copy), and
+     * destroys the old source. If a construction throws, the elements not yet
+     * relocated are destroyed and the size is reset to the last successfully
+     * relocated index.
      *
-     * @param from_idx Index of the element to remove (0 <= from_idx < size()).
+     * @param from_idx Index of the first element to remove.
+     * @param count Number of elements to remove (from_idx + count <= size()).
      *
      * @par Complexity
      * - O(n) constructions/destructions.
@@ -434,13 +859,15 @@ class DynamicArray {
      * - Strong during the relocation loop: partial progress is rolled back on
      * throw.
      */
-    void shiftLeftNonassignables(std::size_t from_idx) {
-        data_[from_idx].~Type();
+    void shiftLeftNonassignables(const std::size_t from_idx,
+                                 const std::size_t count) {
+        for (std::size_t i = from_idx; i < from_idx + count; ++i)
+            data_[i].~Type();
         std::size_t j = from_idx;
         try {
-            for (; j + 1 < size_; ++j) {
+            for (; j + count < size_; ++j) {
                 Type* dst = data_ + j;
-                Type* src = data_ + (j + 1);
+                Type* src = data_ + (j + count);
                 if constexpr (std::is_nothrow_move_constructible_v<Type> ||
                               !std::is_copy_constructible_v<Type>)
                     new (dst) Type(std::move(*src));
@@ -449,21 +876,26 @@ class DynamicArray {
                 src->~Type();
             }
         } catch (...) {
-            for (std::size_t k = j + 1; k < size_; ++k)
+            for (std::size_t k = j + count; k < size_; ++k)
                 data_[k].~Type();
             size_ = j;
             throw;
         }
-        --size_;
+        size_ -= count;
     }
 
 
   public:
     /**
-     * Default constructor that initializes the dynamic array with a default
-     * capacity.
+     * Default constructor that initializes the dynamic array with the growth
+     * policy's INITIAL_CAPACITY (5 by default; 0 allocates nothing).
      */
-    DynamicArray() : data_(nullptr), size_(0), capacity_(DEFAULT_CAPACITY) {
+    DynamicArray() : DynamicArray(Allocator()) {}
+
+    /// Creates an empty array whose storage comes from `allocator`.
+    explicit DynamicArray(const Allocator& allocator)
+        : allocator_(allocator), data_(nullptr), size_(0),
+          capacity_(emptyCapacity()) {
         data_ = allocate(capacity_);
     }
 
@@ -475,44 +907,58 @@ class DynamicArray {
      * @param initial_data Pointer to the initial data to be copied into the
      * dynamic array.
      * @param initial_size The number of elements in the initial data.
+     * @param allocator Source of the array's storage.
      */
-    DynamicArray(const Type* initial_data, const std::size_t initial_size)
-        : data_(nullptr), size_(initial_size),
-          capacity_(initial_size < DEFAULT_CAPACITY ? DEFAULT_CAPACITY
-                                                    : initial_size) {
+    DynamicArray(const Type* initial_data, const std::size_t initial_size,
+                 const Allocator& allocator = Allocator())
+        : allocator_(allocator), data_(nullptr), size_(initial_size),
+          capacity_(0) {
         if (initial_size > 0 && initial_data == nullptr)
             throw std::invalid_argument("Initial data cannot be null if "
                                         "initial size is greater than zero");
 
+        if (initial_size > MAX_CAPACITY)
+            throw std::bad_alloc();
+        capacity_ = initial_size > 0 ? capacityFor(initial_size)
+                                     : emptyCapacity();
+
         data_ = allocate(capacity_);
         try {
             if (size_ > 0)
                 copyConstructElements(initial_data, initial_data + size_,
                                       data_);
         } catch (...) {
-            deallocate(data_);
+            deallocate(data_, capacity_);
             throw;
         }
     }
 
-    /// Copy constructor
+    /// Copy constructor; the allocator is chosen by
+    /// select_on_container_copy_construction.
     DynamicArray(const DynamicArray& other)
-        : data_(allocate(other.capacity_)), size_(other.size_),
+        : DynamicArray(other, AllocatorTraits::
+                                  select_on_container_copy_construction(
+                                      other.allocator_)) {}
+
+    /// Copy constructor taking the storage from `allocator`.
+    DynamicArray(const DynamicArray& other, const Allocator& allocator)
+        : allocator_(allocator), data_(nullptr), size_(other.size_),
           capacity_(other.capacity_) {
+        data_ = allocate(capacity_);
         try {
             copyConstructElements(other.data_, other.data_ + size_, data_);
         } catch (...) {
-            deallocate(data_);
+            deallocate(data_, capacity_);
             throw;
         }
     }
 
-    /// Move constructor
+    /// Move constructor; inline elements are moved one by one, a heap
+    /// buffer changes hands.
     DynamicArray(DynamicArray&& other) noexcept
-        : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
-        other.data_ = nullptr;
-        other.size_ = 0;
-        other.capacity_ = 0;
+        : allocator_(std::move(other.allocator_)), data_(nullptr), size_(0),
+          capacity_(0) {
+        takeStorage(other);
     }
 
     /// Copy assignment operator
@@ -520,43 +966,70 @@ class DynamicArray {
         if (this == &other)
             return *this;
 
-        Type* new_data = allocate(other.capacity_);
-        try {
-            copyConstructElements(other.data_, other.data_ + other.size_,
-                                  new_data);
-        } catch (...) {
-            deallocate(new_data);
-            throw;
-        }
+        constexpr bool propagate =
+            AllocatorTraits::propagate_on_container_copy_assignment::value;
+        DynamicArray copy(other, propagate ? other.allocator_ : allocator_);
 
         destroyArrayElements();
-        deallocate(data_);
-        data_ = new_data;
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-
+        deallocate(data_, capacity_);
+        if constexpr (propagate)
+            allocator_ = copy.allocator_;
+        takeStorage(copy);
         return *this;
     }
 
-    /// Move assignment operator
-    DynamicArray& operator=(DynamicArray&& other) noexcept {
-        if (this != &other) {
-            destroyArrayElements();
-            deallocate(data_);
-
-            data_ = other.data_;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
+    /**
+     * @brief Move assignment operator
+     *
+     * Takes over other's buffer when the allocator propagates or both
+     * allocators are equal. Otherwise this array's allocator cannot free
+     * that buffer, so the elements are moved one by one into storage of its
+     * own (which may throw) and other is left empty.
+     */
+    DynamicArray& operator=(DynamicArray&& other) noexcept(
+        AllocatorTraits::propagate_on_container_move_assignment::value ||
+        AllocatorTraits::is_always_equal::value) {
+        if (this == &other)
+            return *this;
 
-            other.data_ = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+        constexpr bool propagate =
+            AllocatorTraits::propagate_on_container_move_assignment::value;
+        if constexpr (!propagate && !AllocatorTraits::is_always_equal::value) {
+            if (allocator_ != other.allocator_) {
+                Type* new_data = allocate(other.capacity_);
+                try {
+                    moveConstructElements(other.data_,
+                                          other.data_ + other.size_, new_data);
+                } catch (...) {
+                    deallocate(new_data, other.capacity_);
+                    throw;
+                }
+
+                destroyArrayElements();
+                deallocate(data_, capacity_);
+                data_ = new_data;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+                other.removeAll();
+                return *this;
+            }
         }
 
+        destroyArrayElements();
+        deallocate(data_, capacity_);
+        if constexpr (propagate)
+            allocator_ = std::move(other.allocator_);
+        takeStorage(other);
         return *this;
     }
 
 
+    /// Returns a copy of the allocator supplying the array's storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return allocator_;
+    }
+
     /// Returns the current size of the dynamic array.
     [[nodiscard]]
     std::size_t size() const noexcept {
@@ -569,6 +1042,13 @@ class DynamicArray {
         return capacity_;
     }
 
+    /// Checks if the elements live in the inline buffer (see
+    /// InlineDynamicArray); always false without one.
+    [[nodiscard]]
+    bool isInline() const noexcept {
+        return INLINE_CAPACITY > 0 && data_ == inlineData();
+    }
+
     /// Checks if the dynamic array is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
@@ -581,13 +1061,17 @@ class DynamicArray {
      * the dynamic array.
      *
      * If found, it returns its index [0 ; size_ - 1],
-     * otherwise size_.
+     * otherwise size_. Arrays of integers, float and double are
+     * scanned with the SIMD kernels of simd::findFirst().
      *
      * @param element The element to look for.
      * @return The index of the found element.
      */
     [[nodiscard]]
     std::size_t contains(const Type& element) const noexcept {
+        if constexpr (simd::IS_VECTORIZABLE<Type>)
+            return simd::findFirst(data_, size_, element);
+
         for (std::size_t i = 0; i < size_; ++i)
             if (data_[i] == element)
                 return i;
@@ -598,9 +1082,11 @@ class DynamicArray {
     /**
      * @brief Insert an element at index idx.
      *
-     * For middle inserts (idx < size()), this method constructs the result into
-     * a fresh buffer and commits only after success (strong guarantee).
-     * Appending at idx == size() constructs in-place at the end.
+     * Appending at idx == size() constructs in-place at the end. Middle inserts
+     * (idx < size()) construct the element first, then shift the suffix one
+     * slot right in place; types whose moves may throw instead rebuild into a
+     * fresh buffer and commit only after success (strong guarantee either
+     * way).
      *
      * @tparam U A type that can construct Type (perfect-forwarded).
      * @param element Value to insert.
@@ -608,7 +1094,8 @@ class DynamicArray {
      *
      * @par Complexity
      * - Append: amortized O(1); O(n) if growth occurs.
-     * - Middle insert: O(n) time; O(n) temporary storage during rebuild.
+     * - Middle insert: O(n - idx) moves; O(n) time and temporary storage
+     * when rebuilding.
      *
      * @par Exception Safety
      * - Strong: on failure (allocation or construction), the array is
@@ -633,7 +1120,7 @@ class DynamicArray {
             return;
         }
 
-        rebuildBuffer(idx, std::forward<U>(element));
+        insertMiddle(idx, std::forward<U>(element));
     }
 
 
@@ -660,7 +1147,7 @@ class DynamicArray {
      * @brief Prepend an element at index 0.
      *
      * Delegates to insert(element, 0). This is an O(n) middle insert that
-     * rebuilds into a fresh buffer and commits on success (strong guarantee).
+     * shifts every element one slot right (strong guarantee).
      *
      * @tparam U A type that can construct Type.
      * @param element Value to insert at the front.
@@ -674,10 +1161,10 @@ class DynamicArray {
     /**
      * @brief Emplace-construct an element at index idx.
      *
-     * For middle inserts (idx < size()), constructs the result into a fresh
-     * buffer (prefix, new element, suffix) and commits only after success
-     * (strong guarantee). Appending at idx == size() constructs in-place at the
-     * end.
+     * Same strategy as insert(): appending at idx == size() constructs
+     * in-place at the end; middle inserts construct the element first and
+     * shift the suffix in place, or rebuild into a fresh buffer for types
+     * whose moves may throw (strong guarantee either way).
      *
      * @tparam Args Argument types forwarded to Type's constructor.
      * @param idx Insertion position, 0 <= idx <= size().
@@ -685,7 +1172,8 @@ class DynamicArray {
      *
      * @par Complexity
      * - Append: amortized O(1); O(n) when growth occurs.
-     * - Middle insert: O(n) time; O(n) temporary storage during rebuild.
+     * - Middle insert: O(n - idx) moves; O(n) time and temporary storage
+     * when rebuilding.
      *
      * @par Exception Safety
      * - Strong: on failure (allocation or construction), the array is
@@ -710,7 +1198,7 @@ class DynamicArray {
             return;
         }
 
-        rebuildBuffer(idx, std::forward<Args>(args)...);
+        insertMiddle(idx, std::forward<Args>(args)...);
     }
 
 
@@ -735,7 +1223,7 @@ class DynamicArray {
      * @brief Emplace-construct an element at the front (index 0).
      *
      * Delegates to emplaceAt(0, args...). This is an O(n) middle insert that
-     * rebuilds into a fresh buffer and commits on success (strong guarantee).
+     * shifts every element one slot right (strong guarantee).
      *
      * @tparam Args Argument types forwarded to Type's constructor.
      * @param args Constructor arguments.
@@ -746,6 +1234,123 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Insert copies of the elements of [first, last) at index idx.
+     *
+     * Grows at most once, then shifts the suffix once for the whole batch:
+     * - trivially relocatable suffixes are moved right with one memmove and
+     *   the new elements are constructed in the gap;
+     * - SHIFTS_IN_PLACE types are constructed at the end and rotated into
+     *   place;
+     * - other types (whose moves may throw) are rebuilt into a fresh buffer,
+     *   copying the existing elements, and committed on success.
+     *
+     * @tparam Iterator Forward iterator whose elements can construct Type.
+     * @param idx Insertion position, 0 <= idx <= size().
+     * @param first Start of the range to insert.
+     * @param last End of the range to insert.
+     *
+     * @par Precondition
+     * - The range must not refer into this array.
+     *
+     * @par Complexity
+     * - O(size() + k) for k inserted elements, instead of O(size() * k) for
+     * k single inserts.
+     *
+     * @par Exception Safety
+     * - Strong: if constructing an element throws, the contents are
+     * unchanged (the capacity may have grown).
+     *
+     * @throws std::out_of_range If idx > size().
+     * @throws std::length_error If the result would exceed MAX_CAPACITY.
+     * @throws std::bad_alloc On allocation failure.
+     */
+    template <std::forward_iterator Iterator>
+    void insertRange(const std::size_t idx, Iterator first,
+                     const Iterator last) {
+        static_assert(
+            std::is_constructible_v<Type, std::iter_reference_t<Iterator>>);
+        if (idx > size_)
+            throw std::out_of_range("Index out of range");
+
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (count == 0)
+            return;
+        if (count > MAX_CAPACITY - size_)
+            throw std::length_error("DynamicArray capacity limit");
+        const std::size_t new_size = size_ + count;
+
+        if constexpr (RELOCATES_BYTEWISE) {
+            if (new_size > capacity_)
+                resize(grownCapacity(new_size));
+
+            relocateBytes(data_ + idx + count, data_ + idx, size_ - idx);
+            Type* gap = data_ + idx;
+            try {
+                for (; first != last; ++first, ++gap)
+                    ::new (static_cast<void*>(gap)) Type(*first);
+            } catch (...) {
+                for (Type* it = data_ + idx; it != gap; ++it)
+                    it->~Type();
+                relocateBytes(data_ + idx, data_ + idx + count, size_ - idx);
+                throw;
+            }
+            size_ = new_size;
+        } else if constexpr (SHIFTS_IN_PLACE) {
+            if (new_size > capacity_)
+                resize(grownCapacity(new_size));
+
+            const std::size_t old_size = size_;
+            try {
+                for (; first != last; ++first, ++size_)
+                    ::new (static_cast<void*>(data_ + size_)) Type(*first);
+            } catch (...) {
+                while (size_ > old_size)
+                    data_[--size_].~Type();
+                throw;
+            }
+            std::rotate(data_ + idx, data_ + old_size, data_ + size_);
+        } else {
+            // Sized as resize() would, so the policy's rounding applies
+            const std::size_t new_capacity =
+                new_size > capacity_ ? capacityFor(grownCapacity(new_size))
+                                     : capacity_;
+            Type* new_data = allocate(new_capacity);
+            Type* constructed_end = new_data;
+
+            try {
+                if constexpr (std::is_copy_constructible_v<Type>)
+                    constructed_end =
+                        copyConstructElements(data_, data_ + idx, new_data);
+                else
+                    constructed_end =
+                        moveConstructElements(data_, data_ + idx, new_data);
+
+                for (; first != last; ++first, ++constructed_end)
+                    ::new (static_cast<void*>(constructed_end)) Type(*first);
+
+                if constexpr (std::is_copy_constructible_v<Type>)
+                    constructed_end = copyConstructElements(
+                        data_ + idx, data_ + size_, constructed_end);
+                else
+                    constructed_end = moveConstructElements(
+                        data_ + idx, data_ + size_, constructed_end);
+            } catch (...) {
+                for (Type* it = new_data; it != constructed_end; ++it)
+                    it->~Type();
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+
+            destroyArrayElements();
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            size_ = new_size;
+            capacity_ = new_capacity;
+        }
+    }
+
+
     /**
      * @brief Removes the element from the array.
      *
@@ -768,11 +1373,8 @@ class DynamicArray {
     /**
      * @brief Remove and return the element at index idx.
      *
-     * Removes one element and left-shifts the suffix. If Type is
-     * move/copy-assignable, the fast assignment path is used (basic guarantee
-     * if an assignment throws). Otherwise, the relocation path is used, which
-     * constructs and destroys in sequence and rolls back on construction
-     * failure (stronger behavior during the shift).
+     * Moves the element out, then erases its slot and left-shifts the suffix
+     * as eraseRange(idx, idx + 1) does.
      *
      * @param idx Index to remove (must satisfy 0 <= idx < size()).
      * @return The removed element (moved out).
@@ -791,21 +1393,7 @@ class DynamicArray {
             throw std::out_of_range("Index out of range");
 
         Type element = std::move(data_[idx]);
-
-        if (idx == size_ - 1) {
-            data_[idx].~Type();
-            --size_;
-            shrinkIfNecessary();
-            return element;
-        }
-
-        if constexpr (std::is_move_assignable_v<Type> ||
-                      std::is_copy_assignable_v<Type>)
-            shiftLeftAssignables(idx);
-        else
-            shiftLeftNonassignables(idx);
-
-        shrinkIfNecessary();
+        eraseRange(idx, idx + 1);
         return element;
     }
 
@@ -834,6 +1422,52 @@ class DynamicArray {
     Type removeLast() { return removeAt(size_ - 1); }
 
 
+    /**
+     * @brief Remove the elements at indices [first, last).
+     *
+     * Destroys the range and left-shifts the suffix once, by last - first
+     * positions. Trivially relocatable suffixes are shifted with one memmove.
+     * Otherwise, if Type is move/copy-assignable, the fast assignment path is
+     * used (basic guarantee if an assignment throws). Otherwise, the
+     * relocation path is used, which constructs and destroys in sequence and
+     * rolls back on construction failure (stronger behavior during the
+     * shift). May shrink the capacity afterwards, like removeAt.
+     *
+     * @param first Index of the first element to remove.
+     * @param last Index one past the last element to remove.
+     *
+     * @par Complexity
+     * - O(size() - first), independent of how many elements are removed.
+     *
+     * @par Exception Safety
+     * - Basic for the assignable path (if an assignment throws).
+     * - Strong during relocation path (rollback of partial progress).
+     *
+     * @throws std::out_of_range If first > last or last > size().
+     */
+    void eraseRange(const std::size_t first, const std::size_t last) {
+        if (first > last || last > size_)
+            throw std::out_of_range("Index out of range");
+        if (first == last)
+            return;
+
+        const std::size_t count = last - first;
+        if constexpr (RELOCATES_BYTEWISE) {
+            for (std::size_t i = first; i < last; ++i)
+                data_[i].~Type();
+            relocateBytes(data_ + first, data_ + last, size_ - last);
+            size_ -= count;
+        } else if constexpr (std::is_move_assignable_v<Type> ||
+                             std::is_copy_assignable_v<Type>) {
+            shiftLeftAssignables(first, count);
+        } else {
+            shiftLeftNonassignables(first, count);
+        }
+
+        shrinkIfNecessary();
+    }
+
+
     /**
      * @brief Destroy all elements (capacity unchanged).
      *
@@ -849,6 +1483,24 @@ class DynamicArray {
         size_ = 0;
     }
 
+
+    /**
+     * @brief Destroy the elements from index new_size on (capacity
+     * unchanged).
+     *
+     * Unlike eraseRange, never shrinks the capacity, so it cannot throw;
+     * containers built from several arrays use it to undo a partial append.
+     *
+     * @param new_size Number of elements kept; no-op if >= size().
+     *
+     * @par Complexity
+     * - O(size() - new_size) destructor calls.
+     */
+    void truncate(const std::size_t new_size) noexcept {
+        while (size_ > new_size)
+            data_[--size_].~Type();
+    }
+
     /**
      * @brief Bounds-checked mutable access.
      *
@@ -882,6 +1534,34 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Unchecked mutable access.
+     *
+     * Returns a reference to the element at index idx without a bounds check
+     * (only asserted in debug builds). Intended for hot loops whose indices
+     * are already known to be valid.
+     *
+     * @param idx Index in [0, size()); violating this is undefined behavior.
+     * @return Mutable reference to the element at idx.
+     */
+    Type& getUnchecked(const std::size_t idx) noexcept {
+        assert(idx < size_);
+        return data_[idx];
+    }
+
+
+    /**
+     * @brief Unchecked const access.
+     *
+     * @param idx Index in [0, size()); violating this is undefined behavior.
+     * @return Const reference to the element at idx.
+     */
+    const Type& getUnchecked(const std::size_t idx) const noexcept {
+        assert(idx < size_);
+        return data_[idx];
+    }
+
+
     /**
      * @brief Element access with bounds checking (mutable).
      *
@@ -984,11 +1664,12 @@ class DynamicArray {
 
 
     /**
-     * @brief Shrink capacity to fit current size (not below DEFAULT_CAPACITY).
+     * @brief Shrink capacity to fit current size (not below MIN_CAPACITY).
      *
-     * If size() < DEFAULT_CAPACITY, capacity is set to DEFAULT_CAPACITY.
-     * Otherwise capacity is set to size(). Elements are moved/copied into the
-     * new buffer.
+     * If size() < MIN_CAPACITY, capacity is set to MIN_CAPACITY. Otherwise
+     * capacity is set to size(), rounded by the growth policy. Elements are
+     * moved/copied into the new buffer. An array with inline storage moves
+     * back into it when the elements fit.
      *
      * @par Complexity
      * - O(size()) when a resize occurs; otherwise O(1).
@@ -997,12 +1678,8 @@ class DynamicArray {
      * - Strong (via resize).
      */
     void shrinkToFit() {
-        if (capacity_ > size_) {
-            if (size_ < DEFAULT_CAPACITY)
-                resize(DEFAULT_CAPACITY);
-            else
-                resize(size_);
-        }
+        if (capacity_ > size_)
+            resize(size_);
     }
 
 
@@ -1022,7 +1699,8 @@ class DynamicArray {
      * propagate.
      */
     DynamicArray clone() const {
-        DynamicArray copy;
+        DynamicArray copy(
+            AllocatorTraits::select_on_container_copy_construction(allocator_));
         copy.reserve(size_);
         copyConstructElements(data_, data_ + size_, copy.data_);
         copy.size_ = size_;
@@ -1030,6 +1708,90 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Pointer to the first element of the contiguous storage.
+     *
+     * The elements occupy [data(), data() + size()). May be nullptr for a
+     * moved-from array.
+     */
+    Type* data() noexcept { return data_; }
+    const Type* data() const noexcept { return data_; }
+
+
+    /**
+     * @brief Non-owning view over the live elements [0, size()).
+     *
+     * The view performs no bounds checks and is the entry point used by the
+     * algorithms to work on raw contiguous memory.
+     *
+     * @par Invalidation
+     * - Same as for pointers: any insert/remove/resize invalidates the view.
+     */
+    std::span<Type> span() noexcept { return {data_, size_}; }
+    std::span<const Type> span() const noexcept { return {data_, size_}; }
+
+
+    /**
+     * @brief Write the array to `out` in the binary container format (see
+     * Serialization.hpp).
+     *
+     * Raw elements are written as one block; others through their
+     * Serializer.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void serialize(std::ostream& out) const {
+        serializeAs(out, SerializedKind::DYNAMIC_ARRAY);
+    }
+
+
+    /// serialize(), recording `kind` in the header (for Stack and Queue).
+    void serializeAs(std::ostream& out, const SerializedKind kind) const {
+        serialization::writeHeader<Type>(out, kind, size_);
+        serialization::writeElements(out, data_, size_);
+    }
+
+
+    /**
+     * @brief Read an array written by serialize().
+     *
+     * The storage is allocated once; raw elements are read straight into it
+     * with a single read.
+     *
+     * @par Complexity
+     * - O(n), one allocation.
+     *
+     * @throws std::runtime_error If the data is not a serialized array of
+     * Type, or is truncated.
+     * @throws std::bad_alloc If the storage cannot be allocated.
+     */
+    static DynamicArray deserialize(std::istream& in,
+                                    const Allocator& allocator = Allocator()) {
+        return deserializeAs(in, SerializedKind::DYNAMIC_ARRAY, allocator);
+    }
+
+
+    /// deserialize() of data written by serializeAs() with `kind`.
+    static DynamicArray
+    deserializeAs(std::istream& in, const SerializedKind kind,
+                  const Allocator& allocator = Allocator()) {
+        const std::size_t count = serialization::readHeader<Type>(in, kind);
+        if (count > MAX_CAPACITY)
+            throw std::bad_alloc();
+
+        DynamicArray array(allocator);
+        array.reserve(count);
+        if constexpr (serialization::IS_RAW<Type>) {
+            serialization::readBytes(in, array.data_, count * sizeof(Type));
+            array.size_ = count;
+        } else {
+            for (std::size_t i = 0; i < count; ++i)
+                array.emplaceLast(serialization::readElement<Type>(in));
+        }
+        return array;
+    }
+
+
     // --- Iterator support for range-based for loops ---
 
     Type* begin() noexcept { return data_; }
@@ -1048,16 +1810,17 @@ class DynamicArray {
 
 
     /**
-     * @brief Destroy all elements and reset to an empty array with
-     * DEFAULT_CAPACITY.
+     * @brief Destroy all elements and reset to an empty array with the growth
+     * policy's INITIAL_CAPACITY.
      *
      * Destroys all constructed elements, deallocates the current buffer, then
-     * allocates a fresh buffer of DEFAULT_CAPACITY. After clear(), the array is
-     * empty and ready to be reused.
+     * allocates a fresh buffer of INITIAL_CAPACITY (none if it is 0). After
+     * clear(), the array is empty and ready to be reused.
      *
      * @par Postconditions
      * - size() == 0
-     * - capacity() == DEFAULT_CAPACITY
+     * - capacity() == INITIAL_CAPACITY (5 by default), as rounded by the
+     * growth policy
      *
      * @par Complexity
      * - O(previous size) destructor calls, plus one allocation.
@@ -1067,14 +1830,22 @@ class DynamicArray {
      * unchanged (elements are not destroyed).
      */
     void clear() {
-        Type* new_data = allocate(DEFAULT_CAPACITY);
+        if constexpr (INLINE_CAPACITY > 0) {
+            destroyArrayElements();
+            deallocate(data_, capacity_);
+            resetToEmptyStorage();
+            return;
+        }
+
+        const std::size_t new_capacity = emptyCapacity();
+        Type* new_data = allocate(new_capacity);
 
         destroyArrayElements();
-        deallocate(data_);
+        deallocate(data_, capacity_);
 
         data_ = new_data;
         size_ = 0;
-        capacity_ = DEFAULT_CAPACITY;
+        capacity_ = new_capacity;
     }
 
 
@@ -1092,11 +1863,21 @@ class DynamicArray {
     ~DynamicArray() noexcept {
         if (data_) {
             destroyArrayElements();
-            deallocate(data_);
+            deallocate(data_, capacity_);
         }
     }
 };
 
+
+namespace pmr {
+
+/// DynamicArray whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using DynamicArray =
+    data_structs::DynamicArray<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // DYNAMICARRAY_HPP
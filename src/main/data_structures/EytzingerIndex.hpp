@@ -0,0 +1,301 @@
+#ifndef EYTZINGER_INDEX_HPP
+#define EYTZINGER_INDEX_HPP
+
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "SimdKernels.hpp"
+
+
+namespace data_structs {
+
+
+/**
+ * @class EytzingerIndex
+ * @brief Read-only search index over a sorted sequence, stored in Eytzinger
+ * (breadth-first binary tree) order.
+ *
+ * Slot k holds the root of a perfectly balanced search tree at k = 1 and the
+ * children of slot k at 2k and 2k + 1, so a lookup walks down from the root
+ * with one branch-free comparison per level. Unlike in a sorted array, the
+ * nodes probed first sit next to each other, and all 16 descendants four
+ * levels below slot k share one cache line (for 4-byte keys; in general
+ * 64 / sizeof(Type) descendants), so that line is prefetched while the next
+ * levels are compared. Lookups on large tables therefore overlap their
+ * cache misses instead of waiting on each one in turn.
+ *
+ * Lookups report positions in the original sorted order (ranks), so the
+ * index can stand in for BinarySearch over a sorted DynamicArray or span.
+ *
+ * @tparam Type Copy-constructible element type with operator<.
+ *
+ * @par Complexity
+ * - Build: O(n) time, O(n) space (the tree plus one rank per element).
+ * - lowerBound / find / contains: O(log n) time, O(1) space.
+ *
+ * @par Moved-from State
+ * - A moved-from index is valid and empty.
+ */
+template <typename Type>
+class EytzingerIndex {
+
+    /// tree_[1 .. size_] holds the elements; slot 0 is never constructed.
+    Type* tree_ = nullptr;
+    std::size_t size_ = 0;
+
+    /// ranks_[k] is the sorted position of tree_[k] (slot 0 unused).
+    DynamicArray<std::size_t> ranks_;
+
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    /// The tree is aligned to a cache line (or more for over-aligned types),
+    /// so the block of descendants prefetched at once never straddles two.
+    static constexpr std::size_t ALIGNMENT =
+        std::max(CACHE_LINE, alignof(Type));
+
+    /// Descendants of slot k at slot k * PREFETCH_STRIDE and on share one
+    /// cache line.
+    static constexpr std::size_t PREFETCH_STRIDE =
+        std::max<std::size_t>(1, CACHE_LINE / sizeof(Type));
+
+
+    static Type* allocate(const std::size_t slots) {
+        if (slots > std::numeric_limits<std::size_t>::max() / sizeof(Type))
+            throw std::bad_alloc();
+        return static_cast<Type*>(::operator new(
+            sizeof(Type) * slots, static_cast<std::align_val_t>(ALIGNMENT)));
+    }
+
+
+    static void deallocate(Type* storage) noexcept {
+        if (storage != nullptr)
+            ::operator delete(storage,
+                              static_cast<std::align_val_t>(ALIGNMENT));
+    }
+
+
+    /// Destroy tree_[1 .. count] and release the storage.
+    static void release(Type* tree, const std::size_t count) noexcept {
+        if (tree == nullptr)
+            return;
+        for (std::size_t k = 1; k <= count; ++k)
+            tree[k].~Type();
+        deallocate(tree);
+    }
+
+
+    /**
+     * @brief Assign ranks to the slots of the subtree rooted at slot k by an
+     * in-order walk, which visits the slots in sorted order.
+     *
+     * @param k Root of the subtree.
+     * @param rank Rank of the subtree's leftmost slot.
+     * @return Rank of the slot following the subtree in order.
+     */
+    std::size_t assignRanks(const std::size_t k, std::size_t rank) noexcept {
+        if (k > size_)
+            return rank;
+
+        rank = assignRanks(2 * k, rank);
+        ranks_.getUnchecked(k) = rank;
+        return assignRanks(2 * k + 1, rank + 1);
+    }
+
+
+    /**
+     * @brief Slot of the first element not less than `value`, or 0 if every
+     * element is less.
+     *
+     * Every level costs one comparison whose result is added to the slot
+     * index instead of being branched on; meanwhile the cache line four
+     * levels down is already being fetched.
+     */
+    std::size_t lowerBoundSlot(const Type& value) const noexcept {
+        std::size_t k = 1;
+        while (k <= size_) {
+            simd::prefetch(tree_, k * PREFETCH_STRIDE * sizeof(Type));
+            k = 2 * k + static_cast<std::size_t>(tree_[k] < value);
+        }
+
+        // The walk went right on every element less than `value`; undoing
+        // the trailing right turns and the last left turn leads back to the
+        // element where it went left
+        return k >> (std::countr_one(k) + 1);
+    }
+
+
+  public:
+    /// Creates an empty index.
+    EytzingerIndex() = default;
+
+
+    /**
+     * @brief Build the index from a range sorted in non-decreasing order.
+     *
+     * The elements are copied; the range is not needed afterwards.
+     *
+     * @param sorted The sorted elements.
+     *
+     * @throws std::invalid_argument If the range is not sorted.
+     * @throws std::bad_alloc If the allocation fails.
+     *
+     * @par Exception Safety
+     * - Strong: if copying an element throws, everything built so far is
+     *   released and the exception propagates.
+     */
+    explicit EytzingerIndex(const std::span<const Type> sorted)
+        : size_(sorted.size()) {
+        for (std::size_t i = 1; i < size_; ++i)
+            if (sorted[i] < sorted[i - 1])
+                throw std::invalid_argument("Input must be sorted");
+
+        ranks_.reserve(size_ + 1);
+        for (std::size_t k = 0; k <= size_; ++k)
+            ranks_.addLast(size_);
+        assignRanks(1, 0);
+        if (size_ == 0)
+            return;
+
+        tree_ = allocate(size_ + 1);
+        std::size_t k = 1;
+        try {
+            for (; k <= size_; ++k)
+                ::new (static_cast<void*>(tree_ + k))
+                    Type(sorted[ranks_.getUnchecked(k)]);
+        } catch (...) {
+            release(tree_, k - 1);
+            throw;
+        }
+    }
+
+
+    /// Builds the index from a sorted array; see EytzingerIndex(std::span).
+    template <typename Allocator, typename GrowthPolicy>
+    explicit EytzingerIndex(
+        const DynamicArray<Type, Allocator, GrowthPolicy>& sorted)
+        : EytzingerIndex(sorted.span()) {}
+
+
+    /// Copy constructor
+    EytzingerIndex(const EytzingerIndex& other)
+        : size_(other.size_), ranks_(other.ranks_) {
+        if (other.tree_ == nullptr)
+            return;
+
+        tree_ = allocate(size_ + 1);
+        std::size_t k = 1;
+        try {
+            for (; k <= size_; ++k)
+                ::new (static_cast<void*>(tree_ + k)) Type(other.tree_[k]);
+        } catch (...) {
+            release(tree_, k - 1);
+            throw;
+        }
+    }
+
+
+    /// Move constructor
+    EytzingerIndex(EytzingerIndex&& other) noexcept
+        : tree_(other.tree_), size_(other.size_),
+          ranks_(std::move(other.ranks_)) {
+        other.tree_ = nullptr;
+        other.size_ = 0;
+    }
+
+
+    /// Copy assignment operator
+    EytzingerIndex& operator=(const EytzingerIndex& other) {
+        if (this != &other) {
+            EytzingerIndex copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+
+    /// Move assignment operator
+    EytzingerIndex& operator=(EytzingerIndex&& other) noexcept {
+        if (this != &other) {
+            release(tree_, size_);
+            tree_ = other.tree_;
+            size_ = other.size_;
+            ranks_ = std::move(other.ranks_);
+            other.tree_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+
+    ~EytzingerIndex() noexcept { release(tree_, size_); }
+
+
+    /// Number of indexed elements.
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the index is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+
+    /**
+     * @brief Sorted position of the first element not less than `value`
+     * (lower_bound semantics), or size() if every element is less.
+     *
+     * Note for float/double: indexes containing NaN are unsupported;
+     * results are unspecified.
+     *
+     * @param value The value to look for.
+     * @return A position in [0, size()].
+     *
+     * @par Complexity
+     * - O(log n) time, without data-dependent branches.
+     * - O(1) space.
+     */
+    [[nodiscard]]
+    std::size_t lowerBound(const Type& value) const noexcept {
+        const std::size_t k = lowerBoundSlot(value);
+        return k == 0 ? size_ : ranks_.getUnchecked(k);
+    }
+
+
+    /**
+     * @brief Sorted position of the first element equal to `value`, or
+     * size() if there is none.
+     *
+     * Same result as algo::BinarySearch over the sorted input.
+     */
+    [[nodiscard]]
+    std::size_t find(const Type& value) const noexcept {
+        const std::size_t k = lowerBoundSlot(value);
+        if (k == 0 || value < tree_[k])
+            return size_;
+        return ranks_.getUnchecked(k);
+    }
+
+
+    /// Checks if an element equal to `value` is indexed. Cheaper than
+    /// find(), which also reads the rank table.
+    [[nodiscard]]
+    bool contains(const Type& value) const noexcept {
+        const std::size_t k = lowerBoundSlot(value);
+        return k != 0 && !(value < tree_[k]);
+    }
+};
+
+} // namespace data_structs
+
+#endif // EYTZINGER_INDEX_HPP
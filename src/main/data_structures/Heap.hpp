@@ -20,6 +20,7 @@ namespace data_structs {
  * (min/max) is delegated to derived classes via `heapifyUp` / `heapifyDown`.
  *
  * @tparam Type Element type. Must be MoveConstructible or CopyConstructible.
+ * @tparam Allocator Node allocator; see BinaryTree.
  *
  * @section shape Shape & storage
  * - The tree is always complete: levels are filled left-to-right.
@@ -56,8 +57,11 @@ namespace data_structs {
  * **basic** guarantee: the tree remains structurally valid; element values may
  * be partially moved if a `Type` operation throws.
  */
-template <typename Type>
-class Heap : public BinaryTree<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class Heap : public BinaryTree<Type, Allocator> {
+
+    using Base = BinaryTree<Type, Allocator>;
+
 
   protected:
     virtual void heapifyUp(Node<Type>* node) = 0;
@@ -141,23 +145,26 @@ class Heap : public BinaryTree<Type> {
 
   public:
     /// Default constructor
-    Heap() : BinaryTree<Type>() {}
+    Heap() : Base() {}
+
+    /// Creates an empty heap whose nodes come from `allocator`.
+    explicit Heap(const Allocator& allocator) noexcept : Base(allocator) {}
 
     /// Copy constructor
-    Heap(const Heap& other) : BinaryTree<Type>(other) {}
+    Heap(const Heap& other) : Base(other) {}
 
     /// Move constructor
-    Heap(Heap&& other) noexcept : BinaryTree<Type>(std::move(other)) {}
+    Heap(Heap&& other) noexcept : Base(std::move(other)) {}
 
     /// Copy assignment operator
     Heap& operator=(const Heap& other) {
-        BinaryTree<Type>::operator=(other);
+        Base::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
-    Heap& operator=(Heap&& other) noexcept {
-        BinaryTree<Type>::operator=(std::move(other));
+    Heap& operator=(Heap&& other) noexcept(Base::NOTHROW_MOVE_ASSIGNABLE) {
+        Base::operator=(std::move(other));
         return *this;
     }
 
@@ -188,7 +195,7 @@ class Heap : public BinaryTree<Type> {
 
         Node<Type>* last = findLastNode();
         if (last == this->root_) {
-            delete this->root_;
+            this->destroyNode(this->root_);
             this->root_ = nullptr;
             this->size_ = 0;
             return out;
@@ -201,7 +208,7 @@ class Heap : public BinaryTree<Type> {
         else
             last->parent->right = nullptr;
 
-        delete last;
+        this->destroyNode(last);
         --this->size_;
         heapifyDown(this->root_);
         return out;
@@ -0,0 +1,78 @@
+#ifndef INLINE_DYNAMIC_ARRAY_HPP
+#define INLINE_DYNAMIC_ARRAY_HPP
+
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include "DynamicArray.hpp"
+
+
+namespace data_structs {
+
+
+/**
+ * @brief Growth policy that keeps the first N elements inside the array
+ * object; otherwise behaves like Base.
+ *
+ * @tparam N Inline capacity in elements (at least 1).
+ * @tparam Base Policy for the heap storage used beyond N elements.
+ */
+template <std::size_t N, typename Base = DefaultGrowthPolicy>
+struct InlineGrowthPolicy : Base {
+    static_assert(N > 0, "Use DynamicArray for arrays without inline storage");
+
+    static constexpr std::size_t INLINE_CAPACITY = N;
+};
+
+
+/**
+ * @brief DynamicArray with room for N elements inside the object itself
+ * (a "small vector").
+ *
+ * Most arrays built per call or per request hold only a handful of elements;
+ * for them, a DynamicArray still pays for one allocation, and for a pointer
+ * chase on every access. An InlineDynamicArray stores up to N elements in a
+ * buffer embedded in the object and spills to the allocator only when an
+ * insert exceeds N. From then on it grows like any DynamicArray, and it
+ * returns to the inline buffer when it shrinks (or shrinkToFit()s) below N
+ * elements again.
+ *
+ * The API, the exception guarantees and the allocator handling are those of
+ * DynamicArray, and the array works with every algorithm taking one. The
+ * differences:
+ * - sizeof grows by N * sizeof(Type); the array is best kept on the stack
+ *   or inside another object, not in large numbers.
+ * - Moving an array whose elements are inline moves the elements one by one
+ *   (O(size()) instead of O(1)), which invalidates pointers into it. Type
+ *   must therefore be nothrow move constructible, so that moves stay
+ *   noexcept.
+ * - capacity() is never below N.
+ *
+ * @tparam Type The element type; nothrow move constructible.
+ * @tparam N Inline capacity in elements.
+ * @tparam Allocator Source of the storage beyond N elements.
+ *
+ * @par Complexity
+ * - As DynamicArray, except for moves (see above).
+ */
+template <typename Type, std::size_t N,
+          typename Allocator = std::allocator<Type>>
+using InlineDynamicArray =
+    DynamicArray<Type, Allocator, InlineGrowthPolicy<N>>;
+
+
+namespace pmr {
+
+/// InlineDynamicArray spilling into a std::pmr::memory_resource.
+template <typename Type, std::size_t N>
+using InlineDynamicArray =
+    data_structs::InlineDynamicArray<Type, N,
+                                     std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
+} // namespace data_structs
+
+#endif // INLINE_DYNAMIC_ARRAY_HPP
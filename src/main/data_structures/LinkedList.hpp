@@ -3,10 +3,14 @@
 
 
 #include <cassert>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "NodePool.hpp"
+#include "Serialization.hpp"
 
 namespace data_structs {
 
@@ -17,8 +21,14 @@ namespace data_structs {
  * A generic doubly linked list class that provides functionalities for adding,
  * removing, and accessing elements. The internal storage is implemented using
  * a doubly linked list structure.
+ *
+ * @tparam Type Element type stored by the list.
+ * @tparam Allocator std::allocator-compatible allocator. Nodes live in a
+ * NodePool whose chunks come from it, so adding and removing elements does
+ * not call the allocator once the list has reached its working size.
+ * Propagation on copy and move follows std::allocator_traits.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class LinkedList {
 
     struct Node {
@@ -34,11 +44,52 @@ class LinkedList {
         }
     };
 
+    using NodeTraits = std::allocator_traits<
+        typename NodePool<Node, Allocator>::NodeAllocator>;
+
+    NodePool<Node, Allocator> pool_;
     Node* head_;
     Node* tail_;
     std::size_t size_;
 
 
+    /// Take a node from the pool and construct it from `element`.
+    /// Strong: nothing leaks if the construction throws.
+    template <typename U>
+    Node* createNode(U&& element) {
+        Node* node = pool_.allocate();
+        try {
+            ::new (static_cast<void*>(node)) Node(std::forward<U>(element));
+        } catch (...) {
+            pool_.deallocate(node);
+            throw;
+        }
+        return node;
+    }
+
+
+    /// Destroy a node and return its storage to the pool.
+    void destroyNode(const Node* node) noexcept {
+        Node* storage = const_cast<Node*>(node);
+        storage->~Node();
+        pool_.deallocate(storage);
+    }
+
+
+    /// Take over other's nodes together with the pool holding them; the
+    /// current list must be empty and use an equal allocator.
+    void adoptNodes(LinkedList& other) noexcept {
+        pool_.adopt(other.pool_);
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+
+        other.head_ = nullptr;
+        other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+
     /**
      * @brief Retrieve the node pointer at a given index.
      *
@@ -105,7 +156,11 @@ class LinkedList {
 
   public:
     /// Default constructor
-    LinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+    LinkedList() : LinkedList(Allocator()) {}
+
+    /// Creates an empty list whose nodes come from `allocator`.
+    explicit LinkedList(const Allocator& allocator)
+        : pool_(allocator), head_(nullptr), tail_(nullptr), size_(0) {}
 
     /**
      * Constructor that initializes the linked list with an array of elements.
@@ -115,12 +170,14 @@ class LinkedList {
      * @param array Pointer to the array of elements to initialize the linked
      * list.
      * @param size The number of elements in the array.
+     * @param allocator Source of the list's nodes.
      *
      * @throws std::invalid_argument If the provided array is null and size is
      * greater than zero.
      */
-    LinkedList(const Type* array, const std::size_t size)
-        : head_(nullptr), tail_(nullptr), size_(0) {
+    LinkedList(const Type* array, const std::size_t size,
+               const Allocator& allocator = Allocator())
+        : pool_(allocator), head_(nullptr), tail_(nullptr), size_(0) {
 
         if (size > 0 && array == nullptr)
             throw std::invalid_argument(
@@ -135,9 +192,15 @@ class LinkedList {
         }
     }
 
-    /// Copy constructor
+    /// Copy constructor; the allocator is chosen by
+    /// select_on_container_copy_construction.
     LinkedList(const LinkedList& other)
-        : head_(nullptr), tail_(nullptr), size_(0) {
+        : LinkedList(other, NodeTraits::select_on_container_copy_construction(
+                                other.pool_.getAllocator())) {}
+
+    /// Copy constructor taking the nodes from `allocator`.
+    LinkedList(const LinkedList& other, const Allocator& allocator)
+        : pool_(allocator), head_(nullptr), tail_(nullptr), size_(0) {
         Node* current = other.head_;
 
         try {
@@ -153,7 +216,8 @@ class LinkedList {
 
     /// Move constructor
     LinkedList(LinkedList&& other) noexcept
-        : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+        : pool_(std::move(other.pool_)), head_(other.head_),
+          tail_(other.tail_), size_(other.size_) {
         other.head_ = nullptr;
         other.tail_ = nullptr;
         other.size_ = 0;
@@ -164,59 +228,63 @@ class LinkedList {
         if (this == &other)
             return *this;
 
-        Node* new_head = nullptr;
-        Node* new_tail = nullptr;
-        std::size_t new_size = 0;
-
-        try {
-            for (const Node* cur = other.head_; cur != nullptr;
-                 cur = cur->next) {
-                Node* n = new Node(cur->data);
-                if (!new_head)
-                    new_head = new_tail = n;
-                else {
-                    new_tail->next = n;
-                    n->prev = new_tail;
-                    new_tail = n;
-                }
-                ++new_size;
-            }
-        } catch (...) {
-            for (Node* p = new_head; p != nullptr;) {
-                Node* next = p->next;
-                delete p;
-                p = next;
-            }
-            throw;
-        }
+        constexpr bool propagate =
+            NodeTraits::propagate_on_container_copy_assignment::value;
+        LinkedList copy(other,
+                        Allocator(propagate ? other.pool_.getAllocator()
+                                            : pool_.getAllocator()));
 
         clear();
-        head_ = new_head;
-        tail_ = new_tail;
-        size_ = new_size;
+        if constexpr (propagate)
+            pool_.getAllocator() = copy.pool_.getAllocator();
+        adoptNodes(copy);
         return *this;
     }
 
 
-    /// Move assignment operator
-    LinkedList& operator=(LinkedList&& other) noexcept {
+    /**
+     * @brief Move assignment operator
+     *
+     * Takes over other's nodes when the allocator propagates or both
+     * allocators are equal. Otherwise this list's allocator cannot free
+     * those nodes, so the elements are moved into nodes of its own (which
+     * may throw) and other is left empty.
+     */
+    LinkedList& operator=(LinkedList&& other) noexcept(
+        NodeTraits::propagate_on_container_move_assignment::value ||
+        NodeTraits::is_always_equal::value) {
         if (this == &other)
             return *this;
 
-        clear();
-
-        head_ = other.head_;
-        tail_ = other.tail_;
-        size_ = other.size_;
-
-        other.head_ = nullptr;
-        other.tail_ = nullptr;
-        other.size_ = 0;
+        constexpr bool propagate =
+            NodeTraits::propagate_on_container_move_assignment::value;
+        if constexpr (!propagate && !NodeTraits::is_always_equal::value) {
+            if (pool_.getAllocator() != other.pool_.getAllocator()) {
+                LinkedList moved{Allocator(pool_.getAllocator())};
+                for (Node* cur = other.head_; cur != nullptr; cur = cur->next)
+                    moved.addLast(std::move(cur->data));
+
+                clear();
+                adoptNodes(moved);
+                other.clear();
+                return *this;
+            }
+        }
 
+        clear();
+        if constexpr (propagate)
+            pool_.getAllocator() = std::move(other.pool_.getAllocator());
+        adoptNodes(other);
         return *this;
     }
 
 
+    /// Returns a copy of the allocator supplying the list's nodes.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return Allocator(pool_.getAllocator());
+    }
+
     /// Returns the current size of the linked list.
     [[nodiscard]]
     std::size_t size() const noexcept {
@@ -251,7 +319,7 @@ class LinkedList {
     void addFirst(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
-        Node* new_node = new Node(std::forward<U>(element));
+        Node* new_node = createNode(std::forward<U>(element));
 
         if (isEmpty()) {
             head_ = new_node;
@@ -285,7 +353,7 @@ class LinkedList {
     void addLast(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
-        Node* new_node = new Node(std::forward<U>(element));
+        Node* new_node = createNode(std::forward<U>(element));
 
         if (head_ == nullptr) {
             head_ = new_node;
@@ -336,7 +404,7 @@ class LinkedList {
             } else {
                 Node* current = getNodeAt(idx);
 
-                new_node = new Node(std::forward<U>(element));
+                new_node = createNode(std::forward<U>(element));
                 new_node->next = current;
                 new_node->prev = current->prev;
 
@@ -345,7 +413,8 @@ class LinkedList {
                 ++size_;
             }
         } catch (...) {
-            delete new_node;
+            if (new_node != nullptr)
+                destroyNode(new_node);
             throw;
         }
     }
@@ -374,7 +443,7 @@ class LinkedList {
         else
             tail_ = nullptr;
 
-        delete temp;
+        destroyNode(temp);
         --size_;
     }
 
@@ -402,7 +471,7 @@ class LinkedList {
         else
             head_ = nullptr;
 
-        delete temp;
+        destroyNode(temp);
         --size_;
     }
 
@@ -432,7 +501,7 @@ class LinkedList {
             Node* cur = getNodeAt(idx);
             cur->prev->next = cur->next;
             cur->next->prev = cur->prev;
-            delete cur;
+            destroyNode(cur);
             --size_;
         }
     }
@@ -474,7 +543,7 @@ class LinkedList {
                     current->next->prev = current->prev;
                 }
 
-                delete to_delete;
+                destroyNode(to_delete);
                 --size_;
                 return;
             }
@@ -524,7 +593,7 @@ class LinkedList {
                     current->next->prev = current->prev;
                 }
 
-                delete current;
+                destroyNode(current);
                 --size_;
                 ++removed_count;
             }
@@ -668,23 +737,62 @@ class LinkedList {
     /**
      * @brief Remove all elements and reset the list to empty.
      *
+     * The node pool's chunks are returned to the allocator in one sweep
+     * instead of node by node.
+     *
      * @par Complexity
-     * O(n) — deletes each node.
+     * O(n) to destroy the elements; O(chunks) if Type is trivially
+     * destructible.
      *
      * @par Exception Safety
      * No-throw.
      */
     void clear() noexcept {
-        Node* current = head_;
-        while (current) {
-            Node* next = current->next;
-            delete current;
-            current = next;
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            Node* current = head_;
+            while (current) {
+                Node* next = current->next;
+                current->~Node();
+                current = next;
+            }
         }
+        pool_.release();
         head_ = tail_ = nullptr;
         size_ = 0;
     }
 
+
+    /**
+     * Write the list, head to tail, in the binary container format (see
+     * Serialization.hpp).
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void serialize(std::ostream& out) const {
+        serialization::writeHeader<Type>(out, SerializedKind::LINKED_LIST,
+                                         size_);
+        for (const Node* node = head_; node != nullptr; node = node->next)
+            serialization::writeElement(out, node->data);
+    }
+
+
+    /**
+     * Read a list written by serialize(), appending each element in O(1).
+     *
+     * @throws std::runtime_error If the data is not a serialized list of
+     * Type, or is truncated.
+     */
+    static LinkedList deserialize(std::istream& in,
+                                  const Allocator& allocator = Allocator()) {
+        const std::size_t count =
+            serialization::readHeader<Type>(in, SerializedKind::LINKED_LIST);
+
+        LinkedList list(allocator);
+        for (std::size_t i = 0; i < count; ++i)
+            list.addLast(serialization::readElement<Type>(in));
+        return list;
+    }
+
     /// Destructor
     ~LinkedList() noexcept { clear(); }
 
@@ -887,12 +995,22 @@ class LinkedList {
             cur->next->prev = cur->prev;
         }
 
-        delete cur;
+        destroyNode(cur);
         --size_;
         return iterator(next);
     }
 };
 
+
+namespace pmr {
+
+/// LinkedList whose nodes come from a std::pmr::memory_resource.
+template <typename Type>
+using LinkedList =
+    data_structs::LinkedList<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // LINKEDLIST_HPP
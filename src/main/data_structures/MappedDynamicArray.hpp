@@ -0,0 +1,507 @@
+#ifndef MAPPED_DYNAMIC_ARRAY_HPP
+#define MAPPED_DYNAMIC_ARRAY_HPP
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace data_structs {
+
+
+/// Expected access pattern of a MappedDynamicArray, passed to madvise.
+enum class AccessPattern {
+    NORMAL,     ///< No special treatment (the default).
+    SEQUENTIAL, ///< Front-to-back scans: read ahead aggressively, drop behind.
+    RANDOM,     ///< Scattered accesses: no read-ahead.
+    WILL_NEED,  ///< The whole array will be accessed soon: start reading.
+    DONT_NEED   ///< Not needed soon: its pages may be evicted (and re-read).
+};
+
+
+/**
+ * @class MappedDynamicArray
+ * @brief Resizable array whose storage is a memory-mapped file.
+ *
+ * The elements live in a file mapped with MAP_SHARED, so the array can be
+ * larger than RAM: the kernel pages it in on access and writes dirty pages
+ * back, and a reopened file is usable at once without reading it (the first
+ * access to each page loads it). Growth extends the file with ftruncate and
+ * the mapping with mremap (where available; elsewhere the file is mapped
+ * again), doubling the capacity as DynamicArray does.
+ *
+ * The file format is the raw elements in native byte order. While the array
+ * is open, the file is longer by the spare capacity; close() (or the
+ * destructor) trims it to exactly size() elements.
+ *
+ * span(), data() and begin()/end() expose the elements as contiguous memory,
+ * so every algorithm in DynamicArrayAlgorithms.hpp runs on a mapped array
+ * through its std::span overload, unchanged. Note that the merge-based sorts
+ * allocate their n / 2 element scratch buffer on the heap.
+ *
+ * Only available on POSIX systems.
+ *
+ * @tparam Type Trivially copyable element type (the bytes in the file are
+ * the objects).
+ *
+ * @par Complexity
+ * - addLast/emplaceLast: amortized O(1); growth remaps without copying.
+ * - get / removeLast: O(1), plus a page fault on first access to a page.
+ *
+ * @par Exception Safety
+ * - Strong for growth: if ftruncate or mremap fails, the array is unchanged
+ *   and std::system_error is thrown.
+ *
+ * @par Invalidation
+ * - Growth and shrinkToFit may move the mapping and invalidate pointers,
+ *   spans and iterators.
+ *
+ * @par Moved-from State
+ * - A moved-from array is closed: empty and without a file.
+ *
+ * @par Thread-safety
+ * - Not thread-safe. Other processes mapping the same file see writes, but
+ *   no synchronization is provided.
+ */
+template <typename Type>
+class MappedDynamicArray {
+
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "Elements of a mapped array are stored as raw bytes");
+
+    int fd_ = -1;
+    Type* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+    std::size_t mapped_bytes_ = 0;
+    AccessPattern pattern_ = AccessPattern::NORMAL;
+    std::filesystem::path path_;
+
+    static constexpr std::size_t MAX_CAPACITY =
+        static_cast<std::size_t>(std::numeric_limits<off_t>::max()) /
+        sizeof(Type);
+
+
+    [[noreturn]] static void throwSystemError(const char* operation) {
+        throw std::system_error(errno, std::generic_category(), operation);
+    }
+
+
+    static std::size_t pageSize() noexcept {
+        static const auto page_size =
+            static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return page_size;
+    }
+
+
+    static int adviceFor(const AccessPattern pattern) noexcept {
+        switch (pattern) {
+        case AccessPattern::SEQUENTIAL:
+            return MADV_SEQUENTIAL;
+        case AccessPattern::RANDOM:
+            return MADV_RANDOM;
+        case AccessPattern::WILL_NEED:
+            return MADV_WILLNEED;
+        case AccessPattern::DONT_NEED:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+        }
+    }
+
+
+    MappedDynamicArray(const int fd, std::filesystem::path path) noexcept
+        : fd_(fd), path_(std::move(path)) {}
+
+
+    /// Open `path` with `flags`; the descriptor is closed on exec.
+    static int openFile(const std::filesystem::path& path, const int flags) {
+        const int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throwSystemError("open");
+        return fd;
+    }
+
+
+    /**
+     * @brief Resize the file and the mapping to `new_bytes`.
+     *
+     * A larger file is extended before it is mapped; a smaller one is
+     * truncated after the tail is unmapped. The access pattern is applied
+     * to the new mapping.
+     *
+     * @par Exception Safety
+     * - Strong: on failure the mapping is unchanged (the file keeps any
+     *   extension, which is never mapped and trimmed on close).
+     */
+    void remap(const std::size_t new_bytes) {
+        if (new_bytes == mapped_bytes_)
+            return;
+
+        if (new_bytes > mapped_bytes_ &&
+            ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0)
+            throwSystemError("ftruncate");
+
+        void* mapping = nullptr;
+        if (new_bytes == 0) {
+            ::munmap(data_, mapped_bytes_);
+        } else if (mapped_bytes_ == 0) {
+            mapping = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd_, 0);
+        } else {
+#ifdef MREMAP_MAYMOVE
+            mapping = ::mremap(data_, mapped_bytes_, new_bytes, MREMAP_MAYMOVE);
+#else
+            mapping = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd_, 0);
+            if (mapping != MAP_FAILED)
+                ::munmap(data_, mapped_bytes_);
+#endif
+        }
+        if (mapping == MAP_FAILED)
+            throwSystemError("mmap");
+
+        if (new_bytes < mapped_bytes_)
+            ::ftruncate(fd_, static_cast<off_t>(new_bytes));
+
+        data_ = static_cast<Type*>(mapping);
+        mapped_bytes_ = new_bytes;
+        capacity_ = new_bytes / sizeof(Type);
+        if (data_ != nullptr && pattern_ != AccessPattern::NORMAL)
+            ::madvise(data_, mapped_bytes_, adviceFor(pattern_));
+    }
+
+
+    /// Map room for at least `required` elements, rounded up to whole pages.
+    void resize(const std::size_t required) {
+        if (required > MAX_CAPACITY)
+            throw std::length_error("MappedDynamicArray capacity limit");
+
+        const std::size_t page = pageSize();
+        const std::size_t bytes = required * sizeof(Type);
+        remap(bytes == 0 ? 0 : (bytes + page - 1) / page * page);
+    }
+
+
+    /// Grow by doubling (at least to one page) if the array is full.
+    void ensureCapacity() {
+        requireOpen();
+        if (size_ < capacity_)
+            return;
+        if (capacity_ == MAX_CAPACITY)
+            throw std::length_error("MappedDynamicArray capacity limit");
+
+        const std::size_t doubled =
+            capacity_ > MAX_CAPACITY / 2 ? MAX_CAPACITY : 2 * capacity_;
+        resize(std::max({doubled, capacity_ + 1, pageSize() / sizeof(Type)}));
+    }
+
+
+    void requireOpen() const {
+        if (fd_ < 0)
+            throw std::logic_error("MappedDynamicArray is closed");
+    }
+
+
+    /// Unmap, trim the file to size() elements and close it. Returns false
+    /// if a system call failed (errno tells which).
+    bool release() noexcept {
+        if (fd_ < 0)
+            return true;
+
+        bool ok = true;
+        if (mapped_bytes_ != 0)
+            ok = ::munmap(data_, mapped_bytes_) == 0;
+        ok = ::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(Type))) == 0 &&
+             ok;
+        ok = ::close(fd_) == 0 && ok;
+
+        fd_ = -1;
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+        mapped_bytes_ = 0;
+        return ok;
+    }
+
+
+  public:
+    /**
+     * @brief Create an empty array backed by the file at `path`.
+     *
+     * An existing file is truncated.
+     *
+     * @throws std::system_error If the file cannot be created.
+     */
+    static MappedDynamicArray create(const std::filesystem::path& path) {
+        return MappedDynamicArray(openFile(path, O_RDWR | O_CREAT | O_TRUNC),
+                                  path);
+    }
+
+
+    /**
+     * @brief Open the array stored in the file at `path`, without reading
+     * it: the file is mapped and its pages are loaded on first access.
+     *
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @throws std::invalid_argument If the file size is not a multiple of
+     * sizeof(Type).
+     */
+    static MappedDynamicArray open(const std::filesystem::path& path) {
+        // Validated on the bare descriptor: an array object trims its file
+        // to size() when it is destroyed, which would wipe a rejected file
+        const int fd = openFile(path, O_RDWR);
+        struct stat status {};
+        if (::fstat(fd, &status) != 0) {
+            const int error = errno;
+            ::close(fd);
+            errno = error;
+            throwSystemError("fstat");
+        }
+
+        const auto file_bytes = static_cast<std::size_t>(status.st_size);
+        if (file_bytes % sizeof(Type) != 0) {
+            ::close(fd);
+            throw std::invalid_argument("File size is not a multiple of the "
+                                        "element size");
+        }
+
+        // Counted before mapping, so a failed mapping leaves the file whole
+        MappedDynamicArray array(fd, path);
+        array.size_ = file_bytes / sizeof(Type);
+        array.remap(file_bytes);
+        return array;
+    }
+
+
+    MappedDynamicArray(const MappedDynamicArray&) = delete;
+    MappedDynamicArray& operator=(const MappedDynamicArray&) = delete;
+
+    /// Move constructor; the file changes hands.
+    MappedDynamicArray(MappedDynamicArray&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          mapped_bytes_(std::exchange(other.mapped_bytes_, 0)),
+          pattern_(other.pattern_), path_(std::move(other.path_)) {}
+
+    /// Move assignment operator; closes this array's file first.
+    MappedDynamicArray& operator=(MappedDynamicArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            fd_ = std::exchange(other.fd_, -1);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+            mapped_bytes_ = std::exchange(other.mapped_bytes_, 0);
+            pattern_ = other.pattern_;
+            path_ = std::move(other.path_);
+        }
+        return *this;
+    }
+
+
+    /// Closes the file like close(), ignoring errors.
+    ~MappedDynamicArray() noexcept { release(); }
+
+
+    /**
+     * @brief Unmap the array and trim the file to size() elements.
+     *
+     * The array is empty and closed afterwards; open() the file to use it
+     * again. Closing a closed array does nothing.
+     *
+     * @throws std::system_error If a system call fails (the array is closed
+     * anyway).
+     */
+    void close() {
+        if (!release())
+            throwSystemError("close");
+    }
+
+
+    /// Checks if the array has a file.
+    [[nodiscard]]
+    bool isOpen() const noexcept {
+        return fd_ >= 0;
+    }
+
+    /// The backing file.
+    [[nodiscard]]
+    const std::filesystem::path& path() const noexcept {
+        return path_;
+    }
+
+    /// Returns the number of elements.
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Returns the number of elements the mapping has room for.
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Checks if the array is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+
+    /**
+     * @brief Append an element, growing the file if the array is full.
+     *
+     * @throws std::system_error If the file cannot be grown.
+     * @throws std::logic_error If the array is closed.
+     */
+    void addLast(const Type& element) {
+        ensureCapacity();
+        ::new (static_cast<void*>(data_ + size_)) Type(element);
+        ++size_;
+    }
+
+
+    /// Construct an element at the end; see addLast().
+    template <typename... Args>
+    void emplaceLast(Args&&... args) {
+        ensureCapacity();
+        ::new (static_cast<void*>(data_ + size_))
+            Type(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+
+    /**
+     * @brief Remove and return the last element. The file keeps its length
+     * until shrinkToFit() or close().
+     *
+     * @throws std::out_of_range If the array is empty.
+     */
+    Type removeLast() {
+        if (size_ == 0)
+            throw std::out_of_range("Index out of range");
+        return data_[--size_];
+    }
+
+
+    /// Remove all elements (capacity unchanged).
+    void removeAll() noexcept { size_ = 0; }
+
+
+    /// Bounds-checked access; throws std::out_of_range if idx >= size().
+    Type& get(const std::size_t idx) {
+        if (idx >= size_)
+            throw std::out_of_range("Index out of range");
+        return data_[idx];
+    }
+
+    const Type& get(const std::size_t idx) const {
+        if (idx >= size_)
+            throw std::out_of_range("Index out of range");
+        return data_[idx];
+    }
+
+    /// Unchecked access (idx < size()).
+    Type& getUnchecked(const std::size_t idx) noexcept { return data_[idx]; }
+
+    const Type& getUnchecked(const std::size_t idx) const noexcept {
+        return data_[idx];
+    }
+
+    /// Bounds-checked access, as get().
+    Type& operator[](const std::size_t idx) { return get(idx); }
+    const Type& operator[](const std::size_t idx) const { return get(idx); }
+
+
+    /**
+     * @brief Make room for at least `new_capacity` elements.
+     *
+     * @throws std::system_error If the file cannot be grown.
+     * @throws std::logic_error If the array is closed.
+     */
+    void reserve(const std::size_t new_capacity) {
+        requireOpen();
+        if (new_capacity > capacity_)
+            resize(new_capacity);
+    }
+
+
+    /// Shrink the file and the mapping to the pages size() elements need.
+    void shrinkToFit() {
+        requireOpen();
+        resize(size_);
+    }
+
+
+    /**
+     * @brief Tell the kernel how the array will be accessed (madvise).
+     *
+     * The pattern is kept and applied again whenever the mapping grows.
+     * WILL_NEED and DONT_NEED act on the pages mapped now.
+     *
+     * @throws std::system_error If madvise fails.
+     */
+    void advise(const AccessPattern pattern) {
+        pattern_ = pattern;
+        if (mapped_bytes_ != 0 &&
+            ::madvise(data_, mapped_bytes_, adviceFor(pattern)) != 0)
+            throwSystemError("madvise");
+    }
+
+
+    /**
+     * @brief Write the dirty pages of the elements back to the file and wait
+     * for the writes to finish (msync).
+     *
+     * @throws std::system_error If msync fails.
+     */
+    void sync() {
+        if (size_ != 0 && ::msync(data_, size_ * sizeof(Type), MS_SYNC) != 0)
+            throwSystemError("msync");
+    }
+
+
+    /**
+     * @brief Pointer to the first element of the mapping.
+     *
+     * nullptr while nothing is mapped.
+     */
+    Type* data() noexcept { return data_; }
+    const Type* data() const noexcept { return data_; }
+
+
+    /// View over the elements; the entry point for the algorithms.
+    std::span<Type> span() noexcept { return {data_, size_}; }
+    std::span<const Type> span() const noexcept { return {data_, size_}; }
+
+
+    // --- Iterator support for range-based for loops ---
+
+    Type* begin() noexcept { return data_; }
+    const Type* begin() const noexcept { return data_; }
+
+    Type* end() noexcept { return data_ ? data_ + size_ : data_; }
+    const Type* end() const noexcept { return data_ ? data_ + size_ : data_; }
+};
+
+} // namespace data_structs
+
+#endif // MAPPED_DYNAMIC_ARRAY_HPP
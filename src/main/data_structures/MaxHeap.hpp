@@ -22,6 +22,7 @@ namespace data_structs {
  * heapify.
  *
  * @tparam Type Element type.
+ * @tparam Allocator Node allocator; see BinaryTree.
  *
  * @par Type requirements
  * - `Type` must be MoveConstructible or CopyConstructible (node storage/moves).
@@ -48,8 +49,11 @@ namespace data_structs {
  *   Provides the **basic** guarantee (structure remains valid; values may be
  *   partially moved if `Type` move/assign throws).
  */
-template <typename Type>
-class MaxHeap final : public Heap<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class MaxHeap final : public Heap<Type, Allocator> {
+
+    using Base = Heap<Type, Allocator>;
+
 
     /**
      * Restores the max-heap property by moving the given node upwards.
@@ -101,9 +105,19 @@ class MaxHeap final : public Heap<Type> {
     }
 
 
+  protected:
+    [[nodiscard]]
+    SerializedKind serializedKind() const noexcept override {
+        return SerializedKind::MAX_HEAP;
+    }
+
+
   public:
     /// Default constructor
-    MaxHeap() : Heap<Type>() {}
+    MaxHeap() : Base() {}
+
+    /// Creates an empty heap whose nodes come from `allocator`.
+    explicit MaxHeap(const Allocator& allocator) noexcept : Base(allocator) {}
 
     /**
      * Constructs a MaxHeap from an array of elements. Each element is inserted
@@ -112,27 +126,31 @@ class MaxHeap final : public Heap<Type> {
      * @param array Pointer to the array of elements to be inserted into the
      * heap.
      * @param size The number of elements in the array.
+     * @param allocator Source of the heap's nodes.
      */
-    MaxHeap(const Type* array, const std::size_t size) : Heap<Type>() {
+    MaxHeap(const Type* array, const std::size_t size,
+            const Allocator& allocator = Allocator())
+        : Base(allocator) {
         for (std::size_t i = 0; i < size; ++i)
             insert(array[i]);
     }
 
     /// Copy constructor
-    MaxHeap(const MaxHeap& other) : Heap<Type>(other) {}
+    MaxHeap(const MaxHeap& other) : Base(other) {}
 
     /// Move constructor
-    MaxHeap(MaxHeap&& other) noexcept : Heap<Type>(std::move(other)) {}
+    MaxHeap(MaxHeap&& other) noexcept : Base(std::move(other)) {}
 
     /// Copy assignment operator
     MaxHeap& operator=(const MaxHeap& other) {
-        Heap<Type>::operator=(other);
+        Base::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
-    MaxHeap& operator=(MaxHeap&& other) noexcept {
-        Heap<Type>::operator=(std::move(other));
+    MaxHeap& operator=(MaxHeap&& other) noexcept(
+        Base::NOTHROW_MOVE_ASSIGNABLE) {
+        Base::operator=(std::move(other));
         return *this;
     }
 
@@ -158,7 +176,7 @@ class MaxHeap final : public Heap<Type> {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = this->createNode(std::forward<U>(element));
 
         if (this->isEmpty()) {
             this->root_ = newNode;
@@ -187,9 +205,37 @@ class MaxHeap final : public Heap<Type> {
     }
 
 
+    /**
+     * Reads a heap written by serialize(). The nodes are linked back into
+     * their complete-tree positions in O(n), without heapify; the shape and
+     * ordering are verified once afterwards.
+     *
+     * @throws std::runtime_error If the data is not a serialized MaxHeap of
+     * Type, is corrupt, or violates the heap property.
+     */
+    static MaxHeap deserialize(std::istream& in,
+                              const Allocator& allocator = Allocator()) {
+        MaxHeap heap(allocator);
+        heap.readTree(in, SerializedKind::MAX_HEAP);
+        if (!heap.isCompleteTree() || !heap.isValidHeap())
+            throw std::runtime_error("Serialized tree is not a valid heap");
+        return heap;
+    }
+
+
     ~MaxHeap() override = default;
 };
 
+
+namespace pmr {
+
+/// MaxHeap whose nodes come from a std::pmr::memory_resource.
+template <typename Type>
+using MaxHeap =
+    data_structs::MaxHeap<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // MAXHEAP_HPP
@@ -19,6 +19,7 @@ namespace data_structs {
  * (Duplicates are allowed; equality is permitted.)
  *
  * @tparam Type Element type.
+ * @tparam Allocator Node allocator; see BinaryTree.
  *
  * @section ordering Ordering & requirements
  * - Ordering uses `operator<` on `Type` (strict weak ordering assumed).
@@ -44,8 +45,11 @@ namespace data_structs {
  * - **Basic guarantee**: tree shape remains valid; values may be partially
  * moved if `Type` operations throw during reheapification.
  */
-template <typename Type>
-class MinHeap final : public Heap<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class MinHeap final : public Heap<Type, Allocator> {
+
+    using Base = Heap<Type, Allocator>;
+
 
     /**
      * Restores the min-heap property by moving the given node upwards.
@@ -97,9 +101,19 @@ class MinHeap final : public Heap<Type> {
     }
 
 
+  protected:
+    [[nodiscard]]
+    SerializedKind serializedKind() const noexcept override {
+        return SerializedKind::MIN_HEAP;
+    }
+
+
   public:
     /// Default constructor
-    MinHeap() : Heap<Type>() {}
+    MinHeap() : Base() {}
+
+    /// Creates an empty heap whose nodes come from `allocator`.
+    explicit MinHeap(const Allocator& allocator) noexcept : Base(allocator) {}
 
     /**
      * Constructs a MinHeap from an array of elements.
@@ -110,27 +124,31 @@ class MinHeap final : public Heap<Type> {
      * @param array Pointer to the array of elements to be inserted into the
      * heap.
      * @param size The number of elements in the array.
+     * @param allocator Source of the heap's nodes.
      */
-    MinHeap(const Type* array, const std::size_t size) : Heap<Type>() {
+    MinHeap(const Type* array, const std::size_t size,
+            const Allocator& allocator = Allocator())
+        : Base(allocator) {
         for (std::size_t i = 0; i < size; ++i)
             insert(array[i]);
     }
 
     /// Copy constructor
-    MinHeap(const MinHeap& other) : Heap<Type>(other) {}
+    MinHeap(const MinHeap& other) : Base(other) {}
 
     /// Move constructor
-    MinHeap(MinHeap&& other) noexcept : Heap<Type>(std::move(other)) {}
+    MinHeap(MinHeap&& other) noexcept : Base(std::move(other)) {}
 
     /// Copy assignment operator
     MinHeap& operator=(const MinHeap& other) {
-        Heap<Type>::operator=(other);
+        Base::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
-    MinHeap& operator=(MinHeap&& other) noexcept {
-        Heap<Type>::operator=(std::move(other));
+    MinHeap& operator=(MinHeap&& other) noexcept(
+        Base::NOTHROW_MOVE_ASSIGNABLE) {
+        Base::operator=(std::move(other));
         return *this;
     }
 
@@ -157,7 +175,7 @@ class MinHeap final : public Heap<Type> {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = this->createNode(std::forward<U>(element));
 
         if (this->isEmpty()) {
             this->root_ = newNode;
@@ -186,9 +204,37 @@ class MinHeap final : public Heap<Type> {
     }
 
 
+    /**
+     * Reads a heap written by serialize(). The nodes are linked back into
+     * their complete-tree positions in O(n), without heapify; the shape and
+     * ordering are verified once afterwards.
+     *
+     * @throws std::runtime_error If the data is not a serialized MinHeap of
+     * Type, is corrupt, or violates the heap property.
+     */
+    static MinHeap deserialize(std::istream& in,
+                              const Allocator& allocator = Allocator()) {
+        MinHeap heap(allocator);
+        heap.readTree(in, SerializedKind::MIN_HEAP);
+        if (!heap.isCompleteTree() || !heap.isValidHeap())
+            throw std::runtime_error("Serialized tree is not a valid heap");
+        return heap;
+    }
+
+
     ~MinHeap() override = default;
 };
 
+
+namespace pmr {
+
+/// MinHeap whose nodes come from a std::pmr::memory_resource.
+template <typename Type>
+using MinHeap =
+    data_structs::MinHeap<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // MINHEAP_HPP
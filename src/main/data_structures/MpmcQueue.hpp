@@ -0,0 +1,826 @@
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace data_structs {
+
+
+/**
+ * @class QueueWaiters
+ * @brief Parks the threads that wait on one side of a lock-free queue (for
+ * an element, or for a free slot) and wakes them when the other side makes
+ * progress.
+ *
+ * A waiter spins a few attempts first, then announces itself in a counter
+ * and retries under a mutex before sleeping on a condition variable. The
+ * other side calls notifyOne() after each successful operation: a fence and
+ * a load of the counter, with the mutex taken only when somebody sleeps, so
+ * queues without waiters never touch it. The fences on both sides make sure
+ * that either the waiter's last attempt sees the new state or the notifier
+ * sees the waiter.
+ */
+class QueueWaiters {
+    static constexpr std::size_t SPIN_ATTEMPTS = 64;
+
+    std::atomic<std::size_t> waiters_{0};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+
+
+    /**
+     * @brief Call `attempt` until it returns a true-ish value, parking with
+     * `sleep(lock)` in between; `sleep` returns false once it timed out, in
+     * which case the result of one last attempt is returned.
+     */
+    template <typename Attempt, typename Sleep>
+    auto waitWith(Attempt& attempt, Sleep sleep) -> decltype(attempt()) {
+        for (std::size_t i = 0; i < SPIN_ATTEMPTS; ++i)
+            if (auto result = attempt())
+                return result;
+
+        std::unique_lock lock(mutex_);
+        waiters_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto result = attempt();
+        while (!result) {
+            const bool in_time = sleep(lock);
+            result = attempt();
+            if (!in_time)
+                break;
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+  public:
+    /// Calls `attempt` until it returns a true-ish value, and returns that.
+    template <typename Attempt>
+    auto wait(Attempt&& attempt) -> decltype(attempt()) {
+        return waitWith(attempt, [this](std::unique_lock<std::mutex>& lock) {
+            condition_.wait(lock);
+            return true;
+        });
+    }
+
+    /// Like wait(), but gives up at `deadline` and returns the last result.
+    template <typename Attempt, typename Clock, typename Duration>
+    auto waitUntil(Attempt&& attempt,
+                   const std::chrono::time_point<Clock, Duration>& deadline)
+        -> decltype(attempt()) {
+        return waitWith(attempt, [this, &deadline](
+                                     std::unique_lock<std::mutex>& lock) {
+            return condition_.wait_until(lock, deadline) ==
+                   std::cv_status::no_timeout;
+        });
+    }
+
+    /// Wakes one waiter, if there is any; call after making progress.
+    void notifyOne() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        // Taking the lock orders this wake-up after the waiter's last
+        // attempt, so the notification cannot be lost
+        { std::lock_guard lock(mutex_); }
+        condition_.notify_one();
+    }
+};
+
+
+/**
+ * @class BoundedMpmcQueue
+ * @brief Bounded lock-free FIFO queue for any number of producer and
+ * consumer threads (Vyukov's array queue).
+ *
+ * The ring has a power-of-two capacity, like Queue, and every slot carries
+ * a sequence number telling which position may use it next: a producer may
+ * fill the slot of position `p` when its sequence is `p`, and publishes the
+ * element by setting it to `p + 1`; a consumer may empty it when it is
+ * `p + 1`, and hands it to the producer of `p + capacity()` by setting it to
+ * that. Producers and consumers claim positions with a compare-and-swap on
+ * their own counter, each on its own cache line, so the two sides only meet
+ * on the slots themselves. A thread preempted between claiming a slot and
+ * handing it on holds up that slot only: the others go on around the ring
+ * until they reach it again, and until then see the queue as full (or
+ * empty) there.
+ *
+ * tryEnqueue / tryDequeue never block. enqueue / dequeue wait (spinning
+ * briefly, then sleeping) for a free slot or an element, and
+ * tryDequeueFor / tryDequeueUntil wait at most until a deadline.
+ *
+ * @tparam Type Element type; must be nothrow MoveConstructible, so that a
+ * claimed slot is always filled and an element always leaves its slot.
+ * @tparam Allocator Source of the slot array.
+ *
+ * @par Exception safety
+ * - If `Type` is not nothrow constructible from the arguments of an enqueue,
+ *   the element is built before a slot is claimed; if that throws, the
+ *   queue is unchanged. On a full queue, tryEnqueue / tryEmplace then drop
+ *   the element built from arguments it may have moved from.
+ *
+ * @par Thread-safety
+ * - Every member function may be called concurrently, except construction
+ *   and destruction. size() and isEmpty() are snapshots.
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class BoundedMpmcQueue {
+
+    static_assert(std::is_nothrow_move_constructible_v<Type>,
+                  "Type must be nothrow MoveConstructible");
+
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        alignas(Type) unsigned char storage[sizeof(Type)];
+
+        explicit Slot(const std::size_t position) noexcept
+            : sequence(position) {}
+
+        Type* element() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+    };
+
+    using SlotAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    /// Largest power-of-two capacity whose slots fit a size_t of bytes.
+    static constexpr std::size_t HARD_MAX_ELEMENTS = std::bit_floor(
+        std::numeric_limits<std::size_t>::max() / sizeof(Slot));
+
+    // Read-only after construction
+    [[no_unique_address]] SlotAllocator allocator_;
+    Slot* slots_;
+    std::size_t capacity_;
+    std::size_t mask_;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> enqueue_position_{0};
+    alignas(CACHE_LINE) std::atomic<std::size_t> dequeue_position_{0};
+
+    alignas(CACHE_LINE) QueueWaiters consumers_;
+    QueueWaiters producers_;
+
+
+    static std::size_t ringCapacity(const std::size_t capacity) {
+        if (capacity > HARD_MAX_ELEMENTS)
+            throw std::length_error("BoundedMpmcQueue capacity exceeded");
+        // A single slot could not tell "filled" from "free for the next lap"
+        return std::bit_ceil(std::max<std::size_t>(capacity, 2));
+    }
+
+
+    /// Claims the back slot and constructs the element there, unless the
+    /// queue is full. Construction must not throw.
+    template <typename... Args>
+    bool tryPush(Args&&... args) noexcept {
+        std::size_t position =
+            enqueue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[position & mask_];
+            const std::size_t sequence =
+                slot.sequence.load(std::memory_order_acquire);
+            const auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if (lag == 0) {
+                if (enqueue_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(slot.storage))
+                        Type(std::forward<Args>(args)...);
+                    slot.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                // The slot still holds the element of the previous lap
+                return false;
+            } else {
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    /// Claims the front slot and moves its element out, unless the queue is
+    /// empty.
+    std::optional<Type> tryPop() noexcept {
+        std::size_t position =
+            dequeue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[position & mask_];
+            const std::size_t sequence =
+                slot.sequence.load(std::memory_order_acquire);
+            const auto lag =
+                static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if (lag == 0) {
+                if (dequeue_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    Type* element = slot.element();
+                    std::optional<Type> result(std::move(*element));
+                    element->~Type();
+                    slot.sequence.store(position + capacity_,
+                                        std::memory_order_release);
+                    return result;
+                }
+            } else if (lag < 0) {
+                // Not yet published for this lap
+                return std::nullopt;
+            } else {
+                position = dequeue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    /// Builds the element first unless that cannot throw, so a claimed slot
+    /// is always filled.
+    template <typename Push, typename... Args>
+    bool pushWith(Push push, Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<Type, Args&&...>) {
+            return push(std::forward<Args>(args)...);
+        } else {
+            Type element(std::forward<Args>(args)...);
+            return push(std::move(element));
+        }
+    }
+
+
+    /// Result of a waiting dequeue; passes the wake-up on if elements remain.
+    std::optional<Type> afterWaitingPop(std::optional<Type> result) {
+        if (result) {
+            producers_.notifyOne();
+            if (!isEmpty())
+                consumers_.notifyOne();
+        }
+        return result;
+    }
+
+
+  public:
+    /**
+     * @brief Create an empty queue holding up to `capacity` elements,
+     * rounded up to a power of two (at least 2).
+     *
+     * @throws std::length_error If the rounded capacity does not fit.
+     * @throws std::bad_alloc If the slots cannot be allocated.
+     */
+    explicit BoundedMpmcQueue(const std::size_t capacity,
+                              const Allocator& allocator = Allocator())
+        : allocator_(allocator), slots_(nullptr),
+          capacity_(ringCapacity(capacity)), mask_(capacity_ - 1) {
+        slots_ = SlotTraits::allocate(allocator_, capacity_);
+        for (std::size_t i = 0; i < capacity_; ++i)
+            ::new (static_cast<void*>(slots_ + i)) Slot(i);
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    /// Destroys the remaining elements; no other thread may still use it.
+    ~BoundedMpmcQueue() {
+        const std::size_t end =
+            enqueue_position_.load(std::memory_order_relaxed);
+        for (std::size_t position =
+                 dequeue_position_.load(std::memory_order_relaxed);
+             position != end; ++position)
+            slots_[position & mask_].element()->~Type();
+        for (std::size_t i = 0; i < capacity_; ++i)
+            slots_[i].~Slot();
+        SlotTraits::deallocate(allocator_, slots_, capacity_);
+    }
+
+
+    /// Maximum number of elements (a power of two).
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Number of elements, counting those still being enqueued or dequeued;
+    /// a snapshot under concurrent use.
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        // Dequeue first: the enqueue counter read later is never behind it
+        const std::size_t dequeued =
+            dequeue_position_.load(std::memory_order_acquire);
+        const std::size_t enqueued =
+            enqueue_position_.load(std::memory_order_acquire);
+        return std::min(enqueued - dequeued, capacity_);
+    }
+
+    /// True if no element is ready at the front; a snapshot under
+    /// concurrent use.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        const std::size_t position =
+            dequeue_position_.load(std::memory_order_acquire);
+        return slots_[position & mask_].sequence.load(
+                   std::memory_order_acquire) != position + 1;
+    }
+
+
+    /**
+     * @brief Construct an element from `args` at the back, unless the queue
+     * is full.
+     *
+     * @return False if the queue is full.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const bool pushed = pushWith(
+            [this](auto&&... forwarded) {
+                return tryPush(std::forward<decltype(forwarded)>(forwarded)...);
+            },
+            std::forward<Args>(args)...);
+        if (pushed)
+            consumers_.notifyOne();
+        return pushed;
+    }
+
+
+    /// Append `element` at the back, unless the queue is full.
+    template <typename U>
+    bool tryEnqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        return tryEmplace(std::forward<U>(element));
+    }
+
+
+    /// Construct an element from `args` at the back, waiting for a free
+    /// slot while the queue is full.
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        pushWith(
+            [this](auto&&... forwarded) {
+                // Forwarding on every attempt is safe: tryPush consumes the
+                // arguments only once it has claimed a slot
+                producers_.wait([&] {
+                    return tryPush(
+                        std::forward<decltype(forwarded)>(forwarded)...);
+                });
+                // Several slots may have been freed for one wake-up
+                if (size() < capacity_)
+                    producers_.notifyOne();
+                return true;
+            },
+            std::forward<Args>(args)...);
+        consumers_.notifyOne();
+    }
+
+
+    /// Append `element` at the back, waiting for a free slot while the
+    /// queue is full.
+    template <typename U>
+    void enqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        emplace(std::forward<U>(element));
+    }
+
+
+    /// Remove the front element, or return std::nullopt if the queue is
+    /// empty.
+    std::optional<Type> tryDequeue() {
+        std::optional<Type> result = tryPop();
+        if (result)
+            producers_.notifyOne();
+        return result;
+    }
+
+
+    /// Remove the front element, waiting for one while the queue is empty.
+    Type dequeue() {
+        return std::move(*afterWaitingPop(
+            consumers_.wait([this] { return tryPop(); })));
+    }
+
+
+    /**
+     * @brief Remove the front element, waiting until `deadline` at most.
+     *
+     * @return The element, or std::nullopt if the queue stayed empty.
+     */
+    template <typename Clock, typename Duration>
+    std::optional<Type>
+    tryDequeueUntil(const std::chrono::time_point<Clock, Duration>& deadline) {
+        return afterWaitingPop(
+            consumers_.waitUntil([this] { return tryPop(); }, deadline));
+    }
+
+
+    /// Like tryDequeueUntil(), waiting `timeout` at most.
+    template <typename Rep, typename Period>
+    std::optional<Type>
+    tryDequeueFor(const std::chrono::duration<Rep, Period>& timeout) {
+        return tryDequeueUntil(std::chrono::steady_clock::now() + timeout);
+    }
+};
+
+
+/**
+ * @class UnboundedMpmcQueue
+ * @brief Unbounded lock-free FIFO queue for any number of producer and
+ * consumer threads, built from linked fixed-size segments.
+ *
+ * Each segment is an array of `SegmentCapacity` slots that is filled and
+ * drained once, front to back: producers claim slots with a fetch-and-add on
+ * the tail segment's enqueue index and publish each element with a ready
+ * flag; consumers claim published slots with a compare-and-swap on the head
+ * segment's dequeue index. A producer that finds the tail segment full links
+ * a new one; a consumer that drains the head segment unlinks it.
+ *
+ * Threads pin the segment they work on with a reference count that is
+ * validated against the head/tail pointer, so an unlinked segment is only
+ * reused once nobody holds it. Drained segments go to a free list and are
+ * reused for new tail segments: after a warm-up the queue allocates nothing,
+ * and it keeps the segments of its largest backlog until it is destroyed
+ * (a stale pointer to a segment must stay safe to dereference).
+ *
+ * enqueue / emplace never block. dequeue waits (spinning briefly, then
+ * sleeping) for an element, tryDequeue never waits, and tryDequeueFor /
+ * tryDequeueUntil wait at most until a deadline.
+ *
+ * @tparam Type Element type; must be nothrow MoveConstructible.
+ * @tparam SegmentCapacity Slots per segment.
+ * @tparam Allocator Source of the segments.
+ *
+ * @par Exception safety
+ * - enqueue / emplace throw std::bad_alloc if a new segment cannot be
+ *   allocated, and propagate exceptions from constructing `Type` (which is
+ *   then built before a slot is claimed); the queue is unchanged either way.
+ *
+ * @par Thread-safety
+ * - Every member function may be called concurrently, except construction
+ *   and destruction. isEmpty() is a snapshot.
+ */
+template <typename Type, std::size_t SegmentCapacity = 1024,
+          typename Allocator = std::allocator<Type>>
+class UnboundedMpmcQueue {
+
+    static_assert(std::is_nothrow_move_constructible_v<Type>,
+                  "Type must be nothrow MoveConstructible");
+    static_assert(SegmentCapacity > 0, "Segments need at least one slot");
+
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    /// Set in a segment's reference count once it has been unlinked.
+    static constexpr std::size_t RETIRED =
+        std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 1);
+
+    struct Slot {
+        std::atomic<bool> ready{false};
+        alignas(Type) unsigned char storage[sizeof(Type)];
+
+        Type* element() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+    };
+
+    struct Segment {
+        /// Slots claimed by producers; grows past SegmentCapacity when full.
+        alignas(CACHE_LINE) std::atomic<std::size_t> enqueue_index{0};
+        alignas(CACHE_LINE) std::atomic<std::size_t> dequeue_index{0};
+        /// Threads holding the segment, plus RETIRED once unlinked.
+        alignas(CACHE_LINE) std::atomic<std::size_t> references{0};
+        std::atomic<Segment*> next{nullptr};
+        /// Link in the free list; guarded by its mutex.
+        Segment* free_next = nullptr;
+        Slot slots[SegmentCapacity];
+
+        /// Prepares a drained segment for reuse. The reference count is
+        /// left alone: stale threads may still briefly touch it.
+        void reset() noexcept {
+            enqueue_index.store(0, std::memory_order_relaxed);
+            dequeue_index.store(0, std::memory_order_relaxed);
+            next.store(nullptr, std::memory_order_relaxed);
+            for (Slot& slot : slots)
+                slot.ready.store(false, std::memory_order_relaxed);
+        }
+    };
+
+    using SegmentAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Segment>;
+    using SegmentTraits = std::allocator_traits<SegmentAllocator>;
+
+    [[no_unique_address]] SegmentAllocator allocator_;
+
+    alignas(CACHE_LINE) std::atomic<Segment*> head_;
+    alignas(CACHE_LINE) std::atomic<Segment*> tail_;
+
+    alignas(CACHE_LINE) std::mutex free_mutex_;
+    Segment* free_list_ = nullptr;
+
+    QueueWaiters consumers_;
+
+
+    Segment* allocateSegment() {
+        Segment* segment = SegmentTraits::allocate(allocator_, 1);
+        return ::new (static_cast<void*>(segment)) Segment();
+    }
+
+
+    void deallocateSegment(Segment* segment) noexcept {
+        segment->~Segment();
+        SegmentTraits::deallocate(allocator_, segment, 1);
+    }
+
+
+    /// A clean segment from the free list, or a new one.
+    Segment* obtainSegment() {
+        Segment* segment = nullptr;
+        {
+            std::lock_guard lock(free_mutex_);
+            segment = free_list_;
+            if (segment != nullptr)
+                free_list_ = segment->free_next;
+        }
+        if (segment == nullptr)
+            return allocateSegment();
+        segment->reset();
+        return segment;
+    }
+
+
+    void recycleSegment(Segment* segment) {
+        std::lock_guard lock(free_mutex_);
+        segment->free_next = free_list_;
+        free_list_ = segment;
+    }
+
+
+    /**
+     * @brief Pin the segment `source` points to.
+     *
+     * The count is raised before the pointer is checked again, so a segment
+     * that is still current when the check passes cannot be reused until
+     * releaseSegment().
+     */
+    Segment* acquireSegment(const std::atomic<Segment*>& source) {
+        while (true) {
+            Segment* segment = source.load(std::memory_order_seq_cst);
+            segment->references.fetch_add(1, std::memory_order_seq_cst);
+            if (source.load(std::memory_order_seq_cst) == segment)
+                return segment;
+            releaseSegment(segment);
+        }
+    }
+
+
+    /// Unpin `segment`; the last holder of an unlinked segment recycles it.
+    void releaseSegment(Segment* segment) {
+        if (segment->references.fetch_sub(1, std::memory_order_acq_rel) !=
+            RETIRED + 1)
+            return;
+
+        // A stale pin may come and go meanwhile; exactly one thread wins
+        std::size_t expected = RETIRED;
+        if (segment->references.compare_exchange_strong(
+                expected, 0, std::memory_order_acq_rel))
+            recycleSegment(segment);
+    }
+
+
+    /// Claims a slot in the tail segment and constructs the element there,
+    /// linking a new segment when the tail is full. Construction must not
+    /// throw.
+    template <typename... Args>
+    void push(Args&&... args) {
+        while (true) {
+            Segment* segment = acquireSegment(tail_);
+            const std::size_t index =
+                segment->enqueue_index.fetch_add(1, std::memory_order_relaxed);
+            if (index < SegmentCapacity) {
+                Slot& slot = segment->slots[index];
+                ::new (static_cast<void*>(slot.storage))
+                    Type(std::forward<Args>(args)...);
+                slot.ready.store(true, std::memory_order_release);
+                releaseSegment(segment);
+                return;
+            }
+
+            Segment* next = segment->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                Segment* fresh = nullptr;
+                try {
+                    fresh = obtainSegment();
+                } catch (...) {
+                    releaseSegment(segment);
+                    throw;
+                }
+                if (segment->next.compare_exchange_strong(
+                        next, fresh, std::memory_order_acq_rel))
+                    next = fresh;
+                else
+                    recycleSegment(fresh);
+            }
+
+            Segment* expected = segment;
+            tail_.compare_exchange_strong(expected, next,
+                                          std::memory_order_seq_cst);
+            releaseSegment(segment);
+        }
+    }
+
+
+    /// Claims the front slot and moves its element out, unless no element
+    /// is ready there.
+    std::optional<Type> tryPop() {
+        while (true) {
+            Segment* segment = acquireSegment(head_);
+            std::size_t index =
+                segment->dequeue_index.load(std::memory_order_relaxed);
+            while (index < SegmentCapacity) {
+                Slot& slot = segment->slots[index];
+                if (!slot.ready.load(std::memory_order_acquire)) {
+                    releaseSegment(segment);
+                    return std::nullopt;
+                }
+                if (segment->dequeue_index.compare_exchange_weak(
+                        index, index + 1, std::memory_order_relaxed)) {
+                    Type* element = slot.element();
+                    std::optional<Type> result(std::move(*element));
+                    element->~Type();
+                    releaseSegment(segment);
+                    return result;
+                }
+            }
+
+            // Drained; move on unless it is the last segment
+            Segment* next = segment->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                releaseSegment(segment);
+                return std::nullopt;
+            }
+
+            unlinkHead(segment, next);
+            releaseSegment(segment);
+        }
+    }
+
+
+    /// Moves the head from the drained, pinned `segment` to `next`; the
+    /// thread that succeeds marks `segment` retired.
+    void unlinkHead(Segment* segment, Segment* next) noexcept {
+        // The tail must not stay behind on a segment about to be reused
+        Segment* expected = segment;
+        tail_.compare_exchange_strong(expected, next,
+                                      std::memory_order_seq_cst);
+        expected = segment;
+        if (head_.compare_exchange_strong(expected, next,
+                                          std::memory_order_seq_cst))
+            segment->references.fetch_add(RETIRED, std::memory_order_seq_cst);
+    }
+
+
+    /// Result of a waiting dequeue; passes the wake-up on if elements remain.
+    std::optional<Type> afterWaitingPop(std::optional<Type> result) {
+        if (result && !isEmpty())
+            consumers_.notifyOne();
+        return result;
+    }
+
+
+  public:
+    /// Creates an empty queue with one segment from `allocator`.
+    explicit UnboundedMpmcQueue(const Allocator& allocator = Allocator())
+        : allocator_(allocator) {
+        Segment* first = allocateSegment();
+        head_.store(first, std::memory_order_relaxed);
+        tail_.store(first, std::memory_order_relaxed);
+    }
+
+    UnboundedMpmcQueue(const UnboundedMpmcQueue&) = delete;
+    UnboundedMpmcQueue& operator=(const UnboundedMpmcQueue&) = delete;
+
+    /// Destroys the remaining elements and every segment; no other thread
+    /// may still use the queue.
+    ~UnboundedMpmcQueue() {
+        Segment* segment = head_.load(std::memory_order_relaxed);
+        while (segment != nullptr) {
+            const std::size_t end = std::min(
+                segment->enqueue_index.load(std::memory_order_relaxed),
+                SegmentCapacity);
+            for (std::size_t i =
+                     segment->dequeue_index.load(std::memory_order_relaxed);
+                 i < end; ++i)
+                segment->slots[i].element()->~Type();
+
+            Segment* next = segment->next.load(std::memory_order_relaxed);
+            deallocateSegment(segment);
+            segment = next;
+        }
+
+        while (free_list_ != nullptr)
+            deallocateSegment(std::exchange(free_list_, free_list_->free_next));
+    }
+
+
+    /// True if no element is ready at the front; a snapshot under
+    /// concurrent use.
+    [[nodiscard]]
+    bool isEmpty() {
+        while (true) {
+            Segment* segment = acquireSegment(head_);
+            const std::size_t index =
+                segment->dequeue_index.load(std::memory_order_acquire);
+            if (index < SegmentCapacity) {
+                const bool empty = !segment->slots[index].ready.load(
+                    std::memory_order_acquire);
+                releaseSegment(segment);
+                return empty;
+            }
+
+            Segment* next = segment->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+                unlinkHead(segment, next);
+            releaseSegment(segment);
+            if (next == nullptr)
+                return true;
+        }
+    }
+
+
+    /**
+     * @brief Construct an element from `args` at the back.
+     *
+     * @throws std::bad_alloc If a new segment is needed and cannot be
+     * allocated.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<Type, Args&&...>) {
+            push(std::forward<Args>(args)...);
+        } else {
+            Type element(std::forward<Args>(args)...);
+            push(std::move(element));
+        }
+        consumers_.notifyOne();
+    }
+
+
+    /// Append `element` at the back.
+    template <typename U>
+    void enqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        emplace(std::forward<U>(element));
+    }
+
+
+    /// Remove the front element, or return std::nullopt if the queue is
+    /// empty.
+    std::optional<Type> tryDequeue() { return tryPop(); }
+
+
+    /// Remove the front element, waiting for one while the queue is empty.
+    Type dequeue() {
+        return std::move(*afterWaitingPop(
+            consumers_.wait([this] { return tryPop(); })));
+    }
+
+
+    /**
+     * @brief Remove the front element, waiting until `deadline` at most.
+     *
+     * @return The element, or std::nullopt if the queue stayed empty.
+     */
+    template <typename Clock, typename Duration>
+    std::optional<Type>
+    tryDequeueUntil(const std::chrono::time_point<Clock, Duration>& deadline) {
+        return afterWaitingPop(
+            consumers_.waitUntil([this] { return tryPop(); }, deadline));
+    }
+
+
+    /// Like tryDequeueUntil(), waiting `timeout` at most.
+    template <typename Rep, typename Period>
+    std::optional<Type>
+    tryDequeueFor(const std::chrono::duration<Rep, Period>& timeout) {
+        return tryDequeueUntil(std::chrono::steady_clock::now() + timeout);
+    }
+};
+
+} // namespace data_structs
+
+#endif // MPMC_QUEUE_HPP
@@ -0,0 +1,242 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+
+namespace data_structs {
+
+
+/**
+ * @class NodePool
+ * @brief Fixed-size slab allocator for the nodes of one linked container.
+ *
+ * Node storage is carved out of chunks obtained from the container's
+ * allocator. Freed slots go onto an intrusive free list and are handed out
+ * again before any new slot, so once a container has reached its working
+ * size, inserting and removing nodes never calls the allocator. Fresh slots
+ * are taken from the newest chunk in address order, which keeps nodes
+ * created one after another next to each other in memory.
+ *
+ * The first chunk holds a handful of slots and every further chunk twice as
+ * many, up to one page (or one slot, if a node is larger than a page); small
+ * containers therefore do not pay for a whole page.
+ *
+ * The pool only manages storage: allocate() returns raw memory for one Node
+ * and deallocate() takes it back without running any destructor. release()
+ * hands every chunk back to the allocator at once, regardless of how many
+ * nodes are still in them, so a container whose nodes need no destructor
+ * call can be cleared in O(chunks).
+ *
+ * @tparam Node Node type stored in the pool.
+ * @tparam Allocator std::allocator-compatible allocator; rebound internally
+ * to the chunk slot type.
+ *
+ * @par Complexity
+ * - allocate: O(1); amortized over the chunk when a new chunk is needed.
+ * - deallocate: O(1), never calls the allocator.
+ * - release: O(chunks).
+ *
+ * @par Moved-from State
+ * - A moved-from pool is valid and owns no chunks.
+ *
+ * @par Thread-safety
+ * - Not thread-safe; a pool belongs to exactly one container.
+ */
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodePool {
+
+  public:
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+
+  private:
+    /// Storage for one node, or the link of a free slot.
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    /// Bookkeeping kept in the first slot(s) of every chunk.
+    struct ChunkHeader {
+        Slot* previous;
+        std::size_t slots;
+    };
+
+    using SlotAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    static_assert(alignof(ChunkHeader) <= alignof(Slot));
+
+    static constexpr std::size_t PAGE_SIZE = 4096;
+
+    static constexpr std::size_t HEADER_SLOTS =
+        (sizeof(ChunkHeader) + sizeof(Slot) - 1) / sizeof(Slot);
+
+    static constexpr std::size_t MAX_CHUNK_SLOTS =
+        std::max(PAGE_SIZE / sizeof(Slot), HEADER_SLOTS + 1);
+
+    static constexpr std::size_t FIRST_CHUNK_SLOTS =
+        std::min(HEADER_SLOTS + 8, MAX_CHUNK_SLOTS);
+
+    [[no_unique_address]] NodeAllocator allocator_;
+
+    /// Newest chunk; each chunk header links to the one before it.
+    Slot* chunks_ = nullptr;
+
+    /// Slots returned by deallocate().
+    Slot* free_ = nullptr;
+
+    /// Never used slots [cursor_, end_) of the newest chunk.
+    Slot* cursor_ = nullptr;
+    Slot* end_ = nullptr;
+
+    std::size_t next_chunk_slots_ = FIRST_CHUNK_SLOTS;
+
+
+    static ChunkHeader* header(Slot* chunk) noexcept {
+        return std::launder(reinterpret_cast<ChunkHeader*>(chunk));
+    }
+
+
+    /// Obtain a new chunk from the allocator and make it the bump region.
+    void addChunk() {
+        SlotAllocator slot_allocator(allocator_);
+        Slot* chunk = SlotTraits::allocate(slot_allocator, next_chunk_slots_);
+        ::new (static_cast<void*>(chunk))
+            ChunkHeader{chunks_, next_chunk_slots_};
+
+        chunks_ = chunk;
+        cursor_ = chunk + HEADER_SLOTS;
+        end_ = chunk + next_chunk_slots_;
+        next_chunk_slots_ = std::min(2 * next_chunk_slots_, MAX_CHUNK_SLOTS);
+    }
+
+
+    /// Forget every chunk without releasing it.
+    void reset() noexcept {
+        chunks_ = nullptr;
+        free_ = nullptr;
+        cursor_ = nullptr;
+        end_ = nullptr;
+        next_chunk_slots_ = FIRST_CHUNK_SLOTS;
+    }
+
+
+    /// Take over other's chunks; this pool must own none.
+    void steal(NodePool& other) noexcept {
+        chunks_ = other.chunks_;
+        free_ = other.free_;
+        cursor_ = other.cursor_;
+        end_ = other.end_;
+        next_chunk_slots_ = other.next_chunk_slots_;
+        other.reset();
+    }
+
+
+  public:
+    /// Creates a pool that owns no chunks yet.
+    explicit NodePool(const Allocator& allocator) noexcept
+        : allocator_(allocator) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    NodePool& operator=(NodePool&&) = delete;
+
+    /// Move constructor; the chunks change hands together with the
+    /// allocator that can free them.
+    NodePool(NodePool&& other) noexcept
+        : allocator_(std::move(other.allocator_)) {
+        steal(other);
+    }
+
+    ~NodePool() noexcept { release(); }
+
+
+    /**
+     * @brief Storage for one node.
+     *
+     * @return Uninitialized memory suitably sized and aligned for a Node.
+     * @throws Whatever the allocator throws when a new chunk is needed; the
+     * pool is unchanged in that case.
+     */
+    [[nodiscard]]
+    Node* allocate() {
+        Slot* slot = free_;
+        if (slot != nullptr) {
+            free_ = slot->next;
+        } else {
+            if (cursor_ == end_)
+                addChunk();
+            slot = cursor_++;
+        }
+        return reinterpret_cast<Node*>(slot->storage);
+    }
+
+
+    /// Return the storage of a node (already destroyed) to the free list.
+    void deallocate(Node* node) noexcept {
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = free_;
+        free_ = slot;
+    }
+
+
+    /**
+     * @brief Give every chunk back to the allocator.
+     *
+     * Nodes still in the pool are not destroyed; call it after destroying
+     * them, or without doing so if Node is trivially destructible.
+     */
+    void release() noexcept {
+        SlotAllocator slot_allocator(allocator_);
+        while (chunks_ != nullptr) {
+            Slot* chunk = chunks_;
+            const ChunkHeader* chunk_header = header(chunk);
+            chunks_ = chunk_header->previous;
+            SlotTraits::deallocate(slot_allocator, chunk,
+                                   chunk_header->slots);
+        }
+        reset();
+    }
+
+
+    /**
+     * @brief Release this pool's chunks and take over other's.
+     *
+     * The allocators must be equal (the caller propagates the allocator
+     * first where the traits demand it), since this pool will free the
+     * chunks.
+     */
+    void adopt(NodePool& other) noexcept {
+        assert(allocator_ == other.allocator_);
+        release();
+        steal(other);
+    }
+
+
+    /// The allocator the chunks come from.
+    [[nodiscard]]
+    const NodeAllocator& getAllocator() const noexcept {
+        return allocator_;
+    }
+
+
+    /// Mutable access for allocator propagation; the pool must own no
+    /// chunks when the allocator is replaced.
+    [[nodiscard]]
+    NodeAllocator& getAllocator() noexcept {
+        return allocator_;
+    }
+};
+
+} // namespace data_structs
+
+#endif // NODE_POOL_HPP
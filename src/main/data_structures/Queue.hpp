@@ -2,12 +2,22 @@
 #define QUEUE_HPP
 
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 
 #include "DynamicArray.hpp"
+#include "Serialization.hpp"
 
 
 namespace data_structs {
@@ -16,65 +26,114 @@ namespace data_structs {
 /**
  * @class Queue
  * @brief A FIFO (first-in, first-out) container built on a growable, contiguous
- buffer.
+ * buffer.
  *
  * This template implements a queue with amortized O(1) enqueue/dequeue while
- preserving
- * insertion order. Internally it views a `DynamicArray<Type>` as a ring buffer:
- elements
- * live in one contiguous allocation; the logical front is tracked by
- `front_idx_`, and
- * the physical index of the i-th logical element is `(front_idx_ + i) %
- capacity()`.
+ * preserving insertion order. Internally it manages a raw ring buffer from its
+ * allocator whose capacity is always a power of two. Only the slots between
+ * the front and the back hold live objects: `enqueue`/`emplaceBack` construct
+ * the new element in place in the next free slot, and `dequeue` destroys the
+ * front element after moving it out. `head_` and `tail_` are free-running
+ * counters of the elements ever dequeued and enqueued (since the last
+ * rebuild): `size() == tail_ - head_`, and a counter's slot is
+ * `counter & (capacity() - 1)`, so no operation divides. The live elements
+ * form at most two contiguous segments of the buffer (see `segments()`).
  *
  * @tparam Type Element type stored by the queue.
+ * @tparam Allocator Source of the ring buffer's raw storage.
 
  * @par Performance
- * - `enqueue` / `emplaceBack`: amortized O(1); O(n) when growth occurs.
+ * - `enqueue` / `emplaceBack`: amortized O(1) for every `Type`; O(n) when
+ *   growth occurs.
  * - `dequeue`: O(1) amortized; an occasional shrink is O(n).
+ * - `enqueueRange` / `dequeueInto` / `discardFront`: O(k) for k elements,
+ *   with one capacity check per batch.
  * - `front` / `back`: O(1).
  *
  * @par Exception safety
  * - Rebuild paths (grow/shrink) use allocate+move+commit and provide the strong
  *   guarantee (the queue is unchanged on failure).
- * - In-place overwrite during enqueue uses assignment; if it throws, the queue
- *   remains valid (basic guarantee).
+ * - `enqueue` / `emplaceBack` are strong: if constructing the element throws,
+ *   the queue is unchanged.
  * - Accessors (`front`, `back`, `dequeue`) throw `std::out_of_range` on empty.
  *
  * @par Invalidation
  * - Any reallocation (growth or shrink) invalidates all references, pointers,
- and
- *   iterators. In-place overwrite does not invalidate references to that slot,
- *   but the value changes.
+ *   and iterators. Otherwise only references to a dequeued element become
+ *   invalid.
  *
  * @par Type requirements
- * - `Type` must be MoveConstructible or CopyConstructible (for relocation).
- * - MoveAssignable or CopyAssignable enables the fast in-place overwrite path.
+ * - `Type` must be MoveConstructible or CopyConstructible (for relocation);
+ *   it need not be assignable. IS_TRIVIALLY_RELOCATABLE types are relocated
+ *   with memcpy.
  *
  * @par Moved-from state
- * - A moved-from `Queue` is valid and empty (`size()==0`, `front_idx_==0`) and
- owns
- *   a fresh default-initialized `DynamicArray`.
+ * - A moved-from `Queue` is valid and empty (`size()==0`, both counters 0)
+ *   and owns no buffer (`capacity()==0`) until its next enqueue.
  *
  * @par Thread-safety
  * - Not thread-safe; external synchronization is required for concurrent use.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>>
 class Queue {
 
-    DynamicArray<Type> array_;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, Type>,
+                  "Allocator::value_type must be Type");
+    static_assert(std::is_same_v<typename AllocatorTraits::pointer, Type*>,
+                  "Fancy pointers are not supported");
+
+    [[no_unique_address]] Allocator allocator_;
+    Type* buffer_;
+    std::size_t capacity_;
 
-    std::size_t front_idx_;
-    std::size_t size_;
+    std::size_t head_;
+    std::size_t tail_;
     std::size_t shrink_check_counter_ = 0;
 
+    static constexpr std::size_t INITIAL_CAPACITY = 8;
     static constexpr std::size_t SHRINK_CHECK_INTERVAL = 16;
-    static constexpr std::size_t MIN_SHRINK_CAPACITY = 10;
+    static constexpr std::size_t MIN_SHRINK_CAPACITY = INITIAL_CAPACITY;
     static constexpr std::size_t SHRINK_THRESHOLD_DIVISOR = 4;
     static constexpr std::size_t GROWTH_FACTOR = 2;
 
-    static constexpr std::size_t HARD_MAX_ELEMENTS =
-        std::numeric_limits<std::size_t>::max() / sizeof(Type);
+    /// Largest power-of-two capacity whose size in bytes fits a size_t.
+    static constexpr std::size_t HARD_MAX_ELEMENTS = std::bit_floor(
+        std::numeric_limits<std::size_t>::max() / sizeof(Type));
+
+
+    /**
+     * @brief Smallest ring capacity (a power of two, at least
+     * INITIAL_CAPACITY) that holds `count` elements.
+     *
+     * @throws std::length_error If that exceeds HARD_MAX_ELEMENTS.
+     */
+    static std::size_t ringCapacity(const std::size_t count) {
+        if (count > HARD_MAX_ELEMENTS)
+            throw std::length_error("Queue capacity exceeded");
+        return std::bit_ceil(std::max(count, INITIAL_CAPACITY));
+    }
+
+
+    /// Raw storage for `capacity` elements; nothing is constructed.
+    Type* allocate(const std::size_t capacity) {
+        return AllocatorTraits::allocate(allocator_, capacity);
+    }
+
+
+    /// Returns raw storage from allocate(); nullptr is a no-op.
+    void deallocate(Type* buffer, const std::size_t capacity) noexcept {
+        if (buffer != nullptr)
+            AllocatorTraits::deallocate(allocator_, buffer, capacity);
+    }
+
+
+    /// Mask turning a counter into a slot; the capacity is a power of two.
+    [[nodiscard]]
+    std::size_t mask() const noexcept {
+        return capacity_ - 1;
+    }
 
 
     /**
@@ -82,26 +141,26 @@ class Queue {
      * position.
      *
      * Translates a 0-based logical offset from the current front into an index
-     * within the backing `DynamicArray`, wrapping via modulo by the current
-     * capacity. This is the core mapping that turns the contiguous storage into
-     * a circular queue.
+     * within the buffer by masking the free-running counter
+     * `head_ + logical_index`. This is the core mapping that turns the
+     * contiguous storage into a circular queue.
      *
      * @param logical_index Offset from the front in [0, size()).
-     * @return Index into the underlying storage in [0, capacity()).
+     * @return Index into the buffer in [0, capacity()).
      *
      * Complexity: O(1).
      *
      * Exception safety: No-throw.
      *
      * @note
-     * Assumes `array_.capacity() > 0`, which is guaranteed by the underlying
-     * `DynamicArray`. Does not perform bounds checks against `size()`; callers
-     * must ensure `logical_index < size_`.
+     * Assumes `capacity_` is a nonzero power of two, which holds whenever the
+     * queue is not empty. Does not perform bounds checks against `size()`;
+     * callers must ensure `logical_index < size()`.
      */
     [[nodiscard]]
     std::size_t
     getCircularIndex(const std::size_t logical_index) const noexcept {
-        return (front_idx_ + logical_index) % array_.capacity();
+        return (head_ + logical_index) & mask();
     }
 
 
@@ -109,13 +168,11 @@ class Queue {
      * @brief Compute the physical index where the next element would be
      * enqueued.
      *
-     * Returns the ring-buffer slot immediately after the current back element,
-     * computed as `(front_idx_ + size_) % array_.capacity()`. This is the
-     * position used by `enqueue()`/`emplaceBack()` to place the next value when
-     * there is remaining capacity.
+     * Returns the ring-buffer slot of the `tail_` counter, immediately after
+     * the current back element. `enqueue()`/`emplaceBack()` construct the next
+     * value there when there is remaining capacity; the slot holds no object.
      *
-     * @return Index into the underlying storage in [0, capacity()) for the next
-     * enqueue.
+     * @return Index into the buffer in [0, capacity()) for the next enqueue.
      *
      * Complexity: O(1).
      *
@@ -123,12 +180,163 @@ class Queue {
      *
      * @note
      * This is *not* the index of the current back element. That index (when
-     * `size_ > 0`) is `(front_idx_ + size_ - 1) % array_.capacity()`. Assumes
-     * `array_.capacity() > 0` (guaranteed by `DynamicArray`).
+     * `size() > 0`) is `(tail_ - 1) & mask()`.
      */
     [[nodiscard]]
     std::size_t getBackIndex() const noexcept {
-        return (front_idx_ + size_) % array_.capacity();
+        return tail_ & mask();
+    }
+
+
+    /// Destroys the live elements; the counters are left to the caller.
+    void destroyElements() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            const auto [first, second] = segments();
+            for (const std::span<Type> segment : {first, second})
+                for (Type& element : segment)
+                    element.~Type();
+        }
+    }
+
+
+    /// Destroys the elements after the first `count`, moving the back
+    /// counter back; undoes a partial batch enqueue.
+    void truncateBack(const std::size_t count) noexcept {
+        while (size() > count) {
+            --tail_;
+            buffer_[tail_ & mask()].~Type();
+        }
+    }
+
+
+    /// Destroys the elements and frees the buffer, leaving no storage.
+    void release() noexcept {
+        destroyElements();
+        deallocate(buffer_, capacity_);
+        buffer_ = nullptr;
+        capacity_ = 0;
+        head_ = 0;
+        tail_ = 0;
+    }
+
+
+    /// Takes other's buffer and counters, leaving other without storage.
+    void takeStorage(Queue& other) noexcept {
+        buffer_ = std::exchange(other.buffer_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        head_ = std::exchange(other.head_, 0);
+        tail_ = std::exchange(other.tail_, 0);
+        shrink_check_counter_ = std::exchange(other.shrink_check_counter_, 0);
+    }
+
+
+    /**
+     * @brief Copy-construct the elements of `other`, in FIFO order, into
+     * raw storage at `target`.
+     *
+     * If a copy throws, the copies made so far are destroyed and the
+     * exception is rethrown.
+     */
+    static void copyElements(const Queue& other, Type* target) {
+        const auto [first, second] = other.segments();
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (!first.empty())
+                std::memcpy(target, first.data(), first.size_bytes());
+            if (!second.empty())
+                std::memcpy(target + first.size(), second.data(),
+                            second.size_bytes());
+            return;
+        }
+
+        Type* current = target;
+        try {
+            for (const std::span<const Type> segment : {first, second})
+                for (const Type& src : segment) {
+                    ::new (static_cast<void*>(current)) Type(src);
+                    ++current;
+                }
+        } catch (...) {
+            for (Type* it = target; it != current; ++it)
+                it->~Type();
+            throw;
+        }
+    }
+
+
+    /**
+     * @brief Relocate the elements, in FIFO order, into raw storage at
+     * `target` and destroy the originals.
+     *
+     * IS_TRIVIALLY_RELOCATABLE elements are copied bytewise (at most two
+     * memcpy calls). Others are moved if that cannot throw (or they cannot be
+     * copied) and copied otherwise; if a construction throws, the new objects
+     * are destroyed and the queue is unchanged. The counters are left to the
+     * caller.
+     */
+    void relocateElements(Type* target) {
+        const auto [first, second] = segments();
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<Type>) {
+            if (!first.empty())
+                std::memcpy(static_cast<void*>(target), first.data(),
+                            first.size_bytes());
+            if (!second.empty())
+                std::memcpy(static_cast<void*>(target + first.size()),
+                            second.data(), second.size_bytes());
+            return;
+        }
+
+        Type* current = target;
+        try {
+            for (const std::span<Type> segment : {first, second})
+                for (Type& src : segment) {
+                    ::new (static_cast<void*>(current))
+                        Type(std::move_if_noexcept(src));
+                    ++current;
+                }
+        } catch (...) {
+            for (Type* it = target; it != current; ++it)
+                it->~Type();
+            throw;
+        }
+        destroyElements();
+    }
+
+
+    /// True if elements can be copied to `OutputIt` with memcpy: trivially
+    /// copyable elements going to contiguous storage of `Type`.
+    template <typename OutputIt>
+    static constexpr bool copiesBytewiseTo() noexcept {
+        if constexpr (std::is_trivially_copyable_v<Type> &&
+                      std::contiguous_iterator<OutputIt>)
+            return std::is_same_v<std::iter_value_t<OutputIt>, Type>;
+        else
+            return false;
+    }
+
+
+    /// Installs `buffer` holding `count` relocated elements from index 0 and
+    /// frees the old buffer.
+    void commit(Type* buffer, const std::size_t capacity,
+                const std::size_t count) noexcept {
+        deallocate(buffer_, capacity_);
+        buffer_ = buffer;
+        capacity_ = capacity;
+        head_ = 0;
+        tail_ = count;
+    }
+
+
+    /// Rebuilds the ring with `new_capacity` slots (allocate+relocate+commit).
+    void reallocate(const std::size_t new_capacity) {
+        const std::size_t count = size();
+        Type* new_buffer = allocate(new_capacity);
+        try {
+            relocateElements(new_buffer);
+        } catch (...) {
+            deallocate(new_buffer, new_capacity);
+            throw;
+        }
+        commit(new_buffer, new_capacity, count);
     }
 
 
@@ -138,10 +346,10 @@ class Queue {
      *
      * Increments an internal counter on each call (typically from `dequeue()`),
      * and every `SHRINK_CHECK_INTERVAL` calls evaluates whether the queue is
-     * sufficiently under-utilized to justify a shrink. If `size_ <=
+     * sufficiently under-utilized to justify a shrink. If `size() <=
      * capacity()/SHRINK_THRESHOLD_DIVISOR` and `capacity() >
      * MIN_SHRINK_CAPACITY`, it builds a smaller buffer, moves elements in
-     * logical order, and commits the new storage, resetting `front_idx_` to 0.
+     * logical order, and commits the new storage, rebasing the counters to 0.
      *
      * @par Complexity
      * Amortized O(1) per dequeue; when a shrink is triggered, the operation
@@ -154,10 +362,10 @@ class Queue {
      * buffer is discarded, and the original queue remains unchanged.
      *
      * @par Effects
-     * - Reduces capacity to `max(size_, capacity()/GROWTH_FACTOR)`, but never
-     * below `MIN_SHRINK_CAPACITY`.
+     * - Halves the capacity (a power of two) while the queue stays that
+     * sparse, but never below `MIN_SHRINK_CAPACITY` (see shrinkIfSparse()).
      * - Preserves FIFO order of elements.
-     * - Resets `front_idx_` to 0 on successful shrink.
+     * - Rebases `head_` to 0 and `tail_` to `size()` on successful shrink.
      * - Resets the periodic counter after each check (regardless of whether a
      * shrink occurred).
      *
@@ -166,39 +374,38 @@ class Queue {
      * every dequeue.
      * - The divisor threshold prevents oscillation (shrink/expand thrashing)
      * under bursty loads.
-     * - Targeting at least `size_` ensures no immediate reallocation is needed
-     * after shrinking.
+     * - The halved capacity still holds twice the current size, so no
+     * immediate reallocation is needed after shrinking.
      */
     void autoManageCapacity() {
         shrink_check_counter_++;
         if (shrink_check_counter_ >= SHRINK_CHECK_INTERVAL) {
             shrink_check_counter_ = 0;
+            shrinkIfSparse();
+        }
+    }
 
-            if (size_ <= array_.capacity() / SHRINK_THRESHOLD_DIVISOR &&
-                array_.capacity() > MIN_SHRINK_CAPACITY) {
-
-                DynamicArray<Type> new_array;
-                const std::size_t halved = array_.capacity() / GROWTH_FACTOR;
-                const std::size_t target = size_ > halved ? size_ : halved;
-
-                const std::size_t clamped =
-                    target < MIN_SHRINK_CAPACITY ? MIN_SHRINK_CAPACITY : target;
-
-                new_array.reserve(clamped);
-
-                for (std::size_t i = 0; i < size_; ++i) {
-                    auto& src = array_[getCircularIndex(i)];
-                    if constexpr (std::is_nothrow_move_constructible_v<Type> ||
-                                  !std::is_copy_constructible_v<Type>)
-                        new_array.emplaceLast(std::move(src));
-                    else
-                        new_array.emplaceLast(src);
-                }
 
-                array_ = std::move(new_array);
-                front_idx_ = 0;
-            }
-        }
+    /**
+     * @brief Halve the capacity while `size()` is at most a
+     * SHRINK_THRESHOLD_DIVISOR-th of it (never below MIN_SHRINK_CAPACITY),
+     * with one rebuild.
+     *
+     * Run every SHRINK_CHECK_INTERVAL single dequeues, where it halves at
+     * most about once, and after every batch removal, which may have emptied
+     * most of the ring at once.
+     *
+     * @par Exception Safety
+     * Strong (allocate+move+commit).
+     */
+    void shrinkIfSparse() {
+        std::size_t new_capacity = capacity_;
+        while (new_capacity > MIN_SHRINK_CAPACITY &&
+               size() <= new_capacity / SHRINK_THRESHOLD_DIVISOR)
+            new_capacity /= GROWTH_FACTOR;
+
+        if (new_capacity != capacity_)
+            reallocate(std::max(new_capacity, MIN_SHRINK_CAPACITY));
     }
 
 
@@ -206,12 +413,13 @@ class Queue {
      * @brief Grow the buffer and append a new element in one
      * strongly-exception-safe step.
      *
-     * Computes a larger capacity using `new_cap = min(capacity()*GROWTH_FACTOR,
-     * HARD_MAX_ELEMENTS)`, allocates a fresh `DynamicArray<Type>` with that
-     * capacity, moves current elements into the new buffer in logical (FIFO)
-     * order, then constructs the new element at the back. On success, commits
-     * the new storage (`array_ = std::move(new_array)`), resets `front_idx_` to
-     * 0, and increments `size_`.
+     * Doubles the capacity (keeping it a power of two, at most
+     * HARD_MAX_ELEMENTS; a queue without storage gets INITIAL_CAPACITY),
+     * allocates a fresh buffer, constructs the new element at index `size()`
+     * in it, and then relocates the current elements in logical (FIFO) order
+     * in front of it. The new element is built first because `args` may refer
+     * to an element of this queue. On success, commits the new storage and
+     * rebases the counters (`head_` = 0, `tail_` = `size()`).
      *
      * @tparam Args Argument types forwarded to `Type`'s constructor for the
      * appended element.
@@ -229,157 +437,147 @@ class Queue {
      * is discarded, and the original queue remains unchanged.
      *
      * @par Effects
-     * - Capacity increases to `new_cap` (subject to `DynamicArray`'s internal
-     * maximum).
-     * - All existing elements are preserved and appear at indices `[0, size_)`
-     * in the new buffer.
-     * - The new element is appended at logical back; `front_idx_` becomes 0;
-     * `size_` increments by 1.
-     *
-     * @par Notes
-     * - Although `HARD_MAX_ELEMENTS` guards against size_t overflow, the
-     * underlying `DynamicArray` may still throw `std::bad_alloc` if `new_cap`
-     * exceeds its element-based `MAX_CAPACITY`.
-     * - Preserves element order and stability (relative order of existing
-     * elements).
+     * - Capacity doubles.
+     * - All existing elements are preserved and appear at indices
+     * `[0, size())` in the new buffer, followed by the new element.
+     *
+     * @throws std::length_error If the capacity is already HARD_MAX_ELEMENTS.
      */
     template <typename... Args>
     void reallocateAndPush(Args&&... args) {
-        const std::size_t cap = array_.capacity();
-
-        if (cap >= HARD_MAX_ELEMENTS)
+        if (capacity_ >= HARD_MAX_ELEMENTS)
             throw std::length_error("Queue capacity exceeded");
 
-        const std::size_t new_cap = (cap > HARD_MAX_ELEMENTS / GROWTH_FACTOR)
-                                        ? HARD_MAX_ELEMENTS
-                                        : cap * GROWTH_FACTOR;
-
-        DynamicArray<Type> new_array;
-        new_array.reserve(new_cap);
-
-        for (std::size_t i = 0; i < size_; ++i) {
-            auto& src = array_[getCircularIndex(i)];
-            if constexpr (std::is_nothrow_move_constructible_v<Type> ||
-                          !std::is_copy_constructible_v<Type>)
-                new_array.emplaceLast(std::move(src));
-            else
-                new_array.emplaceLast(src);
+        const std::size_t new_capacity =
+            capacity_ == 0 ? INITIAL_CAPACITY : capacity_ * GROWTH_FACTOR;
+        const std::size_t count = size();
+
+        Type* new_buffer = allocate(new_capacity);
+        try {
+            ::new (static_cast<void*>(new_buffer + count))
+                Type(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_buffer, new_capacity);
+            throw;
         }
 
-        new_array.emplaceLast(std::forward<Args>(args)...);
-        array_ = std::move(new_array);
-        front_idx_ = 0;
-        ++size_;
+        try {
+            relocateElements(new_buffer);
+        } catch (...) {
+            new_buffer[count].~Type();
+            deallocate(new_buffer, new_capacity);
+            throw;
+        }
+        commit(new_buffer, new_capacity, count + 1);
     }
 
 
     /**
-     * @brief Push a new element at the logical back, reusing storage when
-     * possible.
-     *
-     * Chooses the most efficient path to append:
-     *  - If the queue is full (`size_ == array_.capacity()`), grow and append
-     * via `reallocateAndPush(args...)` (allocate + move + commit).
-     *  - Else, compute the physical back slot `back_idx = getBackIndex()`.
-     *     - If `back_idx >= array_.size()`, the slot lies in the unconstructed
-     * tail, so construct in place via `array_.emplaceLast(args...)`.
-     *     - Otherwise, the slot already holds a (logically unused) live object;
-     * for assignable `Type`, construct a temporary from `args...` and assign
-     *       `array_[back_idx] = std::move(tmp)` to overwrite it without
-     * reallocation. For non-assignable `Type`, fall back to
-     * `reallocateAndPush(args...)`.
+     * @brief Construct a new element at the logical back.
+     *
+     * If the queue is full (`size() == capacity()`), grows and appends via
+     * `reallocateAndPush(args...)` (allocate + move + commit). Otherwise the
+     * slot `getBackIndex()` holds no object, so the element is constructed
+     * there directly from `args...`, with no temporary and no assignment.
      *
      * @tparam Args Argument types forwarded to `Type`'s constructor.
-     * @param args  Constructor arguments forwarded to create/assign the new
-     * value.
+     * @param args  Constructor arguments forwarded to create the new value.
      *
      * @par Complexity
-     * - Amortized O(1).
-     * - O(n) only when a growth reallocation occurs (moves `size_` elements).
-     * - O(1) when appending into the unconstructed tail or overwriting an
-     * existing slot.
+     * - Amortized O(1) for every `Type`.
+     * - O(n) only when a growth reallocation occurs (moves `size()` elements).
      *
      * @par Exception Safety
-     * - Growth path (`reallocateAndPush`): strong guarantee via
-     * allocate+move+commit (the queue is unchanged on failure).
-     * - Tail construction path (`emplaceLast`): strong guarantee (if
-     * construction throws, neither `array_` nor `size_` changes).
-     * - Overwrite path (assignable `Type`): strong guarantee for the queue. A
-     * temporary is constructed first; if that throws, nothing changes. The
-     * assignment occurs before incrementing `size_`; if assignment throws, the
-     * queue’s logical state remains unchanged (the overwritten slot was not
-     * part of the logical queue).
+     * - Strong guarantee: the growth path uses allocate+move+commit, and the
+     * in-place path advances `tail_` only after the construction succeeded.
      *
      * @par Invalidation
-     * - Only the growth path invalidates references/iterators. The
-     * overwrite/tail paths keep the underlying buffer and indices stable.
+     * - Only the growth path invalidates references/iterators.
      */
     template <typename... Args>
     void pushBack(Args&&... args) {
-        if (size_ == array_.capacity()) {
+        if (size() == capacity_) [[unlikely]] {
             reallocateAndPush(std::forward<Args>(args)...);
             return;
         }
 
-        const std::size_t back_idx = getBackIndex();
-        if (back_idx >= array_.size()) {
-            array_.emplaceLast(std::forward<Args>(args)...);
-            ++size_;
-            return;
-        }
-
-        if constexpr (std::is_move_assignable_v<Type> ||
-                      std::is_copy_assignable_v<Type>) {
-            Type tmp(std::forward<Args>(args)...);
-            array_[back_idx] = std::move(tmp);
-            ++size_;
-        } else {
-            reallocateAndPush(std::forward<Args>(args)...);
-        }
+        ::new (static_cast<void*>(buffer_ + getBackIndex()))
+            Type(std::forward<Args>(args)...);
+        ++tail_;
     }
 
 
   public:
     /// Default constructor
-    Queue() : array_(), front_idx_(0), size_(0) {}
-
-    /// Constructor with initial capacity
-    explicit Queue(std::size_t initial_capacity)
-        : array_(), front_idx_(0), size_(0) {
-        array_.reserve(initial_capacity);
+    Queue() : Queue(Allocator()) {}
+
+    /// Creates an empty queue whose storage comes from `allocator`.
+    explicit Queue(const Allocator& allocator)
+        : Queue(INITIAL_CAPACITY, allocator) {}
+
+    /// Constructor with initial capacity (rounded up to a power of two)
+    explicit Queue(const std::size_t initial_capacity,
+                   const Allocator& allocator = Allocator())
+        : allocator_(allocator), buffer_(nullptr),
+          capacity_(ringCapacity(initial_capacity)), head_(0), tail_(0) {
+        buffer_ = allocate(capacity_);
     }
 
     /**
      * Constructor with initial data and size.
      *
      * This constructor initializes the queue with a given array of initial
-     * data and its size. It reserves enough space in the underlying dynamic
-     * array to hold the initial elements.
+     * data and its size. It allocates enough space in the ring buffer to
+     * hold the initial elements.
      *
      * @param initial_data Pointer to the initial data array.
      * @param initial_size The number of elements in the initial data array.
+     * @param allocator Source of the queue's storage.
      */
-    Queue(const Type* initial_data, const std::size_t initial_size)
-        : array_(initial_data, initial_size), front_idx_(0),
-          size_(initial_size) {}
+    Queue(const Type* initial_data, const std::size_t initial_size,
+          const Allocator& allocator = Allocator())
+        : allocator_(allocator), buffer_(nullptr), capacity_(0), head_(0),
+          tail_(0) {
+        if (initial_size > 0 && initial_data == nullptr)
+            throw std::invalid_argument("Initial data cannot be null if "
+                                        "initial size is greater than zero");
+
+        capacity_ = ringCapacity(initial_size);
+        buffer_ = allocate(capacity_);
+        try {
+            std::uninitialized_copy_n(initial_data, initial_size, buffer_);
+        } catch (...) {
+            deallocate(buffer_, capacity_);
+            throw;
+        }
+        tail_ = initial_size;
+    }
 
-    /// Copy constructor
-    Queue(const Queue& other) : array_(), front_idx_(0), size_(0) {
-        array_.reserve(other.size_);
-        for (std::size_t i = 0; i < other.size_; ++i) {
-            std::size_t src_idx = other.getCircularIndex(i);
-            array_.addLast(other.array_[src_idx]);
+    /// Copy constructor; the allocator is chosen by
+    /// select_on_container_copy_construction.
+    Queue(const Queue& other)
+        : Queue(other, AllocatorTraits::select_on_container_copy_construction(
+                           other.allocator_)) {}
+
+    /// Copy constructor taking the storage from `allocator`.
+    Queue(const Queue& other, const Allocator& allocator)
+        : allocator_(allocator), buffer_(nullptr),
+          capacity_(ringCapacity(other.size())), head_(0), tail_(0) {
+        buffer_ = allocate(capacity_);
+        try {
+            copyElements(other, buffer_);
+        } catch (...) {
+            deallocate(buffer_, capacity_);
+            throw;
         }
-        size_ = other.size_;
+        tail_ = other.size();
     }
 
-    /// Move constructor
+    /// Move constructor; the buffer changes hands.
     Queue(Queue&& other) noexcept
-        : array_(std::move(other.array_)), front_idx_(other.front_idx_),
-          size_(other.size_) {
-        other.array_ = DynamicArray<Type>{};
-        other.front_idx_ = 0;
-        other.size_ = 0;
+        : allocator_(std::move(other.allocator_)), buffer_(nullptr),
+          capacity_(0), head_(0), tail_(0) {
+        takeStorage(other);
     }
 
     /// Copy assignment operator
@@ -387,33 +585,57 @@ class Queue {
         if (this == &other)
             return *this;
 
-        DynamicArray<Type> new_array;
-        new_array.reserve(other.size_);
-
-        for (std::size_t i = 0; i < other.size_; ++i) {
-            const std::size_t src_idx = other.getCircularIndex(i);
-            new_array.addLast(other.array_[src_idx]);
-        }
+        constexpr bool propagate =
+            AllocatorTraits::propagate_on_container_copy_assignment::value;
+        Queue copy(other, propagate ? other.allocator_ : allocator_);
 
-        array_ = std::move(new_array);
-        front_idx_ = 0;
-        size_ = other.size_;
+        release();
+        if constexpr (propagate)
+            allocator_ = copy.allocator_;
+        takeStorage(copy);
         return *this;
     }
 
-    /// Move assignment operator
-    Queue& operator=(Queue&& other) noexcept {
+    /**
+     * @brief Move assignment operator
+     *
+     * Takes over other's buffer when the allocator propagates or both
+     * allocators are equal. Otherwise this queue's allocator cannot free
+     * that buffer, so the elements are moved one by one into storage of its
+     * own (which may throw) and other is left empty.
+     */
+    Queue& operator=(Queue&& other) noexcept(
+        AllocatorTraits::propagate_on_container_move_assignment::value ||
+        AllocatorTraits::is_always_equal::value) {
         if (this == &other)
             return *this;
 
-        array_ = std::move(other.array_);
-        front_idx_ = other.front_idx_;
-        size_ = other.size_;
+        constexpr bool propagate =
+            AllocatorTraits::propagate_on_container_move_assignment::value;
+        if constexpr (!propagate && !AllocatorTraits::is_always_equal::value) {
+            if (allocator_ != other.allocator_) {
+                const std::size_t count = other.size();
+                const std::size_t new_capacity = ringCapacity(count);
+                Type* new_buffer = allocate(new_capacity);
+                try {
+                    other.relocateElements(new_buffer);
+                } catch (...) {
+                    deallocate(new_buffer, new_capacity);
+                    throw;
+                }
+                other.head_ = other.tail_ = 0;
 
-        other.array_ = DynamicArray<Type>{};
-        other.front_idx_ = 0;
-        other.size_ = 0;
+                destroyElements();
+                commit(new_buffer, new_capacity, count);
+                shrink_check_counter_ = 0;
+                return *this;
+            }
+        }
 
+        release();
+        if constexpr (propagate)
+            allocator_ = std::move(other.allocator_);
+        takeStorage(other);
         return *this;
     }
 
@@ -421,19 +643,62 @@ class Queue {
     /// Returns the number of elements in the queue.
     [[nodiscard]]
     std::size_t size() const noexcept {
-        return size_;
+        return tail_ - head_;
     }
 
-    /// Returns the capacity of the underlying data storage.
+    /// Returns the capacity of the ring buffer (a power of two, or 0 for a
+    /// moved-from queue).
     [[nodiscard]]
     std::size_t capacity() const noexcept {
-        return array_.capacity();
+        return capacity_;
     }
 
     /// Checks if the queue is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
-        return size_ == 0;
+        return head_ == tail_;
+    }
+
+
+    /**
+     * @brief The live elements in FIFO order as (at most) two contiguous
+     * runs of the ring buffer.
+     *
+     * `first` runs from the front towards the end of the buffer and
+     * `second` continues from its start; `second` is empty unless the ring
+     * wraps, and both are empty for an empty queue. Lets a batch leave the
+     * ring without copying it element by element, e.g. with two memcpy
+     * calls or one writev of two iovecs, after which discardFront() drops
+     * the elements that were consumed.
+     *
+     * @par Invalidation
+     * - The spans stay valid until the queue is next modified (an enqueue
+     * may grow the buffer and a dequeue may shrink it).
+     */
+    template <typename Element>
+    struct Segments {
+        std::span<Element> first;
+        std::span<Element> second;
+    };
+
+    /// The live elements as (at most) two contiguous spans, front to back.
+    [[nodiscard]]
+    Segments<const Type> segments() const noexcept {
+        const std::size_t count = size();
+        if (count == 0)
+            return {};
+
+        const std::size_t front = head_ & mask();
+        const std::size_t first = std::min(count, capacity_ - front);
+        return {{buffer_ + front, first}, {buffer_, count - first}};
+    }
+
+    /// The live elements as (at most) two mutable contiguous spans.
+    [[nodiscard]]
+    Segments<Type> segments() noexcept {
+        const auto [first, second] = std::as_const(*this).segments();
+        return {{const_cast<Type*>(first.data()), first.size()},
+                {const_cast<Type*>(second.data()), second.size()}};
     }
 
 
@@ -441,15 +706,10 @@ class Queue {
      * @brief Enqueue (append) a new element at the logical back of the queue.
      *
      * Perfect-forwards the argument into the queue. If there is spare capacity,
-     * the element is placed at the ring-buffer slot returned by
-     * `getBackIndex()`. Depending on `Type`:
-     *  - If the slot lies in the unconstructed tail of the underlying
-     * `DynamicArray`, the element is constructed in-place.
-     *  - If the slot already holds a live (but logically unused) object and
-     * `Type` is assignable, a temporary is constructed from `element` and
-     * assigned into that slot (no reallocation).
-     *  - Otherwise, the queue grows its capacity (by `GROWTH_FACTOR`) and
-     * appends into a fresh buffer in logical order (allocate + move + commit).
+     * the element is constructed in place in the free ring-buffer slot
+     * returned by `getBackIndex()`. Otherwise, the queue grows its capacity
+     * (by `GROWTH_FACTOR`) and appends into a fresh buffer in logical order
+     * (allocate + move + commit).
      *
      * @tparam U  A type that can construct `Type` (via perfect forwarding).
      * @param element  The value to enqueue.
@@ -459,18 +719,12 @@ class Queue {
      * `size()` elements).
      *
      * @par Exception Safety
-     * - Growth path: **strong guarantee** via allocate+move+commit (the queue
-     * is unchanged on failure).
-     * - Tail construction path: strong (if construction throws, neither storage
-     * nor `size_` changes).
-     * - Overwrite path (assignable `Type`): strong for the queue; a temporary
-     * is constructed first, so if construction or assignment throws, the
-     * logical state does not change.
+     * - **Strong guarantee**: if construction or growth throws, the queue is
+     * unchanged.
      * - May throw `std::bad_alloc` during growth.
      *
      * @par Invalidation
-     * - Only the growth path invalidates references/pointers/iterators;
-     * in-place paths do not.
+     * - Only the growth path invalidates references/pointers/iterators.
      */
     template <typename U>
     void enqueue(U&& element) {
@@ -480,15 +734,89 @@ class Queue {
     }
 
 
+    /**
+     * @brief Enqueue copies of the elements of [first, last), in order.
+     *
+     * For forward iterators the buffer grows at most once, to the power of
+     * two that fits the whole batch, and the elements are constructed
+     * straight into the free slots: at most two contiguous runs (from the
+     * back to the end of the buffer, then from its start), each filled with
+     * a single memcpy for trivially copyable elements from contiguous
+     * ranges. Single-pass input iterators are enqueued one by one.
+     *
+     * @tparam Iterator Input iterator whose elements can construct Type;
+     * pass a std::move_iterator to move the elements in.
+     * @param first Start of the range to enqueue.
+     * @param last End of the range to enqueue.
+     *
+     * @par Precondition
+     * - The range must not refer into this queue.
+     *
+     * @par Complexity
+     * - O(k) for k elements, with no per-element capacity check for forward
+     * iterators.
+     *
+     * @par Exception Safety
+     * - Strong: if constructing an element throws, the contents are
+     * unchanged (the capacity may have grown).
+     *
+     * @throws std::length_error If the result would exceed the maximum
+     * capacity.
+     * @throws std::bad_alloc On allocation failure.
+     */
+    template <std::input_iterator Iterator>
+    void enqueueRange(Iterator first, const Iterator last) {
+        static_assert(
+            std::is_constructible_v<Type, std::iter_reference_t<Iterator>>,
+            "Element must be constructible into Type");
+
+        if constexpr (std::forward_iterator<Iterator>) {
+            const auto count =
+                static_cast<std::size_t>(std::distance(first, last));
+            if (count == 0)
+                return;
+            if (count > HARD_MAX_ELEMENTS - size())
+                throw std::length_error("Queue capacity exceeded");
+            if (size() + count > capacity_)
+                reallocate(ringCapacity(size() + count));
+
+            using Difference = std::iter_difference_t<Iterator>;
+            const std::size_t back = getBackIndex();
+            const std::size_t before_wrap = std::min(count, capacity_ - back);
+            const std::size_t wrapped = count - before_wrap;
+
+            const auto copied = std::ranges::uninitialized_copy_n(
+                first, static_cast<Difference>(before_wrap), buffer_ + back,
+                buffer_ + back + before_wrap);
+            try {
+                std::ranges::uninitialized_copy_n(
+                    copied.in, static_cast<Difference>(wrapped), buffer_,
+                    buffer_ + wrapped);
+            } catch (...) {
+                std::destroy_n(buffer_ + back, before_wrap);
+                throw;
+            }
+            tail_ += count;
+        } else {
+            const std::size_t old_size = size();
+            try {
+                for (; first != last; ++first)
+                    pushBack(*first);
+            } catch (...) {
+                truncateBack(old_size);
+                throw;
+            }
+        }
+    }
+
+
     /**
      * @brief Dequeue (remove) the front element and return it by value.
      *
-     * Moves the current front element out of the queue and advances
-     * `front_idx_` modulo the current capacity, then decrements `size_`. The
-     * removed slot’s object is left in a valid moved-from state (its destructor
-     * will run later when the buffer is rebuilt/shrunk, overwritten by
-     * assignment, or the queue is cleared/destroyed). Periodically, a shrink
-     * check may run and rebuild the buffer into a smaller capacity.
+     * Moves the current front element out of the queue, destroys it in its
+     * slot, and advances the `head_` counter, which shrinks `size()` by one.
+     * Periodically, a shrink check may run and rebuild the buffer into a
+     * smaller capacity.
      *
      * @return The removed front element (moved).
      * @throws std::out_of_range if the queue is empty.
@@ -506,28 +834,101 @@ class Queue {
      * exception is propagated afterward.
      *
      * @par Postconditions
-     * - `size()` decreased by 1; `front_idx_` advanced modulo `capacity()`.
+     * - `size()` decreased by 1; `head_` advanced by 1.
      * - FIFO order of remaining elements is preserved.
-     *
-     * @par Notes
-     * - Deferring destruction of the popped slot enables fast in-place
-     * overwrites on later enqueues for assignable `Type`. For resource-heavy
-     * types, memory may be released earlier if a shrink or rebuild happens soon
-     * after.
+     * - Resources held by the removed element are released immediately.
      */
     Type dequeue() {
         if (isEmpty())
             throw std::out_of_range("Queue is empty");
 
-        Type element = std::move(array_[front_idx_]);
-        front_idx_ = (front_idx_ + 1) % array_.capacity();
-        --size_;
+        Type& slot = buffer_[head_ & mask()];
+        Type element = std::move(slot);
+        slot.~Type();
+        ++head_;
         autoManageCapacity();
 
         return element;
     }
 
 
+    /**
+     * @brief Move up to `count` elements from the front to `out`, in FIFO
+     * order.
+     *
+     * Walks the (at most two) contiguous runs of segments() directly;
+     * trivially copyable elements go to a contiguous output of `Type` with
+     * one memcpy per run. The shrink check runs once for the whole batch.
+     *
+     * @param out Output iterator accepting `Type&&`.
+     * @param count Maximum number of elements to dequeue.
+     * @return How many were dequeued: `min(count, size())`.
+     *
+     * @par Complexity
+     * - O(k) for k dequeued elements; an occasional shrink is O(n).
+     *
+     * @par Exception Safety
+     * - If writing an element to `out` throws, the elements written before
+     * it are dequeued and it stays at the front.
+     * - If the shrink afterwards throws, the batch has been dequeued.
+     */
+    template <typename OutputIt>
+        requires std::output_iterator<OutputIt, Type&&>
+    std::size_t dequeueInto(OutputIt out, const std::size_t count) {
+        const std::size_t batch = std::min(count, size());
+        if (batch == 0)
+            return 0;
+
+        std::size_t remaining = batch;
+        const auto [first, second] = segments();
+        for (const std::span<Type> segment : {first, second}) {
+            const std::span<Type> taken =
+                segment.first(std::min(segment.size(), remaining));
+            if constexpr (copiesBytewiseTo<OutputIt>()) {
+                if (!taken.empty())
+                    std::memcpy(std::to_address(out), taken.data(),
+                                taken.size_bytes());
+                out += static_cast<std::iter_difference_t<OutputIt>>(
+                    taken.size());
+                head_ += taken.size();
+            } else {
+                for (Type& element : taken) {
+                    *out = std::move(element);
+                    ++out;
+                    element.~Type();
+                    ++head_;
+                }
+            }
+            remaining -= taken.size();
+        }
+
+        shrinkIfSparse();
+        return batch;
+    }
+
+
+    /**
+     * @brief Destroy up to `count` elements at the front without moving
+     * them out, e.g. after writing them from segments().
+     *
+     * @return How many were removed: `min(count, size())`.
+     *
+     * @par Exception Safety
+     * - The shrink check runs once afterwards; if it throws, the elements
+     * have been removed.
+     */
+    std::size_t discardFront(const std::size_t count) {
+        const std::size_t batch = std::min(count, size());
+        if constexpr (!std::is_trivially_destructible_v<Type>)
+            for (std::size_t i = 0; i < batch; ++i)
+                buffer_[(head_ + i) & mask()].~Type();
+        head_ += batch;
+        if (batch > 0)
+            shrinkIfSparse();
+        return batch;
+    }
+
+
     /**
      * @brief Returns the front element of the queue without removing it.
      *
@@ -540,7 +941,7 @@ class Queue {
         if (isEmpty())
             throw std::out_of_range("Queue is empty");
 
-        return array_[front_idx_];
+        return buffer_[head_ & mask()];
     }
 
 
@@ -557,7 +958,7 @@ class Queue {
         if (isEmpty())
             throw std::out_of_range("Queue is empty");
 
-        return array_[front_idx_];
+        return buffer_[head_ & mask()];
     }
 
 
@@ -574,8 +975,7 @@ class Queue {
         if (isEmpty())
             throw std::out_of_range("Queue is empty");
 
-        std::size_t back_idx = (front_idx_ + size_ - 1) % array_.capacity();
-        return array_[back_idx];
+        return buffer_[(tail_ - 1) & mask()];
     }
 
 
@@ -591,19 +991,16 @@ class Queue {
         if (isEmpty())
             throw std::out_of_range("Queue is empty");
 
-        std::size_t back_idx = (front_idx_ + size_ - 1) % array_.capacity();
-        return array_[back_idx];
+        return buffer_[(tail_ - 1) & mask()];
     }
 
 
     /**
      * @brief Enqueue by constructing the element in place at the logical back.
      *
-     * Perfect-forwards `args...` to `Type`'s constructor. Behavior mirrors
-     * `enqueue`: constructs in the uninitialized tail when available,
-     * overwrites an existing back slot via assignment for assignable `Type`, or
-     * grows the buffer and appends into a fresh allocation (allocate + move +
-     * commit).
+     * Perfect-forwards `args...` to `Type`'s constructor, which runs directly
+     * in the free back slot (no temporary is created), or in a fresh
+     * allocation when the buffer has to grow (allocate + move + commit).
      *
      * @tparam Args  Argument types forwarded to `Type`'s constructor.
      * @param args   Constructor arguments for the new element.
@@ -612,12 +1009,7 @@ class Queue {
      * - Amortized O(1); O(n) only when a growth reallocation occurs.
      *
      * @par Exception Safety
-     * - Growth path: **strong guarantee** (the queue is unchanged on failure).
-     * - Tail construction path: strong (if construction throws, nothing
-     * changes).
-     * - Overwrite path (assignable `Type`): strong for the queue; a temporary
-     * is constructed first, so if construction/assignment throws, the logical
-     * state is unchanged.
+     * - **Strong guarantee** (the queue is unchanged on failure).
      * - May throw `std::bad_alloc` during growth.
      *
      * @par Invalidation
@@ -629,16 +1021,73 @@ class Queue {
     }
 
 
-    /// Clears the queue, removing all elements.
+    /// Clears the queue, removing all elements and returning to the initial
+    /// capacity.
     void clear() {
-        array_ = DynamicArray<Type>{};
-        front_idx_ = 0;
-        size_ = 0;
+        destroyElements();
+        head_ = 0;
+        tail_ = 0;
         shrink_check_counter_ = 0;
+
+        if (capacity_ != INITIAL_CAPACITY) {
+            deallocate(buffer_, capacity_);
+            buffer_ = nullptr;
+            capacity_ = 0;
+            buffer_ = allocate(INITIAL_CAPACITY);
+            capacity_ = INITIAL_CAPACITY;
+        }
+    }
+
+    /// Returns a copy of the allocator supplying the queue's storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return allocator_;
+    }
+
+
+    /**
+     * @brief Write the queue, front to back, in the binary container format
+     * (see Serialization.hpp).
+     *
+     * Raw elements are written as at most two blocks: the ring from the
+     * front to the end of the buffer, then its wrapped part.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void serialize(std::ostream& out) const {
+        serialization::writeHeader<Type>(out, SerializedKind::QUEUE, size());
+
+        const auto [first, second] = segments();
+        serialization::writeElements(out, first.data(), first.size());
+        serialization::writeElements(out, second.data(), second.size());
+    }
+
+
+    /**
+     * @brief Read a queue written by serialize(), with one allocation and,
+     * for raw elements, a single read.
+     *
+     * @throws std::runtime_error If the data is not a serialized queue of
+     * Type, or is truncated.
+     */
+    static Queue deserialize(std::istream& in,
+                             const Allocator& allocator = Allocator()) {
+        const std::size_t count =
+            serialization::readHeader<Type>(in, SerializedKind::QUEUE);
+
+        Queue queue(count, allocator);
+        if constexpr (serialization::IS_RAW<Type>) {
+            serialization::readBytes(in, queue.buffer_, count * sizeof(Type));
+            queue.tail_ = count;
+        } else {
+            for (std::size_t i = 0; i < count; ++i)
+                queue.pushBack(serialization::readElement<Type>(in));
+        }
+        return queue;
     }
 
     /// Destructor
-    ~Queue() = default;
+    ~Queue() { release(); }
 
 
     /**
@@ -663,18 +1112,18 @@ class Queue {
 
         /// Dereference operator to access the element at the current index
         Type& operator*() {
-            return queue_.array_[queue_.getCircularIndex(index_)];
+            return queue_.buffer_[queue_.getCircularIndex(index_)];
         }
 
         /// Arrow operator to access the address of the element at the current
         /// index
         Type* operator->() {
-            return &queue_.array_[queue_.getCircularIndex(index_)];
+            return &queue_.buffer_[queue_.getCircularIndex(index_)];
         }
 
         /// Pre-increment operator to move the iterator to the next element
         iterator& operator++() {
-            if (index_ >= queue_.size_)
+            if (index_ >= queue_.size())
                 throw std::out_of_range(
                     "Iterator cannot be incremented past the end");
             index_++;
@@ -683,7 +1132,7 @@ class Queue {
 
         /// Post-increment operator to move the iterator to the next element
         iterator operator++(int) {
-            if (index_ >= queue_.size_)
+            if (index_ >= queue_.size())
                 throw std::out_of_range(
                     "Iterator cannot be incremented past the end");
             iterator temp = *this;
@@ -752,18 +1201,18 @@ class Queue {
 
         /// Dereference operator to access the element at the current index
         const Type& operator*() const {
-            return queue_.array_[queue_.getCircularIndex(index_)];
+            return queue_.buffer_[queue_.getCircularIndex(index_)];
         }
 
         /// Arrow operator to access the address of the element at the current
         /// index
         const Type* operator->() const {
-            return &queue_.array_[queue_.getCircularIndex(index_)];
+            return &queue_.buffer_[queue_.getCircularIndex(index_)];
         }
 
         /// Pre-increment operator to move the iterator to the next element
         const_iterator& operator++() {
-            if (index_ >= queue_.size_)
+            if (index_ >= queue_.size())
                 throw std::out_of_range(
                     "Iterator cannot be incremented past the end");
             index_++;
@@ -772,7 +1221,7 @@ class Queue {
 
         /// Post-increment operator to move the iterator to the next element
         const_iterator operator++(int) {
-            if (index_ >= queue_.size_)
+            if (index_ >= queue_.size())
                 throw std::out_of_range(
                     "Iterator cannot be incremented past the end");
             const_iterator temp = *this;
@@ -820,10 +1269,10 @@ class Queue {
     // --- Iterator support for range-based for loops ---
 
     iterator begin() { return iterator(*this, 0); }
-    iterator end() { return iterator(*this, size_); }
+    iterator end() { return iterator(*this, size()); }
 
     const_iterator begin() const { return const_iterator(*this, 0); }
-    const_iterator end() const { return const_iterator(*this, size_); }
+    const_iterator end() const { return const_iterator(*this, size()); }
 
     // --- C++11 range-based for loop support ---
 
@@ -854,6 +1303,15 @@ class Queue {
     }
 };
 
+
+namespace pmr {
+
+/// Queue whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using Queue = data_structs::Queue<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // QUEUE_HPP
@@ -0,0 +1,378 @@
+#ifndef SERIALIZATION_HPP
+#define SERIALIZATION_HPP
+
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <spanstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace data_structs {
+
+
+/// Container type recorded in the header of a serialized image.
+enum class SerializedKind : std::uint8_t {
+    DYNAMIC_ARRAY = 1,
+    STACK,
+    QUEUE,
+    LINKED_LIST,
+    BINARY_TREE,
+    BINARY_SEARCH_TREE,
+    MIN_HEAP,
+    MAX_HEAP
+};
+
+
+/**
+ * @brief Encoding of one element in the binary format of the containers'
+ * serialize() / deserialize().
+ *
+ * Provided for trivially copyable types, which are stored as their raw bytes
+ * (RAW, so that contiguous containers write and read them in one block), and
+ * for strings of trivially copyable characters. Other element types
+ * specialize it:
+ *
+ *     template <>
+ *     struct data_structs::Serializer<Point> {
+ *         static void write(std::ostream& out, const Point& point);
+ *         static Point read(std::istream& in);
+ *     };
+ */
+template <typename Type>
+struct Serializer;
+
+
+namespace serialization {
+
+/// Bumped on every incompatible change of the format.
+inline constexpr std::uint16_t FORMAT_VERSION = 1;
+
+/// Written as a native integer; reads back differently on another byte order.
+inline constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+inline constexpr std::uint8_t RAW_ELEMENTS = 1;
+
+
+/**
+ * @brief Leading 32 bytes of every serialized container.
+ *
+ * Raw element blocks start right after it, so in a page-aligned mapping of
+ * the image they are aligned for any Type of alignment up to 32.
+ */
+struct Header {
+    char magic[4];
+    std::uint16_t version;
+    std::uint8_t kind;
+    std::uint8_t flags;
+    std::uint32_t element_size;
+    std::uint32_t byte_order;
+    std::uint64_t count;
+    std::uint64_t reserved;
+};
+
+static_assert(sizeof(Header) == 32 && std::is_trivially_copyable_v<Header>);
+
+inline constexpr char MAGIC[4] = {'D', 'S', 'A', 'L'};
+
+
+/// True if `Type` is stored as its own bytes.
+template <typename Type>
+inline constexpr bool IS_RAW = requires { requires Serializer<Type>::RAW; };
+
+
+inline void writeBytes(std::ostream& out, const void* source,
+                       const std::size_t bytes) {
+    if (!out.write(static_cast<const char*>(source),
+                   static_cast<std::streamsize>(bytes)))
+        throw std::runtime_error("Cannot write serialized data");
+}
+
+
+inline void readBytes(std::istream& in, void* target, const std::size_t bytes) {
+    if (!in.read(static_cast<char*>(target),
+                 static_cast<std::streamsize>(bytes)))
+        throw std::runtime_error("Serialized data is truncated");
+}
+
+
+template <typename Type>
+void writeElement(std::ostream& out, const Type& element) {
+    Serializer<Type>::write(out, element);
+}
+
+
+template <typename Type>
+Type readElement(std::istream& in) {
+    return Serializer<Type>::read(in);
+}
+
+
+/// Writes `count` elements from contiguous memory, in one block if raw.
+template <typename Type>
+void writeElements(std::ostream& out, const Type* first,
+                   const std::size_t count) {
+    if constexpr (IS_RAW<Type>) {
+        writeBytes(out, first, count * sizeof(Type));
+    } else {
+        for (std::size_t i = 0; i < count; ++i)
+            writeElement(out, first[i]);
+    }
+}
+
+
+template <typename Type>
+void writeHeader(std::ostream& out, const SerializedKind kind,
+                 const std::size_t count) {
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.kind = static_cast<std::uint8_t>(kind);
+    header.flags = IS_RAW<Type> ? RAW_ELEMENTS : 0;
+    header.element_size = IS_RAW<Type> ? sizeof(Type) : 0;
+    header.byte_order = BYTE_ORDER_MARK;
+    header.count = count;
+    writeBytes(out, &header, sizeof(header));
+}
+
+
+/**
+ * @brief Checks that `header` describes a `kind` container of `Type`
+ * elements written by a compatible build.
+ *
+ * @return The number of elements.
+ * @throws std::runtime_error If it does not.
+ */
+template <typename Type>
+std::size_t checkHeader(const Header& header, const SerializedKind kind) {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("Not a serialized container");
+    if (header.version != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported serialization format version");
+    if (header.byte_order != BYTE_ORDER_MARK)
+        throw std::runtime_error("Serialized with a different byte order");
+    if (header.kind != static_cast<std::uint8_t>(kind))
+        throw std::runtime_error("Serialized container is of another kind");
+    if ((header.flags & RAW_ELEMENTS) != (IS_RAW<Type> ? RAW_ELEMENTS : 0) ||
+        header.element_size != (IS_RAW<Type> ? sizeof(Type) : 0))
+        throw std::runtime_error("Serialized elements are of another type");
+    if (header.count > std::numeric_limits<std::size_t>::max() / sizeof(Type))
+        throw std::runtime_error("Serialized container is too large");
+    return static_cast<std::size_t>(header.count);
+}
+
+
+/// Reads and checks a header; see checkHeader().
+template <typename Type>
+std::size_t readHeader(std::istream& in, const SerializedKind kind) {
+    Header header;
+    readBytes(in, &header, sizeof(header));
+    return checkHeader<Type>(header, kind);
+}
+
+} // namespace serialization
+
+
+template <typename Type>
+    requires std::is_trivially_copyable_v<Type>
+struct Serializer<Type> {
+    static constexpr bool RAW = true;
+
+    static void write(std::ostream& out, const Type& element) {
+        serialization::writeBytes(out, &element, sizeof(Type));
+    }
+
+    static Type read(std::istream& in) {
+        alignas(Type) unsigned char bytes[sizeof(Type)];
+        serialization::readBytes(in, bytes, sizeof(Type));
+        return std::bit_cast<Type>(bytes);
+    }
+};
+
+
+/// Strings are stored as their length followed by their characters.
+template <typename Char, typename Traits, typename Allocator>
+    requires std::is_trivially_copyable_v<Char>
+struct Serializer<std::basic_string<Char, Traits, Allocator>> {
+    using String = std::basic_string<Char, Traits, Allocator>;
+
+    static void write(std::ostream& out, const String& string) {
+        const std::uint64_t length = string.size();
+        serialization::writeBytes(out, &length, sizeof(length));
+        serialization::writeBytes(out, string.data(),
+                                  string.size() * sizeof(Char));
+    }
+
+    static String read(std::istream& in) {
+        std::uint64_t length;
+        serialization::readBytes(in, &length, sizeof(length));
+        if (length > String().max_size())
+            throw std::runtime_error("Serialized string is too long");
+
+        String string(static_cast<std::size_t>(length), Char());
+        serialization::readBytes(in, string.data(),
+                                 string.size() * sizeof(Char));
+        return string;
+    }
+};
+
+
+/**
+ * @class SerializedImage
+ * @brief Read-only memory mapping of a file written by a container's
+ * serialize().
+ *
+ * elements() views the raw elements of a serialized DynamicArray, Stack or
+ * Queue in place, without reading or copying the file: pages are loaded on
+ * first access, so a large table is usable right after open(). Every
+ * container can also be rebuilt from the mapping through stream(), which
+ * reads from memory instead of issuing file reads.
+ *
+ * Only available on POSIX systems.
+ *
+ * @par Moved-from State
+ * - A moved-from image is empty and maps nothing.
+ */
+class SerializedImage {
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+
+    SerializedImage(const std::byte* data, const std::size_t size) noexcept
+        : data_(data), size_(size) {}
+
+    void unmap() noexcept {
+        if (data_ != nullptr)
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+  public:
+    /**
+     * @brief Maps the file at `path` for reading.
+     *
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @throws std::runtime_error If it is too small to hold a header.
+     */
+    static SerializedImage open(const std::filesystem::path& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "open");
+
+        struct stat status{};
+        if (::fstat(fd, &status) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat");
+        }
+
+        const auto size = static_cast<std::size_t>(status.st_size);
+        if (size < sizeof(serialization::Header)) {
+            ::close(fd);
+            throw std::runtime_error("Not a serialized container");
+        }
+
+        // The mapping stays valid after its descriptor is closed
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+            throw std::system_error(error, std::generic_category(), "mmap");
+        return {static_cast<const std::byte*>(mapping), size};
+    }
+
+    SerializedImage() noexcept = default;
+
+    SerializedImage(const SerializedImage&) = delete;
+    SerializedImage& operator=(const SerializedImage&) = delete;
+
+    SerializedImage(SerializedImage&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    SerializedImage& operator=(SerializedImage&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~SerializedImage() noexcept { unmap(); }
+
+
+    /// The whole file.
+    [[nodiscard]]
+    std::span<const std::byte> bytes() const noexcept {
+        return {data_, size_};
+    }
+
+
+    /// Stream over the mapped bytes, for a container's deserialize().
+    [[nodiscard]]
+    std::ispanstream stream() const {
+        return std::ispanstream(std::span<const char>(
+            reinterpret_cast<const char*>(data_), size_));
+    }
+
+
+    /**
+     * @brief Views the elements of a serialized DynamicArray, Stack or
+     * Queue without copying them.
+     *
+     * The span points into the mapping and is valid as long as the image.
+     * Elements are in index, bottom-to-top or front-to-back order.
+     *
+     * @tparam Type Element type; its Serializer must be RAW.
+     * @param kind The container that was serialized.
+     *
+     * @throws std::invalid_argument If `kind` is not contiguous.
+     * @throws std::runtime_error If the header does not match or the file
+     * is truncated.
+     */
+    template <typename Type>
+    [[nodiscard]]
+    std::span<const Type> elements(const SerializedKind kind) const {
+        static_assert(serialization::IS_RAW<Type>,
+                      "Only raw elements can be viewed in place");
+        static_assert(alignof(Type) <= sizeof(serialization::Header),
+                      "Elements must fit the alignment of the header");
+        if (kind != SerializedKind::DYNAMIC_ARRAY &&
+            kind != SerializedKind::STACK && kind != SerializedKind::QUEUE)
+            throw std::invalid_argument(
+                "Only arrays, stacks and queues are stored contiguously");
+        if (data_ == nullptr)
+            throw std::runtime_error("Not a serialized container");
+
+        serialization::Header header;
+        std::memcpy(&header, data_, sizeof(header));
+        const std::size_t count =
+            serialization::checkHeader<Type>(header, kind);
+        if (count > (size_ - sizeof(header)) / sizeof(Type))
+            throw std::runtime_error("Serialized data is truncated");
+
+        return {reinterpret_cast<const Type*>(data_ + sizeof(header)), count};
+    }
+};
+
+} // namespace data_structs
+
+#endif // SERIALIZATION_HPP
@@ -0,0 +1,576 @@
+#ifndef SIMD_KERNELS_HPP
+#define SIMD_KERNELS_HPP
+
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// The explicit vector code needs GCC/Clang target attributes and x86-64,
+// where SSE2 is always available. Everywhere else only the portable kernels
+// are compiled.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define DATA_STRUCTS_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define DATA_STRUCTS_SIMD_X86 0
+#endif
+
+
+namespace data_structs::simd {
+
+// Vectorized scans over contiguous arrays of arithmetic types: find-first,
+// count and find-all by equality, and min/max/sum reductions. The equality
+// kernels compare a block of 64 elements per call with SSE2, AVX2 or
+// AVX-512 and return one bit per element; the reductions keep 256 bytes of
+// independent partial results, which the compiler maps onto whole vector
+// registers of the selected instruction set. The instruction set is picked
+// at run time, so a binary built for baseline x86-64 still uses AVX2 or
+// AVX-512 where the CPU has them.
+
+
+/// Instruction sets the kernels can use, in increasing order of width.
+enum class Isa { SCALAR, SSE2, AVX2, AVX512 };
+
+
+/// Element types the kernels handle: integers of 1, 2, 4 or 8 bytes (except
+/// bool), float and double.
+template <typename Type>
+inline constexpr bool IS_VECTORIZABLE =
+    (std::is_integral_v<Type> && !std::is_same_v<Type, bool> &&
+     (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 ||
+      sizeof(Type) == 8)) ||
+    std::is_same_v<Type, float> || std::is_same_v<Type, double>;
+
+/// Number of elements compared per equality-mask call.
+inline constexpr std::size_t BLOCK_SIZE = 64;
+
+/// Number of independent partial results kept by a reduction.
+template <typename Type>
+inline constexpr std::size_t REDUCTION_LANES = 256 / sizeof(Type);
+
+
+/**
+ * @brief The widest instruction set supported by the CPU (and the OS, which
+ * must save the wider registers).
+ *
+ * Detected once, on first use.
+ */
+inline Isa supportedIsa() noexcept {
+#if DATA_STRUCTS_SIMD_X86
+    static const Isa isa = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512bw"))
+            return Isa::AVX512;
+        if (__builtin_cpu_supports("avx2"))
+            return Isa::AVX2;
+        return Isa::SSE2;
+    }();
+    return isa;
+#else
+    return Isa::SCALAR;
+#endif
+}
+
+
+/**
+ * @brief Hint the CPU to start loading the cache line at `base + offset`
+ * bytes for reading.
+ *
+ * The address may lie outside any object (it is formed as an integer, and a
+ * prefetch never faults), so search loops can prefetch nodes that may not
+ * exist. No-op on compilers without a prefetch builtin.
+ */
+inline void prefetch(const void* base, const std::size_t offset) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(reinterpret_cast<const void*>(
+        reinterpret_cast<std::uintptr_t>(base) + offset));
+#else
+    (void)base;
+    (void)offset;
+#endif
+}
+
+
+/*** Equality masks ***/
+
+
+#if DATA_STRUCTS_SIMD_X86
+
+// Unaligned loads of one vector. Intrinsics only inline into functions
+// compiled for their instruction set, which lambdas do not inherit.
+
+inline __m128i loadSse2(const void* address) noexcept {
+    return _mm_loadu_si128(static_cast<const __m128i*>(address));
+}
+
+
+[[gnu::target("avx2")]] inline __m256i
+loadAvx2(const void* address) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i*>(address));
+}
+
+
+[[gnu::target("avx512f")]] inline __m512i
+loadAvx512(const void* address) noexcept {
+    return _mm512_loadu_si512(address);
+}
+
+
+/// Bit k of the result is set iff data[k] == value, for k < BLOCK_SIZE.
+template <typename Type>
+std::uint64_t equalMaskSse2(const Type* data, const Type value) noexcept {
+    const auto bits = [](const int movemask) {
+        return static_cast<std::uint64_t>(static_cast<unsigned>(movemask));
+    };
+
+    std::uint64_t mask = 0;
+    if constexpr (std::is_same_v<Type, float>) {
+        const __m128 needle = _mm_set1_ps(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 4) {
+            const __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(data + k), needle);
+            mask |= bits(_mm_movemask_ps(equal)) << k;
+        }
+    } else if constexpr (std::is_same_v<Type, double>) {
+        const __m128d needle = _mm_set1_pd(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 2) {
+            const __m128d equal = _mm_cmpeq_pd(_mm_loadu_pd(data + k), needle);
+            mask |= bits(_mm_movemask_pd(equal)) << k;
+        }
+    } else if constexpr (sizeof(Type) == 1) {
+        const __m128i needle = _mm_set1_epi8(std::bit_cast<char>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 16) {
+            const __m128i equal = _mm_cmpeq_epi8(loadSse2(data + k), needle);
+            mask |= bits(_mm_movemask_epi8(equal)) << k;
+        }
+    } else if constexpr (sizeof(Type) == 2) {
+        // Saturating pack turns two vectors of 16-bit lane masks into one of
+        // byte masks, in element order
+        const __m128i needle = _mm_set1_epi16(std::bit_cast<short>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 16) {
+            const __m128i low = _mm_cmpeq_epi16(loadSse2(data + k), needle);
+            const __m128i high =
+                _mm_cmpeq_epi16(loadSse2(data + k + 8), needle);
+            mask |= bits(_mm_movemask_epi8(_mm_packs_epi16(low, high))) << k;
+        }
+    } else if constexpr (sizeof(Type) == 4) {
+        const __m128i needle = _mm_set1_epi32(std::bit_cast<int>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 4) {
+            const __m128i equal = _mm_cmpeq_epi32(loadSse2(data + k), needle);
+            mask |= bits(_mm_movemask_ps(_mm_castsi128_ps(equal))) << k;
+        }
+    } else {
+        // SSE2 has no 64-bit compare: both 32-bit halves must match
+        const __m128i needle =
+            _mm_set1_epi64x(std::bit_cast<long long>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 2) {
+            __m128i equal = _mm_cmpeq_epi32(loadSse2(data + k), needle);
+            equal = _mm_and_si128(
+                equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+            mask |= bits(_mm_movemask_pd(_mm_castsi128_pd(equal))) << k;
+        }
+    }
+    return mask;
+}
+
+
+/// equalMaskSse2() with 256-bit AVX2 compares.
+template <typename Type>
+[[gnu::target("avx2")]] std::uint64_t
+equalMaskAvx2(const Type* data, const Type value) noexcept {
+    const auto bits = [](const int movemask) {
+        return static_cast<std::uint64_t>(static_cast<unsigned>(movemask));
+    };
+
+    std::uint64_t mask = 0;
+    if constexpr (std::is_same_v<Type, float>) {
+        const __m256 needle = _mm256_set1_ps(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 8) {
+            const __m256 equal =
+                _mm256_cmp_ps(_mm256_loadu_ps(data + k), needle, _CMP_EQ_OQ);
+            mask |= bits(_mm256_movemask_ps(equal)) << k;
+        }
+    } else if constexpr (std::is_same_v<Type, double>) {
+        const __m256d needle = _mm256_set1_pd(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 4) {
+            const __m256d equal =
+                _mm256_cmp_pd(_mm256_loadu_pd(data + k), needle, _CMP_EQ_OQ);
+            mask |= bits(_mm256_movemask_pd(equal)) << k;
+        }
+    } else if constexpr (sizeof(Type) == 1) {
+        const __m256i needle = _mm256_set1_epi8(std::bit_cast<char>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 32) {
+            const __m256i equal = _mm256_cmpeq_epi8(loadAvx2(data + k), needle);
+            mask |= bits(_mm256_movemask_epi8(equal)) << k;
+        }
+    } else if constexpr (sizeof(Type) == 2) {
+        // The pack works per 128-bit lane; the permute restores element
+        // order
+        const __m256i needle = _mm256_set1_epi16(std::bit_cast<short>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 32) {
+            const __m256i low =
+                _mm256_cmpeq_epi16(loadAvx2(data + k), needle);
+            const __m256i high =
+                _mm256_cmpeq_epi16(loadAvx2(data + k + 16), needle);
+            const __m256i packed = _mm256_permute4x64_epi64(
+                _mm256_packs_epi16(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+            mask |= bits(_mm256_movemask_epi8(packed)) << k;
+        }
+    } else if constexpr (sizeof(Type) == 4) {
+        const __m256i needle = _mm256_set1_epi32(std::bit_cast<int>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 8) {
+            const __m256i equal =
+                _mm256_cmpeq_epi32(loadAvx2(data + k), needle);
+            mask |= bits(_mm256_movemask_ps(_mm256_castsi256_ps(equal))) << k;
+        }
+    } else {
+        const __m256i needle =
+            _mm256_set1_epi64x(std::bit_cast<long long>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 4) {
+            const __m256i equal =
+                _mm256_cmpeq_epi64(loadAvx2(data + k), needle);
+            mask |= bits(_mm256_movemask_pd(_mm256_castsi256_pd(equal))) << k;
+        }
+    }
+    return mask;
+}
+
+
+/// equalMaskSse2() with 512-bit AVX-512 compares into mask registers.
+template <typename Type>
+[[gnu::target("avx512f,avx512bw")]] std::uint64_t
+equalMaskAvx512(const Type* data, const Type value) noexcept {
+    std::uint64_t mask = 0;
+    if constexpr (std::is_same_v<Type, float>) {
+        const __m512 needle = _mm512_set1_ps(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 16) {
+            const __m512 block = _mm512_loadu_ps(data + k);
+            mask |= std::uint64_t{_mm512_cmp_ps_mask(block, needle, _CMP_EQ_OQ)}
+                    << k;
+        }
+    } else if constexpr (std::is_same_v<Type, double>) {
+        const __m512d needle = _mm512_set1_pd(value);
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 8) {
+            const __m512d block = _mm512_loadu_pd(data + k);
+            mask |= std::uint64_t{_mm512_cmp_pd_mask(block, needle, _CMP_EQ_OQ)}
+                    << k;
+        }
+    } else if constexpr (sizeof(Type) == 1) {
+        mask = _mm512_cmpeq_epi8_mask(
+            loadAvx512(data), _mm512_set1_epi8(std::bit_cast<char>(value)));
+    } else if constexpr (sizeof(Type) == 2) {
+        const __m512i needle = _mm512_set1_epi16(std::bit_cast<short>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 32) {
+            const __m512i block = loadAvx512(data + k);
+            mask |= std::uint64_t{_mm512_cmpeq_epi16_mask(block, needle)} << k;
+        }
+    } else if constexpr (sizeof(Type) == 4) {
+        const __m512i needle = _mm512_set1_epi32(std::bit_cast<int>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 16) {
+            const __m512i block = loadAvx512(data + k);
+            mask |= std::uint64_t{_mm512_cmpeq_epi32_mask(block, needle)} << k;
+        }
+    } else {
+        const __m512i needle =
+            _mm512_set1_epi64(std::bit_cast<long long>(value));
+        for (std::size_t k = 0; k < BLOCK_SIZE; k += 8) {
+            const __m512i block = loadAvx512(data + k);
+            mask |= std::uint64_t{_mm512_cmpeq_epi64_mask(block, needle)} << k;
+        }
+    }
+    return mask;
+}
+
+#endif // DATA_STRUCTS_SIMD_X86
+
+
+/// Bit k of the result is set iff data[k] == value, for k < BLOCK_SIZE,
+/// computed with the given instruction set.
+template <typename Type>
+std::uint64_t equalMask(const Type* data, const Type& value,
+                        const Isa isa) noexcept {
+#if DATA_STRUCTS_SIMD_X86
+    if (isa == Isa::AVX512)
+        return equalMaskAvx512(data, value);
+    if (isa == Isa::AVX2)
+        return equalMaskAvx2(data, value);
+    return equalMaskSse2(data, value);
+#else
+    (void)isa;
+    std::uint64_t mask = 0;
+    for (std::size_t k = 0; k < BLOCK_SIZE; ++k)
+        mask |= std::uint64_t{data[k] == value} << k;
+    return mask;
+#endif
+}
+
+
+/**
+ * @brief Feed the equality masks of consecutive blocks of [0, size) to
+ * `on_block(base, mask)`, where bit k of `mask` stands for data[base + k],
+ * until it returns true.
+ *
+ * Requires size >= BLOCK_SIZE. A partial last block is handled by comparing
+ * the last BLOCK_SIZE elements and dropping the bits of those already
+ * reported, so every element is reported exactly once and nothing is read
+ * out of bounds.
+ *
+ * @return true if `on_block` stopped the scan.
+ */
+template <typename Type, typename OnBlock>
+bool scanBlocks(const Type* data, const std::size_t size, const Type& value,
+                const Isa isa, OnBlock&& on_block) {
+    std::size_t base = 0;
+    for (; base + BLOCK_SIZE <= size; base += BLOCK_SIZE)
+        if (on_block(base, equalMask(data + base, value, isa)))
+            return true;
+    if (base == size)
+        return false;
+
+    const std::size_t last = size - BLOCK_SIZE;
+    return on_block(base, equalMask(data + last, value, isa) >> (base - last));
+}
+
+
+/**
+ * @brief Index of the first element equal to `value`, or `size` if there is
+ * none.
+ *
+ * Uses operator== semantics: for float/double, NaN matches nothing and
+ * -0.0 matches 0.0.
+ *
+ * @param isa Instruction set to use; must not exceed supportedIsa().
+ *
+ * @par Complexity
+ * - O(n) time, BLOCK_SIZE elements per step.
+ * - O(1) space.
+ */
+template <typename Type>
+    requires IS_VECTORIZABLE<Type>
+std::size_t findFirst(const Type* data, const std::size_t size,
+                      const Type& value,
+                      const Isa isa = supportedIsa()) noexcept {
+    if (isa == Isa::SCALAR || size < BLOCK_SIZE) {
+        for (std::size_t i = 0; i < size; ++i)
+            if (data[i] == value)
+                return i;
+        return size;
+    }
+
+    std::size_t found = size;
+    scanBlocks(data, size, value, isa,
+               [&found](const std::size_t base, const std::uint64_t mask) {
+                   if (mask == 0)
+                       return false;
+                   found = base + std::countr_zero(mask);
+                   return true;
+               });
+    return found;
+}
+
+
+/// Number of elements equal to `value`; see findFirst().
+template <typename Type>
+    requires IS_VECTORIZABLE<Type>
+std::size_t count(const Type* data, const std::size_t size, const Type& value,
+                  const Isa isa = supportedIsa()) noexcept {
+    std::size_t matches = 0;
+    if (isa == Isa::SCALAR || size < BLOCK_SIZE) {
+        for (std::size_t i = 0; i < size; ++i)
+            matches += data[i] == value;
+        return matches;
+    }
+
+    scanBlocks(data, size, value, isa,
+               [&matches](std::size_t, const std::uint64_t mask) {
+                   matches += static_cast<std::size_t>(std::popcount(mask));
+                   return false;
+               });
+    return matches;
+}
+
+
+/**
+ * @brief Call visit(i) for the index i of every element equal to `value`,
+ * in increasing order; see findFirst().
+ *
+ * @par Exception Safety
+ * - An exception thrown by `visit` ends the scan and propagates.
+ */
+template <typename Type, typename Visitor>
+    requires IS_VECTORIZABLE<Type>
+void findAll(const Type* data, const std::size_t size, const Type& value,
+             Visitor&& visit, const Isa isa = supportedIsa()) {
+    if (isa == Isa::SCALAR || size < BLOCK_SIZE) {
+        for (std::size_t i = 0; i < size; ++i)
+            if (data[i] == value)
+                visit(i);
+        return;
+    }
+
+    scanBlocks(data, size, value, isa,
+               [&visit](const std::size_t base, std::uint64_t mask) {
+                   for (; mask != 0; mask &= mask - 1)
+                       visit(base + std::countr_zero(mask));
+                   return false;
+               });
+}
+
+
+/*** Reductions ***/
+
+
+enum class Reduction { MIN, MAX, SUM };
+
+/// Sums of integers wrap around (modulo 2^bits), so they are accumulated in
+/// the unsigned type, where that is defined behaviour.
+template <Reduction Op, typename Type>
+using Accumulator = typename std::conditional_t<
+    Op == Reduction::SUM && std::is_integral_v<Type>,
+    std::make_unsigned<Type>, std::type_identity<Type>>::type;
+
+
+template <Reduction Op, typename Acc>
+constexpr Acc combine(const Acc a, const Acc b) noexcept {
+    if constexpr (Op == Reduction::MIN)
+        return b < a ? b : a;
+    else if constexpr (Op == Reduction::MAX)
+        return a < b ? b : a;
+    else
+        return static_cast<Acc>(a + b);
+}
+
+
+/**
+ * @brief Reduce [0, size) into REDUCTION_LANES independent partial results,
+ * then combine those and the tail.
+ *
+ * The partial results do not depend on each other, so the inner loop is a
+ * plain element-wise vector operation without reassociation; it is
+ * vectorized with whatever instruction set the calling function is compiled
+ * for. The order of the additions depends only on `size`, never on the
+ * instruction set. Requires size >= REDUCTION_LANES<Type>.
+ */
+template <Reduction Op, typename Type>
+[[gnu::always_inline]] inline Type
+reduceLanes(const Type* data, const std::size_t size) noexcept {
+    using Acc = Accumulator<Op, Type>;
+    constexpr std::size_t lanes = REDUCTION_LANES<Type>;
+
+    Acc partial[lanes];
+    for (std::size_t j = 0; j < lanes; ++j)
+        partial[j] = static_cast<Acc>(data[j]);
+
+    std::size_t i = lanes;
+    for (; i + lanes <= size; i += lanes)
+        for (std::size_t j = 0; j < lanes; ++j)
+            partial[j] =
+                combine<Op>(partial[j], static_cast<Acc>(data[i + j]));
+
+    Acc result = partial[0];
+    for (std::size_t j = 1; j < lanes; ++j)
+        result = combine<Op>(result, partial[j]);
+    for (; i < size; ++i)
+        result = combine<Op>(result, static_cast<Acc>(data[i]));
+    return static_cast<Type>(result);
+}
+
+
+#if DATA_STRUCTS_SIMD_X86
+
+template <Reduction Op, typename Type>
+[[gnu::target("avx2")]] Type reduceAvx2(const Type* data,
+                                        const std::size_t size) noexcept {
+    return reduceLanes<Op>(data, size);
+}
+
+
+template <Reduction Op, typename Type>
+[[gnu::target("avx512f,avx512bw")]] Type
+reduceAvx512(const Type* data, const std::size_t size) noexcept {
+    return reduceLanes<Op>(data, size);
+}
+
+#endif // DATA_STRUCTS_SIMD_X86
+
+
+/// Reduce [0, size) with the given instruction set. Requires size > 0 for
+/// MIN and MAX.
+template <Reduction Op, typename Type>
+Type reduce(const Type* data, const std::size_t size, const Isa isa) noexcept {
+    if (size >= REDUCTION_LANES<Type>) {
+#if DATA_STRUCTS_SIMD_X86
+        if (isa == Isa::AVX512)
+            return reduceAvx512<Op>(data, size);
+        if (isa == Isa::AVX2)
+            return reduceAvx2<Op>(data, size);
+#else
+        (void)isa;
+#endif
+        return reduceLanes<Op>(data, size);
+    }
+
+    using Acc = Accumulator<Op, Type>;
+    if (size == 0)
+        return Type{};
+    Acc result = static_cast<Acc>(data[0]);
+    for (std::size_t i = 1; i < size; ++i)
+        result = combine<Op>(result, static_cast<Acc>(data[i]));
+    return static_cast<Type>(result);
+}
+
+
+/**
+ * @brief Smallest element of a non-empty array.
+ *
+ * Note for float/double: with NaN in the array the result is unspecified,
+ * and so is which of -0.0 and 0.0 is returned when both are present.
+ *
+ * @param isa Instruction set to use; must not exceed supportedIsa().
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+    requires IS_VECTORIZABLE<Type>
+Type minimum(const Type* data, const std::size_t size,
+             const Isa isa = supportedIsa()) noexcept {
+    return reduce<Reduction::MIN>(data, size, isa);
+}
+
+
+/// Largest element of a non-empty array; see minimum().
+template <typename Type>
+    requires IS_VECTORIZABLE<Type>
+Type maximum(const Type* data, const std::size_t size,
+             const Isa isa = supportedIsa()) noexcept {
+    return reduce<Reduction::MAX>(data, size, isa);
+}
+
+
+/**
+ * @brief Sum of the elements (0 for an empty array).
+ *
+ * Integer sums wrap around modulo 2^bits. Floating-point sums are added in
+ * REDUCTION_LANES interleaved partial sums, so the rounding differs from a
+ * left-to-right loop, but the result is the same for every instruction set.
+ *
+ * @param isa Instruction set to use; must not exceed supportedIsa().
+ *
+ * @par Complexity
+ * - O(n) time.
+ * - O(1) space.
+ */
+template <typename Type>
+    requires IS_VECTORIZABLE<Type>
+Type sum(const Type* data, const std::size_t size,
+         const Isa isa = supportedIsa()) noexcept {
+    return reduce<Reduction::SUM>(data, size, isa);
+}
+
+} // namespace data_structs::simd
+
+#endif // SIMD_KERNELS_HPP
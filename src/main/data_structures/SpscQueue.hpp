@@ -0,0 +1,331 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace data_structs {
+
+
+/**
+ * @class SpscQueue
+ * @brief Bounded lock-free FIFO queue for exactly one producer thread and one
+ * consumer thread.
+ *
+ * Uses the circular layout of Queue: a raw buffer whose capacity is a power
+ * of two, indexed by masking the free-running counters `tail` (elements ever
+ * enqueued) and `head` (elements ever dequeued). Only the producer writes
+ * `tail` and only the consumer writes `head`, so neither needs a
+ * read-modify-write: an element is published by a release store of `tail`
+ * after its construction and a slot is handed back by a release store of
+ * `head` after its destruction; the other side reads them with acquire.
+ *
+ * Each side works on its own cache line holding its counter and a cached
+ * copy of the other side's counter. The remote counter is loaded again only
+ * when the cached value says the queue is full (producer) or empty
+ * (consumer), so in steady state the two cores exchange a cache line only
+ * about once per wrap of the slack between them, not on every operation.
+ * tryEnqueueN / tryDequeueN move a whole batch for one such exchange.
+ *
+ * @tparam Type Element type; must be MoveConstructible.
+ * @tparam Allocator Source of the ring buffer's raw storage.
+ *
+ * @par Thread-safety
+ * - The enqueue family may be called by one thread at a time (the producer)
+ *   and the dequeue family by one other thread at a time (the consumer).
+ *   Handing either role over to another thread needs a happens-before edge
+ *   (a join, a mutex, ...) between the old and new owner.
+ * - size() and isEmpty() may be called from either side; under concurrent
+ *   use their result is a snapshot that may be stale.
+ *
+ * @par Performance
+ * - Every operation is wait-free and O(1) (O(n) for a batch of n), with no
+ *   allocation after construction.
+ *
+ * @par Exception safety
+ * - If constructing an element throws, nothing is published (a batch
+ *   publishes the elements constructed before it) and the exception
+ *   propagates.
+ * - If moving an element out throws, it stays at the front of the queue.
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class SpscQueue {
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename AllocatorTraits::value_type, Type>,
+                  "Allocator::value_type must be Type");
+    static_assert(std::is_same_v<typename AllocatorTraits::pointer, Type*>,
+                  "Fancy pointers are not supported");
+    static_assert(std::is_move_constructible_v<Type>,
+                  "Type must be MoveConstructible");
+
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    /// Largest power-of-two capacity whose size in bytes fits a size_t.
+    static constexpr std::size_t HARD_MAX_ELEMENTS = std::bit_floor(
+        std::numeric_limits<std::size_t>::max() / sizeof(Type));
+
+    /// Written by the producer only.
+    struct alignas(CACHE_LINE) ProducerSide {
+        std::atomic<std::size_t> tail{0};
+        /// Last value of `head` the producer has seen.
+        std::size_t cached_head = 0;
+    };
+
+    /// Written by the consumer only.
+    struct alignas(CACHE_LINE) ConsumerSide {
+        std::atomic<std::size_t> head{0};
+        /// Last value of `tail` the consumer has seen.
+        std::size_t cached_tail = 0;
+    };
+
+    static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+    // Read-only after construction, shared by both sides
+    [[no_unique_address]] Allocator allocator_;
+    Type* buffer_;
+    std::size_t capacity_;
+    std::size_t mask_;
+
+    ProducerSide producer_;
+    ConsumerSide consumer_;
+
+
+    static std::size_t ringCapacity(const std::size_t capacity) {
+        if (capacity > HARD_MAX_ELEMENTS)
+            throw std::length_error("SpscQueue capacity exceeded");
+        return std::bit_ceil(std::max<std::size_t>(capacity, 1));
+    }
+
+
+    /**
+     * @brief Free slots the producer may fill, starting at `tail`.
+     *
+     * Trusts the cached head while it leaves room for `wanted` elements and
+     * reloads it otherwise.
+     */
+    std::size_t freeSlots(const std::size_t tail,
+                          const std::size_t wanted) noexcept {
+        std::size_t free = capacity_ - (tail - producer_.cached_head);
+        if (free < wanted) {
+            producer_.cached_head =
+                consumer_.head.load(std::memory_order_acquire);
+            free = capacity_ - (tail - producer_.cached_head);
+        }
+        return free;
+    }
+
+
+    /**
+     * @brief Elements the consumer may take, starting at `head`.
+     *
+     * Trusts the cached tail while it shows `wanted` elements and reloads it
+     * otherwise.
+     */
+    std::size_t readySlots(const std::size_t head,
+                           const std::size_t wanted) noexcept {
+        std::size_t ready = consumer_.cached_tail - head;
+        if (ready < wanted) {
+            consumer_.cached_tail =
+                producer_.tail.load(std::memory_order_acquire);
+            ready = consumer_.cached_tail - head;
+        }
+        return ready;
+    }
+
+
+  public:
+    /**
+     * @brief Create an empty queue holding up to `capacity` elements,
+     * rounded up to a power of two.
+     *
+     * @throws std::length_error If the rounded capacity does not fit.
+     * @throws std::bad_alloc If the buffer cannot be allocated.
+     */
+    explicit SpscQueue(const std::size_t capacity,
+                       const Allocator& allocator = Allocator())
+        : allocator_(allocator), buffer_(nullptr),
+          capacity_(ringCapacity(capacity)), mask_(capacity_ - 1) {
+        buffer_ = AllocatorTraits::allocate(allocator_, capacity_);
+    }
+
+    // Both threads hold on to the queue; it cannot be copied or moved
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// Destroys the remaining elements; neither side may still be running.
+    ~SpscQueue() {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+        for (std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+             head != tail; ++head)
+            buffer_[head & mask_].~Type();
+        AllocatorTraits::deallocate(allocator_, buffer_, capacity_);
+    }
+
+
+    /// Maximum number of elements (a power of two).
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Number of elements; a snapshot under concurrent use.
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        // Load head first: tail only grows, so the difference cannot wrap
+        const std::size_t head = consumer_.head.load(std::memory_order_acquire);
+        const std::size_t tail = producer_.tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /// Checks if the queue is empty; a snapshot under concurrent use.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Returns a copy of the allocator supplying the queue's storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return allocator_;
+    }
+
+
+    /**
+     * @brief Construct an element from `args` at the back, unless the queue
+     * is full. Producer only.
+     *
+     * @return False (and nothing is constructed) if the queue is full.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+        if (freeSlots(tail, 1) == 0)
+            return false;
+
+        ::new (static_cast<void*>(buffer_ + (tail & mask_)))
+            Type(std::forward<Args>(args)...);
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+
+    /**
+     * @brief Append `element` at the back, unless the queue is full.
+     * Producer only.
+     *
+     * @return False (and `element` is untouched) if the queue is full.
+     */
+    template <typename U>
+    bool tryEnqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        return tryEmplace(std::forward<U>(element));
+    }
+
+
+    /**
+     * @brief Append up to `count` elements constructed from `*first`,
+     * `*(first + 1)`, ..., publishing them with a single store. Producer
+     * only.
+     *
+     * Pass a std::move_iterator to move the elements in.
+     *
+     * @return How many were enqueued; less than `count` only if the queue
+     * filled up.
+     */
+    template <std::input_iterator InputIt>
+    std::size_t tryEnqueueN(InputIt first, const std::size_t count) {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+        const std::size_t batch = std::min(count, freeSlots(tail, count));
+
+        std::size_t done = 0;
+        try {
+            for (; done < batch; ++done, ++first)
+                ::new (static_cast<void*>(buffer_ + ((tail + done) & mask_)))
+                    Type(*first);
+        } catch (...) {
+            producer_.tail.store(tail + done, std::memory_order_release);
+            throw;
+        }
+        producer_.tail.store(tail + batch, std::memory_order_release);
+        return batch;
+    }
+
+
+    /**
+     * @brief Remove the front element, unless the queue is empty. Consumer
+     * only.
+     *
+     * @return The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<Type> tryDequeue() {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+        if (readySlots(head, 1) == 0)
+            return std::nullopt;
+
+        Type& slot = buffer_[head & mask_];
+        std::optional<Type> element(std::move(slot));
+        slot.~Type();
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return element;
+    }
+
+
+    /**
+     * @brief Move up to `count` elements from the front to `out`, handing
+     * their slots back with a single store. Consumer only.
+     *
+     * @param out Output iterator accepting `Type&&`.
+     * @return How many were dequeued; less than `count` only if the queue
+     * ran empty.
+     */
+    template <typename OutputIt>
+        requires std::output_iterator<OutputIt, Type&&>
+    std::size_t tryDequeueN(OutputIt out, const std::size_t count) {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+        const std::size_t batch = std::min(count, readySlots(head, count));
+
+        std::size_t done = 0;
+        try {
+            for (; done < batch; ++done, ++out) {
+                Type& slot = buffer_[(head + done) & mask_];
+                *out = std::move(slot);
+                slot.~Type();
+            }
+        } catch (...) {
+            consumer_.head.store(head + done, std::memory_order_release);
+            throw;
+        }
+        consumer_.head.store(head + batch, std::memory_order_release);
+        return batch;
+    }
+
+
+    /**
+     * @brief The front element, or nullptr if the queue is empty. Consumer
+     * only; valid until the element is dequeued.
+     */
+    [[nodiscard]]
+    Type* front() noexcept {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+        return readySlots(head, 1) == 0 ? nullptr : buffer_ + (head & mask_);
+    }
+};
+
+} // namespace data_structs
+
+#endif // SPSC_QUEUE_HPP
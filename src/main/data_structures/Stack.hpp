@@ -2,6 +2,8 @@
 #define STACK_HPP
 
 
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -24,6 +26,10 @@ namespace data_structs {
  * to the underlying dynamic array.
  *
  * @tparam Type Element type stored by the stack.
+ * @tparam Allocator Allocator of the underlying DynamicArray.
+ * @tparam GrowthPolicy Capacity management of the underlying DynamicArray;
+ * push/pop-heavy workloads may want one that does not shrink, see
+ * DefaultGrowthPolicy.
  *
  * @par Core semantics
  * - push/emplace: add a new element to the top.
@@ -69,16 +75,24 @@ namespace data_structs {
  * - Use shrinkToFit() to release memory after large temporary spikes.
  */
 
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = DefaultGrowthPolicy>
 class Stack {
 
-    DynamicArray<Type> array_;
+    using Storage = DynamicArray<Type, Allocator, GrowthPolicy>;
+
+    Storage array_;
 
   public:
     Stack() : array_() {}
 
+    /// Creates an empty stack whose storage comes from `allocator`.
+    explicit Stack(const Allocator& allocator) : array_(allocator) {}
+
     /// Constructor with initial capacity
-    explicit Stack(const std::size_t capacity) : array_() {
+    explicit Stack(const std::size_t capacity,
+                   const Allocator& allocator = Allocator())
+        : array_(allocator) {
         array_.reserve(capacity);
     }
 
@@ -91,9 +105,11 @@ class Stack {
      *
      * @param initial_data Pointer to the initial data array.
      * @param initial_size The number of elements in the initial data array.
+     * @param allocator Source of the stack's storage.
      */
-    Stack(const Type* initial_data, const std::size_t initial_size)
-        : array_(initial_data, initial_size) {}
+    Stack(const Type* initial_data, const std::size_t initial_size,
+          const Allocator& allocator = Allocator())
+        : array_(initial_data, initial_size, allocator) {}
 
     /// Copy constructor
     Stack(const Stack& other) : array_(other.array_) {}
@@ -110,7 +126,8 @@ class Stack {
     }
 
     /// Move assignment operator
-    Stack& operator=(Stack&& other) noexcept {
+    Stack& operator=(Stack&& other) noexcept(
+        std::is_nothrow_move_assignable_v<Storage>) {
         if (this == &other)
             return *this;
         array_ = std::move(other.array_);
@@ -118,6 +135,12 @@ class Stack {
     }
 
 
+    /// Returns a copy of the allocator supplying the stack's storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return array_.getAllocator();
+    }
+
     /// Checks if the stack is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
@@ -246,9 +269,45 @@ class Stack {
     }
 
 
+    /**
+     * Write the stack, bottom to top, in the binary container format (see
+     * Serialization.hpp); raw elements are written as one block.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void serialize(std::ostream& out) const {
+        array_.serializeAs(out, SerializedKind::STACK);
+    }
+
+
+    /**
+     * Read a stack written by serialize(), with one allocation and, for raw
+     * elements, a single read.
+     *
+     * @throws std::runtime_error If the data is not a serialized stack of
+     * Type, or is truncated.
+     */
+    static Stack deserialize(std::istream& in,
+                             const Allocator& allocator = Allocator()) {
+        Stack stack(allocator);
+        stack.array_ =
+            Storage::deserializeAs(in, SerializedKind::STACK, allocator);
+        return stack;
+    }
+
+
     ~Stack() = default;
 };
 
+
+namespace pmr {
+
+/// Stack whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using Stack = data_structs::Stack<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace data_structs
 
 #endif // STACK_HPP
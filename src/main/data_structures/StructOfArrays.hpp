@@ -0,0 +1,453 @@
+#ifndef STRUCT_OF_ARRAYS_HPP
+#define STRUCT_OF_ARRAYS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+
+
+namespace data_structs {
+
+
+template <typename Row, typename Allocator = std::allocator<Row>,
+          typename GrowthPolicy = DefaultGrowthPolicy>
+class StructOfArrays;
+
+
+/**
+ * @class StructOfArrays
+ * @brief Table of records stored column by column: one DynamicArray per
+ * field.
+ *
+ * A DynamicArray of structs interleaves the fields, so a scan, sort or
+ * filter over one field pulls every other field through the cache with it.
+ * Here each field lives in a contiguous column of its own: column<I>() is a
+ * plain span that the algorithms (and the SIMD kernels) run over directly,
+ * and only the columns an operation actually reads are touched.
+ *
+ * Rows are addressed by index. get(idx) returns a tuple of references into
+ * the columns (a proxy row), which can be read with std::get, assigned
+ * through, or unpacked with structured bindings; iteration yields the same
+ * proxies. algo::SortByColumn sorts the rows by one column.
+ *
+ * Growth, shrinking and exception safety come from the columns, which share
+ * the growth policy and the allocator (rebound to each field type).
+ *
+ * @tparam Fields The field types of a row; at least one.
+ * @tparam Allocator Allocator for the rows; each column rebinds it.
+ * @tparam GrowthPolicy Capacity management of every column, see
+ * DefaultGrowthPolicy.
+ *
+ * @par Complexity
+ * - addLast: amortized O(1) per column.
+ * - removeLast / get / column: O(1).
+ * - permute: O(n) per column.
+ *
+ * @par Exception Safety
+ * - addLast, removeLast and permute: strong; a failure in one column undoes
+ *   the change in the others. Columns may keep a larger capacity.
+ * - reserve / shrinkToFit: the rows are unchanged on failure; columns
+ *   processed before the failure keep their new capacity.
+ *
+ * @par Invalidation
+ * - As for DynamicArray: any insert/remove/resize invalidates spans, proxies
+ *   and iterators.
+ *
+ * @par Moved-from State
+ * - A moved-from table is valid and empty.
+ */
+template <typename... Fields, typename Allocator, typename GrowthPolicy>
+class StructOfArrays<std::tuple<Fields...>, Allocator, GrowthPolicy> {
+
+    static_assert(sizeof...(Fields) > 0, "A row needs at least one field");
+
+    template <typename Field>
+    using FieldAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Field>;
+
+    template <typename Field>
+    using ColumnArray =
+        DynamicArray<Field, FieldAllocator<Field>, GrowthPolicy>;
+
+    using Columns = std::tuple<ColumnArray<Fields>...>;
+    using Indices = std::index_sequence_for<Fields...>;
+
+    Columns columns_;
+
+
+    template <std::size_t... I, typename... Args>
+    void appendRow(std::index_sequence<I...>, Args&&... fields) {
+        const std::size_t old_size = size();
+        std::size_t appended = 0;
+        try {
+            ((std::get<I>(columns_).emplaceLast(std::forward<Args>(fields)),
+              ++appended),
+             ...);
+        } catch (...) {
+            ((I < appended ? std::get<I>(columns_).truncate(old_size)
+                           : void()),
+             ...);
+            throw;
+        }
+    }
+
+
+    /// Fill `target` with the column's rows in `order`. Moves if that
+    /// cannot throw, otherwise copies, so that the source stays intact.
+    template <std::size_t I, typename Column>
+    void gatherColumn(Column& target,
+                      const std::span<const std::size_t> order) {
+        auto& source = std::get<I>(columns_);
+        for (const std::size_t row : order)
+            target.addLast(std::move_if_noexcept(source.getUnchecked(row)));
+    }
+
+
+    /// A field as removeLast() takes it out: moved when no field of the row
+    /// can throw on move, otherwise copied (if it can be), so that a failed
+    /// copy leaves every field of the row in place.
+    template <typename Field>
+    static decltype(auto) takeField(Field& field) noexcept {
+        if constexpr ((std::is_nothrow_move_constructible_v<Fields> && ...) ||
+                      !std::is_copy_constructible_v<Field>)
+            return std::move(field);
+        else
+            return std::as_const(field);
+    }
+
+
+    template <std::size_t... I>
+    void permuteColumns(std::index_sequence<I...>,
+                        const std::span<const std::size_t> order) {
+        Columns permuted(ColumnArray<Fields>(
+            std::get<I>(columns_).getAllocator())...);
+        (std::get<I>(permuted).reserve(order.size()), ...);
+
+        // Columns that have to copy may throw, so they go first: until the
+        // last of them is done, no source element has been moved from
+        constexpr bool MOVES[] = {
+            std::is_nothrow_move_constructible_v<Fields>...};
+        ((MOVES[I] ? void() : gatherColumn<I>(std::get<I>(permuted), order)),
+         ...);
+        ((MOVES[I] ? gatherColumn<I>(std::get<I>(permuted), order) : void()),
+         ...);
+
+        columns_ = std::move(permuted);
+    }
+
+
+    /// Copy all columns aside, then move them in, so that a failed copy
+    /// leaves every column unchanged.
+    template <std::size_t... I>
+    void copyColumns(std::index_sequence<I...>, const StructOfArrays& other) {
+        Columns copy(ColumnArray<Fields>(
+            std::get<I>(other.columns_),
+            std::allocator_traits<FieldAllocator<Fields>>::
+                    propagate_on_container_copy_assignment::value
+                ? std::get<I>(other.columns_).getAllocator()
+                : std::get<I>(columns_).getAllocator())...);
+        columns_ = std::move(copy);
+    }
+
+
+  public:
+    /// The values of one row.
+    using Row = std::tuple<Fields...>;
+
+    /// Proxy for one row: references into the columns.
+    using Reference = std::tuple<Fields&...>;
+    using ConstReference = std::tuple<const Fields&...>;
+
+    /// Type of the column at index I.
+    template <std::size_t I>
+    using ColumnType = std::tuple_element_t<I, Row>;
+
+    static constexpr std::size_t COLUMN_COUNT = sizeof...(Fields);
+
+
+    /**
+     * @brief Row iterator yielding proxy rows.
+     *
+     * Holds a table pointer and a row index; dereferencing builds the proxy,
+     * so it stays cheap to copy.
+     */
+    template <bool IsConst>
+    class RowIterator {
+        using Table = std::conditional_t<IsConst, const StructOfArrays,
+                                         StructOfArrays>;
+
+        Table* table_ = nullptr;
+        std::size_t row_ = 0;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Row;
+        using difference_type = std::ptrdiff_t;
+        using reference =
+            std::conditional_t<IsConst, ConstReference, Reference>;
+
+        RowIterator() = default;
+        RowIterator(Table* table, const std::size_t row) noexcept
+            : table_(table), row_(row) {}
+
+        reference operator*() const noexcept {
+            return table_->getUnchecked(row_);
+        }
+
+        RowIterator& operator++() noexcept {
+            ++row_;
+            return *this;
+        }
+
+        RowIterator operator++(int) noexcept {
+            RowIterator previous = *this;
+            ++row_;
+            return previous;
+        }
+
+        bool operator==(const RowIterator& other) const noexcept {
+            return row_ == other.row_;
+        }
+    };
+
+    using Iterator = RowIterator<false>;
+    using ConstIterator = RowIterator<true>;
+
+
+    /// Creates an empty table.
+    StructOfArrays() : StructOfArrays(Allocator()) {}
+
+    /// Creates an empty table whose columns allocate from `allocator`.
+    explicit StructOfArrays(const Allocator& allocator)
+        : columns_(ColumnArray<Fields>(FieldAllocator<Fields>(allocator))...) {
+    }
+
+    StructOfArrays(const StructOfArrays&) = default;
+    StructOfArrays(StructOfArrays&&) noexcept = default;
+
+    /// Copy assignment operator; strong guarantee. The allocator propagates
+    /// as for DynamicArray.
+    StructOfArrays& operator=(const StructOfArrays& other) {
+        if (this != &other)
+            copyColumns(Indices{}, other);
+        return *this;
+    }
+
+    StructOfArrays& operator=(StructOfArrays&&) = default;
+
+    ~StructOfArrays() = default;
+
+
+    /// Returns a copy of the allocator supplying the columns' storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return Allocator(std::get<0>(columns_).getAllocator());
+    }
+
+    /// Number of rows.
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return std::get<0>(columns_).size();
+    }
+
+    /// Rows that fit into every column without reallocation.
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        return std::apply(
+            [](const auto&... column) {
+                return std::min({column.capacity()...});
+            },
+            columns_);
+    }
+
+    /// Checks if the table has no rows.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size() == 0;
+    }
+
+
+    /**
+     * @brief Append a row, given one value (or constructor argument) per
+     * field.
+     *
+     * Each field is constructed in its column in order. If one throws, the
+     * fields already appended are destroyed again.
+     *
+     * @par Complexity
+     * - Amortized O(1) per column.
+     *
+     * @par Exception Safety
+     * - Strong.
+     */
+    template <typename... Args>
+    void addLast(Args&&... fields) {
+        static_assert(sizeof...(Args) == COLUMN_COUNT,
+                      "addLast takes one argument per field");
+        appendRow(Indices{}, std::forward<Args>(fields)...);
+    }
+
+
+    /**
+     * @brief Remove the last row and return its values (moved out).
+     *
+     * The capacity is kept; see shrinkToFit().
+     *
+     * @throws std::out_of_range If the table is empty.
+     *
+     * @par Exception Safety
+     * - Strong, unless a field can only be moved and its move throws: the
+     *   row is moved out only if no field can throw on move, otherwise its
+     *   fields are copied, and the row is removed afterwards.
+     */
+    Row removeLast() {
+        if (isEmpty())
+            throw std::out_of_range("Index out of range");
+
+        const std::size_t last = size() - 1;
+        Row row = std::apply(
+            [last](auto&... column) {
+                return Row(takeField(column.getUnchecked(last))...);
+            },
+            columns_);
+        std::apply([last](auto&... column) { (column.truncate(last), ...); },
+                   columns_);
+        return row;
+    }
+
+
+    /// Destroy all rows (capacity unchanged).
+    void removeAll() noexcept {
+        std::apply([](auto&... column) { (column.removeAll(), ...); },
+                   columns_);
+    }
+
+
+    /// Make room for `new_capacity` rows in every column.
+    void reserve(const std::size_t new_capacity) {
+        std::apply(
+            [new_capacity](auto&... column) {
+                (column.reserve(new_capacity), ...);
+            },
+            columns_);
+    }
+
+
+    /// Shrink every column's capacity toward size().
+    void shrinkToFit() {
+        std::apply([](auto&... column) { (column.shrinkToFit(), ...); },
+                   columns_);
+    }
+
+
+    /**
+     * @brief Bounds-checked proxy for row idx.
+     *
+     * @throws std::out_of_range If idx >= size().
+     */
+    Reference get(const std::size_t idx) {
+        if (idx >= size())
+            throw std::out_of_range("Index out of range");
+        return getUnchecked(idx);
+    }
+
+    /// Bounds-checked read-only proxy for row idx.
+    ConstReference get(const std::size_t idx) const {
+        if (idx >= size())
+            throw std::out_of_range("Index out of range");
+        return getUnchecked(idx);
+    }
+
+    /// Proxy for row idx without bounds checking (idx < size()).
+    Reference getUnchecked(const std::size_t idx) noexcept {
+        return std::apply(
+            [idx](auto&... column) {
+                return Reference(column.getUnchecked(idx)...);
+            },
+            columns_);
+    }
+
+    /// Read-only proxy for row idx without bounds checking.
+    ConstReference getUnchecked(const std::size_t idx) const noexcept {
+        return std::apply(
+            [idx](const auto&... column) {
+                return ConstReference(column.getUnchecked(idx)...);
+            },
+            columns_);
+    }
+
+
+    /**
+     * @brief Contiguous view of field I across all rows.
+     *
+     * This is what the scans and sorts in DynamicArrayAlgorithms.hpp take.
+     * Writing through the span modifies the table, but reordering it with a
+     * sort breaks up the rows; use algo::SortByColumn for that.
+     */
+    template <std::size_t I>
+    std::span<ColumnType<I>> column() noexcept {
+        return std::get<I>(columns_).span();
+    }
+
+    template <std::size_t I>
+    std::span<const ColumnType<I>> column() const noexcept {
+        return std::get<I>(columns_).span();
+    }
+
+
+    /**
+     * @brief Reorder the rows: row i becomes the former row order[i].
+     *
+     * Every column is gathered into a fresh buffer in the new order, then
+     * the buffers replace the old columns.
+     *
+     * @param order A permutation of [0, size()).
+     *
+     * @throws std::invalid_argument If order.size() != size().
+     *
+     * @par Complexity
+     * - O(n) per column, with one allocation per column.
+     *
+     * @par Exception Safety
+     * - Strong: field types whose moves may throw are copied, before any
+     *   other column is moved from.
+     */
+    void permute(const std::span<const std::size_t> order) {
+        if (order.size() != size())
+            throw std::invalid_argument("Order must cover every row");
+        permuteColumns(Indices{}, order);
+    }
+
+
+    // --- Iterator support for range-based for loops ---
+
+    Iterator begin() noexcept { return {this, 0}; }
+    Iterator end() noexcept { return {this, size()}; }
+
+    ConstIterator begin() const noexcept { return {this, 0}; }
+    ConstIterator end() const noexcept { return {this, size()}; }
+};
+
+
+namespace pmr {
+
+/// StructOfArrays whose columns come from a std::pmr::memory_resource.
+template <typename Row>
+using StructOfArrays =
+    data_structs::StructOfArrays<Row, std::pmr::polymorphic_allocator<Row>>;
+
+} // namespace pmr
+
+} // namespace data_structs
+
+#endif // STRUCT_OF_ARRAYS_HPP
@@ -0,0 +1,96 @@
+#ifndef BENCHMARK_SUPPORT_HPP
+#define BENCHMARK_SUPPORT_HPP
+
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+
+#include "InputDistributions.hpp"
+
+
+/// Smallest input size exercised by every benchmark.
+inline constexpr std::int64_t MIN_BENCHMARK_SIZE = 10;
+
+/// Largest input size for O(1)/O(log n) operations and O(n log n) sorts.
+inline constexpr std::int64_t MAX_BENCHMARK_SIZE = 10'000'000;
+
+/// Largest input size for pointer-based trees (node memory and build time).
+inline constexpr std::int64_t MAX_TREE_BENCHMARK_SIZE = 1'000'000;
+
+/// Largest input size for quadratic sorts (larger runs take hours).
+inline constexpr std::int64_t MAX_QUADRATIC_BENCHMARK_SIZE = 10'000;
+
+
+/// Sizes 10, 100, ..., max_size.
+inline void applySizes(benchmark::internal::Benchmark* bench,
+                       const std::int64_t max_size) {
+    bench->ArgName("n")->RangeMultiplier(10)->Range(MIN_BENCHMARK_SIZE,
+                                                    max_size);
+}
+
+
+/// Sizes 10 .. max_size crossed with every Distribution.
+inline void applySizesAndDistributions(benchmark::internal::Benchmark* bench,
+                                       const std::int64_t max_size) {
+    constexpr auto first = static_cast<std::int64_t>(Distribution::RANDOM);
+    constexpr auto last =
+        static_cast<std::int64_t>(Distribution::NEARLY_SORTED);
+
+    bench->ArgNames({"n", "dist"})
+        ->ArgsProduct({benchmark::CreateRange(MIN_BENCHMARK_SIZE, max_size, 10),
+                       benchmark::CreateDenseRange(first, last, 1)});
+}
+
+
+inline void containerSizes(benchmark::internal::Benchmark* bench) {
+    applySizes(bench, MAX_BENCHMARK_SIZE);
+}
+
+inline void treeSizes(benchmark::internal::Benchmark* bench) {
+    applySizes(bench, MAX_TREE_BENCHMARK_SIZE);
+}
+
+inline void treeSizesAndDistributions(benchmark::internal::Benchmark* bench) {
+    applySizesAndDistributions(bench, MAX_TREE_BENCHMARK_SIZE);
+}
+
+inline void sortSizesAndDistributions(benchmark::internal::Benchmark* bench) {
+    applySizesAndDistributions(bench, MAX_BENCHMARK_SIZE);
+}
+
+inline void
+quadraticSortSizesAndDistributions(benchmark::internal::Benchmark* bench) {
+    applySizesAndDistributions(bench, MAX_QUADRATIC_BENCHMARK_SIZE);
+}
+
+
+/// Read the (n, dist) arguments of a benchmark registered with
+/// applySizesAndDistributions and label the run with the distribution name.
+inline data_structs::DynamicArray<int>
+inputFromState(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto distribution = static_cast<Distribution>(state.range(1));
+    state.SetLabel(distributionName(distribution));
+    return makeInput(size, distribution);
+}
+
+
+/**
+ * @brief Time a single operation for benchmarks registered with
+ * UseManualTime().
+ *
+ * Used for latency measurements of operations whose setup/teardown (e.g.
+ * restoring the container to its original size) must not be counted.
+ */
+template <typename Operation>
+void timeManually(benchmark::State& state, Operation&& operation) {
+    const auto start = std::chrono::steady_clock::now();
+    operation();
+    const auto stop = std::chrono::steady_clock::now();
+    state.SetIterationTime(
+        std::chrono::duration<double>(stop - start).count());
+}
+
+
+#endif // BENCHMARK_SUPPORT_HPP
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "BinarySearchTree.hpp"
+
+
+using data_structs::BinarySearchTree;
+using data_structs::DynamicArray;
+
+
+// The tree is not self-balancing: sorted, reversed and organ-pipe inputs
+// degenerate into a list whose recursion depth equals n. Only random keys are
+// benchmarked so that every size completes.
+
+
+static BinarySearchTree<int> buildTree(const DynamicArray<int>& keys) {
+    BinarySearchTree<int> tree;
+    for (const int key : keys)
+        tree.insert(key);
+    return tree;
+}
+
+
+/// Throughput of inserting n random keys into an empty tree.
+static void BM_BinarySearchTree_Insert(benchmark::State& state) {
+    const DynamicArray<int> keys =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+
+    for (auto _ : state) {
+        BinarySearchTree<int> tree;
+        for (const int key : keys)
+            tree.insert(key);
+        benchmark::DoNotOptimize(tree.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinarySearchTree_Insert)->Apply(treeSizes);
+
+
+/// Throughput of looking up every key (all hits) in a tree of n random keys.
+static void BM_BinarySearchTree_Contains(benchmark::State& state) {
+    const DynamicArray<int> keys =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+    const BinarySearchTree<int> tree = buildTree(keys);
+
+    for (auto _ : state)
+        for (const int key : keys)
+            benchmark::DoNotOptimize(tree.contains(key));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinarySearchTree_Contains)->Apply(treeSizes);
+
+
+/// Throughput of removing every key from a tree of n random keys.
+static void BM_BinarySearchTree_Remove(benchmark::State& state) {
+    const DynamicArray<int> keys =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        BinarySearchTree<int> tree = buildTree(keys);
+        state.ResumeTiming();
+
+        for (const int key : keys)
+            tree.remove(key);
+        benchmark::DoNotOptimize(tree.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinarySearchTree_Remove)->Apply(treeSizes);
@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "DynamicArrayAlgorithms.hpp"
+
+
+using data_structs::DynamicArray;
+
+
+/**
+ * Sorts a fresh copy of the (n, dist) input on every iteration. The copy is
+ * excluded from the measurement.
+ */
+template <typename Sorter>
+static void BM_Sort(benchmark::State& state, Sorter sorter) {
+    const DynamicArray<int> input = inputFromState(state);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> array = input;
+        state.ResumeTiming();
+
+        sorter(array);
+        benchmark::DoNotOptimize(array.getFirst());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+// --- Quadratic sorts (capped at MAX_QUADRATIC_BENCHMARK_SIZE) ---
+
+BENCHMARK_CAPTURE(BM_Sort, BubbleSort,
+                  [](DynamicArray<int>& a) { algo::BubbleSort(a); })
+    ->Apply(quadraticSortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, ImprovedBubbleSort,
+                  [](DynamicArray<int>& a) { algo::ImprovedBubbleSort(a); })
+    ->Apply(quadraticSortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, InsertionSortWithLinearSearch,
+                  [](DynamicArray<int>& a) {
+                      algo::InsertionSortWithLinearSearch(a);
+                  })
+    ->Apply(quadraticSortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, InsertionSortWithBinarySearch,
+                  [](DynamicArray<int>& a) {
+                      algo::InsertionSortWithBinarySearch(a);
+                  })
+    ->Apply(quadraticSortSizesAndDistributions);
+
+
+// --- O(n log n) and linear sorts ---
+
+BENCHMARK_CAPTURE(BM_Sort, QuickSort,
+                  [](DynamicArray<int>& a) { algo::QuickSort(a); })
+    ->Apply(sortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, HeapSort,
+                  [](DynamicArray<int>& a) { algo::HeapSort(a); })
+    ->Apply(sortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, MergeSort,
+                  [](DynamicArray<int>& a) { algo::MergeSort(a); })
+    ->Apply(sortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, TimSort,
+                  [](DynamicArray<int>& a) { algo::TimSort(a); })
+    ->Apply(sortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, RadixSortLSD,
+                  [](DynamicArray<int>& a) { algo::RadixSortLSD(a); })
+    ->Apply(sortSizesAndDistributions);
+
+BENCHMARK_CAPTURE(BM_Sort, RadixSortMSD,
+                  [](DynamicArray<int>& a) { algo::RadixSortMSD(a); })
+    ->Apply(sortSizesAndDistributions);
+
+
+/// BinSort needs a dense universe: keys are folded into [0, n) first, which
+/// leaves every input except the random one unchanged.
+static void BM_BinSort(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    DynamicArray<int> input = inputFromState(state);
+    for (int& value : input)
+        value = static_cast<int>(static_cast<unsigned>(value) % size);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> array = input;
+        state.ResumeTiming();
+
+        algo::BinSort(array, size);
+        benchmark::DoNotOptimize(array.getFirst());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinSort)->Apply(sortSizesAndDistributions);
+
+
+// --- Searching ---
+
+/// Latency of a linear search for a key that is not present.
+static void BM_LinearSearchMiss(benchmark::State& state) {
+    const DynamicArray<int> array = makeInput(
+        static_cast<std::size_t>(state.range(0)), Distribution::SORTED);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algo::LinearSearch(array, -1));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_LinearSearchMiss)->Apply(containerSizes);
+
+
+/// Throughput of a full scan (count, min, max or sum) over n random ints.
+template <typename Scan>
+static void BM_Scan(benchmark::State& state, Scan scan) {
+    const DynamicArray<int> array = makeInput(
+        static_cast<std::size_t>(state.range(0)), Distribution::RANDOM);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(scan(array));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(int)));
+}
+BENCHMARK_CAPTURE(BM_Scan, Count,
+                  [](const DynamicArray<int>& a) { return algo::Count(a, 7); })
+    ->Apply(containerSizes);
+BENCHMARK_CAPTURE(BM_Scan, Min,
+                  [](const DynamicArray<int>& a) { return algo::Min(a); })
+    ->Apply(containerSizes);
+BENCHMARK_CAPTURE(BM_Scan, Max,
+                  [](const DynamicArray<int>& a) { return algo::Max(a); })
+    ->Apply(containerSizes);
+BENCHMARK_CAPTURE(BM_Scan, Sum,
+                  [](const DynamicArray<int>& a) { return algo::Sum(a); })
+    ->Apply(containerSizes);
+
+
+/// Throughput of binary searches for pseudo-random keys in a sorted array.
+static void BM_BinarySearch(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const DynamicArray<int> array = makeInput(size, Distribution::SORTED);
+    const DynamicArray<int> probes = makeInput(1024, Distribution::RANDOM);
+
+    for (auto _ : state)
+        for (const int probe : probes)
+            benchmark::DoNotOptimize(algo::BinarySearch(
+                array, static_cast<int>(static_cast<unsigned>(probe) % size)));
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_BinarySearch)->Apply(containerSizes);
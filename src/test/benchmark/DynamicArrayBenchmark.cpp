@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "DynamicArray.hpp"
+#include "InlineDynamicArray.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::InlineDynamicArray;
+
+
+/// Throughput of appending n elements to an empty array (includes growth).
+static void BM_DynamicArray_EmplaceLast(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        DynamicArray<int> array;
+        for (std::size_t i = 0; i < size; ++i)
+            array.emplaceLast(static_cast<int>(i));
+        benchmark::DoNotOptimize(array.getLast());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicArray_EmplaceLast)->Apply(containerSizes);
+
+
+/// Latency of a single insert in the middle of an array of n elements.
+static void BM_DynamicArray_InsertMiddle(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    DynamicArray<int> array = makeInput(size, Distribution::RANDOM);
+
+    for (auto _ : state) {
+        timeManually(state, [&] { array.insert(-1, size / 2); });
+        array.removeAt(size / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DynamicArray_InsertMiddle)->Apply(containerSizes)->UseManualTime();
+
+
+/// Latency of a single removeAt in the middle of an array of n elements.
+static void BM_DynamicArray_RemoveAtMiddle(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    DynamicArray<int> array = makeInput(size, Distribution::RANDOM);
+
+    for (auto _ : state) {
+        timeManually(state, [&] {
+            benchmark::DoNotOptimize(array.removeAt(size / 2));
+        });
+        array.insert(-1, size / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DynamicArray_RemoveAtMiddle)
+    ->Apply(containerSizes)
+    ->UseManualTime();
+
+
+/// Latency of inserting, then erasing, a batch of 64 elements in the middle
+/// of an array of n elements; each shifts the suffix once.
+static void BM_DynamicArray_InsertEraseRangeMiddle(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    DynamicArray<int> array = makeInput(size, Distribution::RANDOM);
+    const DynamicArray<int> batch = makeInput(64, Distribution::RANDOM);
+
+    for (auto _ : state) {
+        array.insertRange(size / 2, batch.begin(), batch.end());
+        array.eraseRange(size / 2, size / 2 + batch.size());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_DynamicArray_InsertEraseRangeMiddle)->Apply(containerSizes);
+
+
+/// Throughput of draining an array of n elements from the back.
+static void BM_DynamicArray_RemoveLast(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const DynamicArray<int> input = makeInput(size, Distribution::RANDOM);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> array = input;
+        state.ResumeTiming();
+
+        while (!array.isEmpty())
+            benchmark::DoNotOptimize(array.removeLast());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicArray_RemoveLast)->Apply(containerSizes);
+
+
+/// Building and discarding a short scratch array, as done per call or per
+/// request: DynamicArray allocates every time, an InlineDynamicArray with
+/// room for 16 elements only once it holds more than that.
+template <typename Array>
+static void BM_DynamicArray_SmallScratch(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Array array;
+        for (std::size_t i = 0; i < size; ++i)
+            array.emplaceLast(static_cast<int>(i));
+        benchmark::DoNotOptimize(array.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_DynamicArray_SmallScratch, DynamicArray<int>)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_DynamicArray_SmallScratch, InlineDynamicArray<int, 16>)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "EytzingerIndex.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::EytzingerIndex;
+
+
+/// Throughput of lookups for pseudo-random keys in an index built from a
+/// sorted array; the same probes as BM_BinarySearch.
+static void BM_EytzingerIndex_Find(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const EytzingerIndex<int> index(makeInput(size, Distribution::SORTED));
+    const DynamicArray<int> probes = makeInput(1024, Distribution::RANDOM);
+
+    for (auto _ : state)
+        for (const int probe : probes)
+            benchmark::DoNotOptimize(index.find(
+                static_cast<int>(static_cast<unsigned>(probe) % size)));
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_EytzingerIndex_Find)->Apply(containerSizes);
+
+
+/// Time to build the index from a sorted array of n keys.
+static void BM_EytzingerIndex_Build(benchmark::State& state) {
+    const DynamicArray<int> sorted = makeInput(
+        static_cast<std::size_t>(state.range(0)), Distribution::SORTED);
+
+    for (auto _ : state) {
+        EytzingerIndex<int> index(sorted);
+        benchmark::DoNotOptimize(index.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EytzingerIndex_Build)->Apply(containerSizes);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "MaxHeap.hpp"
+#include "MinHeap.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::MaxHeap;
+using data_structs::MinHeap;
+
+
+/// Throughput of inserting n keys of the given distribution into an empty
+/// heap.
+template <typename HeapType>
+static void BM_Heap_Insert(benchmark::State& state) {
+    const DynamicArray<int> keys = inputFromState(state);
+
+    for (auto _ : state) {
+        HeapType heap;
+        for (const int key : keys)
+            heap.insert(key);
+        benchmark::DoNotOptimize(heap.peekRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Heap_Insert, MinHeap<int>)
+    ->Apply(treeSizesAndDistributions);
+BENCHMARK_TEMPLATE(BM_Heap_Insert, MaxHeap<int>)
+    ->Apply(treeSizesAndDistributions);
+
+
+/// Throughput of extracting every root from a heap built from n keys of the
+/// given distribution.
+template <typename HeapType>
+static void BM_Heap_ExtractRoot(benchmark::State& state) {
+    const DynamicArray<int> keys = inputFromState(state);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HeapType heap;
+        for (const int key : keys)
+            heap.insert(key);
+        state.ResumeTiming();
+
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.extractRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Heap_ExtractRoot, MinHeap<int>)
+    ->Apply(treeSizesAndDistributions);
+BENCHMARK_TEMPLATE(BM_Heap_ExtractRoot, MaxHeap<int>)
+    ->Apply(treeSizesAndDistributions);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "LinkedList.hpp"
+
+
+using data_structs::LinkedList;
+
+
+/// Throughput of appending n elements to an empty list.
+static void BM_LinkedList_AddLast(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int> list;
+        for (std::size_t i = 0; i < size; ++i)
+            list.addLast(static_cast<int>(i));
+        benchmark::DoNotOptimize(list.back());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LinkedList_AddLast)->Apply(containerSizes);
+
+
+/// Throughput of prepending n elements to an empty list.
+static void BM_LinkedList_AddFirst(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int> list;
+        for (std::size_t i = 0; i < size; ++i)
+            list.addFirst(static_cast<int>(i));
+        benchmark::DoNotOptimize(list.front());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LinkedList_AddFirst)->Apply(containerSizes);
+
+
+/// Throughput of removing every element of a list of n elements from the
+/// front.
+static void BM_LinkedList_RemoveFirst(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        LinkedList<int> list;
+        for (std::size_t i = 0; i < size; ++i)
+            list.addLast(static_cast<int>(i));
+        state.ResumeTiming();
+
+        while (!list.isEmpty())
+            list.removeFirst();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LinkedList_RemoveFirst)->Apply(containerSizes);
+
+
+/// Latency of indexed access to the middle of a list of n elements (the
+/// worst case of the bidirectional walk).
+static void BM_LinkedList_GetMiddle(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    LinkedList<int> list;
+    for (std::size_t i = 0; i < size; ++i)
+        list.addLast(static_cast<int>(i));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(list.get(size / 2));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LinkedList_GetMiddle)->Apply(containerSizes);
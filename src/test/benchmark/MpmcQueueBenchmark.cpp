@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "MpmcQueue.hpp"
+#include "Queue.hpp"
+
+
+using data_structs::BoundedMpmcQueue;
+using data_structs::Queue;
+using data_structs::UnboundedMpmcQueue;
+
+
+static constexpr std::size_t RING_CAPACITY = 1024;
+
+
+/**
+ * Every benchmark thread enqueues one integer and dequeues one (not
+ * necessarily its own) per iteration on a queue shared by all threads, so
+ * all of them are producers and consumers at once. An operation that finds
+ * its slot still in use by a preempted thread retries, yielding in between.
+ */
+static void BM_BoundedMpmcQueue_EnqueueDequeue(benchmark::State& state) {
+    static BoundedMpmcQueue<std::uint64_t> queue(RING_CAPACITY);
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        while (!queue.tryEnqueue(sum))
+            std::this_thread::yield();
+        std::optional<std::uint64_t> value;
+        while (!(value = queue.tryDequeue()))
+            std::this_thread::yield();
+        sum += *value;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoundedMpmcQueue_EnqueueDequeue)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+
+/// The same round trip through the segmented queue.
+static void BM_UnboundedMpmcQueue_EnqueueDequeue(benchmark::State& state) {
+    static UnboundedMpmcQueue<std::uint64_t> queue;
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        queue.enqueue(sum);
+        std::optional<std::uint64_t> value;
+        while (!(value = queue.tryDequeue()))
+            std::this_thread::yield();
+        sum += *value;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UnboundedMpmcQueue_EnqueueDequeue)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+
+/// Baseline: the same round trip through a Queue behind a mutex, one lock
+/// per operation.
+static void BM_MutexQueue_EnqueueDequeue(benchmark::State& state) {
+    static Queue<std::uint64_t> queue(RING_CAPACITY);
+    static std::mutex mutex;
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        {
+            const std::scoped_lock lock(mutex);
+            queue.enqueue(sum);
+        }
+        const std::scoped_lock lock(mutex);
+        sum += queue.dequeue();
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexQueue_EnqueueDequeue)->ThreadRange(1, 64)->UseRealTime();
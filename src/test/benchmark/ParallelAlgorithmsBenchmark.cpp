@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "ParallelAlgorithms.hpp"
+
+
+using algo::ThreadPool;
+using data_structs::DynamicArray;
+
+
+/// Sizes 10^5 .. MAX_BENCHMARK_SIZE crossed with 1, 2, 4, ... threads and the
+/// hardware thread count. Wall-clock time is reported, so the threads=1 row
+/// is the baseline for the speedup.
+static void parallelSortArguments(benchmark::internal::Benchmark* bench) {
+    const auto hardware = static_cast<std::int64_t>(algo::defaultThreadCount());
+
+    bench->ArgNames({"n", "threads"});
+    for (std::int64_t size = 100000; size <= MAX_BENCHMARK_SIZE; size *= 10) {
+        for (std::int64_t threads = 1; threads < hardware; threads *= 2)
+            bench->Args({size, threads});
+        bench->Args({size, hardware});
+    }
+    bench->UseRealTime();
+}
+
+
+/**
+ * Sorts a fresh copy of an n-element random array on every iteration, on a
+ * pool of `threads` threads (the calling thread included). The copy is
+ * excluded from the measurement.
+ */
+template <typename Sorter>
+static void BM_ParallelSort(benchmark::State& state, Sorter sorter) {
+    const DynamicArray<int> input = makeInput(
+        static_cast<std::size_t>(state.range(0)), Distribution::RANDOM);
+    ThreadPool pool(static_cast<std::size_t>(state.range(1)) - 1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> array = input;
+        state.ResumeTiming();
+
+        sorter(array, pool);
+        benchmark::DoNotOptimize(array.getFirst());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK_CAPTURE(BM_ParallelSort, ParallelMergeSort,
+                  [](DynamicArray<int>& a, ThreadPool& pool) {
+                      algo::ParallelMergeSort(a, pool);
+                  })
+    ->Apply(parallelSortArguments);
+
+BENCHMARK_CAPTURE(BM_ParallelSort, ParallelQuickSort,
+                  [](DynamicArray<int>& a, ThreadPool& pool) {
+                      algo::ParallelQuickSort(a, pool);
+                  })
+    ->Apply(parallelSortArguments);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "BenchmarkSupport.hpp"
+#include "Queue.hpp"
+
+
+using data_structs::Queue;
+
+
+/// Throughput of enqueueing n elements into an empty queue (includes growth).
+static void BM_Queue_Enqueue(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Queue<int> queue;
+        for (std::size_t i = 0; i < size; ++i)
+            queue.enqueue(static_cast<int>(i));
+        benchmark::DoNotOptimize(queue.back());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Queue_Enqueue)->Apply(containerSizes);
+
+
+/// Throughput of draining a queue of n elements (includes periodic shrinks).
+static void BM_Queue_Dequeue(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Queue<int> queue;
+        for (std::size_t i = 0; i < size; ++i)
+            queue.enqueue(static_cast<int>(i));
+        state.ResumeTiming();
+
+        while (!queue.isEmpty())
+            benchmark::DoNotOptimize(queue.dequeue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Queue_Dequeue)->Apply(containerSizes);
+
+
+/// Steady-state ring traffic: one enqueue and one dequeue on a queue holding
+/// n elements, so the buffer wraps around without growing.
+static void BM_Queue_EnqueueDequeueSteadyState(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Queue<int> queue;
+    for (std::size_t i = 0; i < size; ++i)
+        queue.enqueue(static_cast<int>(i));
+
+    int value = 0;
+    for (auto _ : state) {
+        queue.enqueue(value++);
+        benchmark::DoNotOptimize(queue.dequeue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_Queue_EnqueueDequeueSteadyState)->Apply(containerSizes);
+
+
+/// A batch of messages through a long-lived queue one element at a time:
+/// enqueue all of them, then dequeue all of them into an array.
+static void BM_Queue_BatchElementwise(benchmark::State& state) {
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    std::vector<int> input(batch, 1);
+    std::vector<int> output(batch);
+    Queue<int> queue;
+
+    for (auto _ : state) {
+        for (const int value : input)
+            queue.enqueue(value);
+        for (std::size_t i = 0; i < batch; ++i)
+            output[i] = queue.dequeue();
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Queue_BatchElementwise)->ArgName("batch")->Arg(16)->Arg(1000);
+
+
+/// The same batches with enqueueRange / dequeueInto.
+static void BM_Queue_BatchBulk(benchmark::State& state) {
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    std::vector<int> input(batch, 1);
+    std::vector<int> output(batch);
+    Queue<int> queue;
+
+    for (auto _ : state) {
+        queue.enqueueRange(input.begin(), input.end());
+        queue.dequeueInto(output.data(), batch);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Queue_BatchBulk)->ArgName("batch")->Arg(16)->Arg(1000);
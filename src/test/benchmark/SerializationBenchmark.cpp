@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+
+#include "BenchmarkSupport.hpp"
+#include "BinarySearchTree.hpp"
+#include "MinHeap.hpp"
+
+
+using data_structs::BinarySearchTree;
+using data_structs::DynamicArray;
+using data_structs::MinHeap;
+
+
+// All images are held in memory, so these measure encoding and rebuilding,
+// not the disk. Compare the tree loads with BM_BinarySearchTree_Insert.
+
+
+/// Throughput of writing an array of n ints (one bulk write).
+static void BM_Serialization_DynamicArraySave(benchmark::State& state) {
+    const DynamicArray<int> array =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+
+    for (auto _ : state) {
+        std::ostringstream stream;
+        array.serialize(stream);
+        benchmark::DoNotOptimize(stream.tellp());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_Serialization_DynamicArraySave)->Apply(containerSizes);
+
+
+/// Throughput of loading an array of n ints (one allocation, one read).
+static void BM_Serialization_DynamicArrayLoad(benchmark::State& state) {
+    std::ostringstream image;
+    makeInput(static_cast<std::size_t>(state.range(0)), Distribution::RANDOM)
+        .serialize(image);
+    const std::string bytes = image.str();
+
+    for (auto _ : state) {
+        std::istringstream stream(bytes);
+        const auto array = DynamicArray<int>::deserialize(stream);
+        benchmark::DoNotOptimize(array.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_Serialization_DynamicArrayLoad)->Apply(containerSizes);
+
+
+/// Throughput of rebuilding a search tree of n random keys from its
+/// pre-order image, without any comparisons.
+static void BM_Serialization_BinarySearchTreeLoad(benchmark::State& state) {
+    const DynamicArray<int> keys =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+    BinarySearchTree<int> tree;
+    for (const int key : keys)
+        tree.insert(key);
+
+    std::ostringstream image;
+    tree.serialize(image);
+    const std::string bytes = image.str();
+
+    for (auto _ : state) {
+        std::istringstream stream(bytes);
+        const auto loaded = BinarySearchTree<int>::deserialize(stream);
+        benchmark::DoNotOptimize(loaded.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Serialization_BinarySearchTreeLoad)->Apply(treeSizes);
+
+
+/// Throughput of rebuilding a heap of n random keys without heapify.
+static void BM_Serialization_MinHeapLoad(benchmark::State& state) {
+    const DynamicArray<int> keys =
+        makeInput(static_cast<std::size_t>(state.range(0)),
+                  Distribution::RANDOM);
+    const MinHeap<int> heap(keys.data(), keys.size());
+
+    std::ostringstream image;
+    heap.serialize(image);
+    const std::string bytes = image.str();
+
+    for (auto _ : state) {
+        std::istringstream stream(bytes);
+        const auto loaded = MinHeap<int>::deserialize(stream);
+        benchmark::DoNotOptimize(loaded.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Serialization_MinHeapLoad)->Apply(treeSizes);
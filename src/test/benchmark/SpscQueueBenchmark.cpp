@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "Queue.hpp"
+#include "SpscQueue.hpp"
+
+
+using data_structs::Queue;
+using data_structs::SpscQueue;
+
+
+/// Elements handed from the producer to the consumer per iteration.
+static constexpr std::int64_t TRANSFER_COUNT = 1 << 20;
+
+static constexpr std::size_t RING_CAPACITY = 4096;
+
+
+/// Pins the calling thread to `core` where supported; failure is ignored
+/// (the numbers are then noisier, not wrong).
+static void pinCurrentThread([[maybe_unused]] const unsigned core) {
+#ifdef __linux__
+    const unsigned cores = std::thread::hardware_concurrency();
+    if (cores < 2)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+
+/**
+ * One producer thread (core 0) enqueues TRANSFER_COUNT integers in batches
+ * of `batch` while the benchmark thread (core 1) dequeues them, yielding
+ * whenever the ring is full / empty.
+ */
+static void BM_SpscQueue_Transfer(benchmark::State& state) {
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    pinCurrentThread(1);
+
+    for (auto _ : state) {
+        SpscQueue<std::uint64_t> queue(RING_CAPACITY);
+
+        std::thread producer([&queue, batch] {
+            pinCurrentThread(0);
+            std::uint64_t values[256];
+            std::uint64_t next = 0;
+            while (next < TRANSFER_COUNT) {
+                const std::size_t count = std::min<std::uint64_t>(
+                    batch, TRANSFER_COUNT - next);
+                for (std::size_t i = 0; i < count; ++i)
+                    values[i] = next + i;
+                std::size_t sent = 0;
+                while (sent < count) {
+                    const std::size_t done =
+                        queue.tryEnqueueN(values + sent, count - sent);
+                    if (done == 0)
+                        std::this_thread::yield();
+                    sent += done;
+                }
+                next += count;
+            }
+        });
+
+        std::uint64_t values[256];
+        std::uint64_t received = 0;
+        std::uint64_t sum = 0;
+        while (received < TRANSFER_COUNT) {
+            const std::size_t count = queue.tryDequeueN(values, batch);
+            if (count == 0)
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < count; ++i)
+                sum += values[i];
+            received += count;
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * TRANSFER_COUNT);
+}
+BENCHMARK(BM_SpscQueue_Transfer)
+    ->ArgName("batch")
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->UseRealTime();
+
+
+/// Baseline: the same one-to-one transfer through a Queue behind a mutex,
+/// one element per lock.
+static void BM_MutexQueue_Transfer(benchmark::State& state) {
+    pinCurrentThread(1);
+
+    for (auto _ : state) {
+        Queue<std::uint64_t> queue(RING_CAPACITY);
+        std::mutex mutex;
+
+        std::thread producer([&queue, &mutex] {
+            pinCurrentThread(0);
+            for (std::uint64_t i = 0; i < TRANSFER_COUNT; ++i) {
+                const std::scoped_lock lock(mutex);
+                queue.enqueue(i);
+            }
+        });
+
+        std::uint64_t received = 0;
+        std::uint64_t sum = 0;
+        while (received < TRANSFER_COUNT) {
+            const std::scoped_lock lock(mutex);
+            while (!queue.isEmpty()) {
+                sum += queue.dequeue();
+                ++received;
+            }
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * TRANSFER_COUNT);
+}
+BENCHMARK(BM_MutexQueue_Transfer)->UseRealTime();
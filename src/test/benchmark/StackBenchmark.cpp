@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkSupport.hpp"
+#include "Stack.hpp"
+
+
+using data_structs::Stack;
+
+
+/// Throughput of pushing n elements onto an empty stack (includes growth).
+static void BM_Stack_Push(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Stack<int> stack;
+        for (std::size_t i = 0; i < size; ++i)
+            stack.push(static_cast<int>(i));
+        benchmark::DoNotOptimize(stack.top());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Stack_Push)->Apply(containerSizes);
+
+
+/// Throughput of popping every element of a stack of n elements (includes
+/// shrinks of the underlying array).
+static void BM_Stack_Pop(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Stack<int> stack;
+        stack.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+            stack.push(static_cast<int>(i));
+        state.ResumeTiming();
+
+        while (!stack.isEmpty())
+            benchmark::DoNotOptimize(stack.pop());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Stack_Pop)->Apply(containerSizes);
+
+
+/// Latency of a push/pop pair on top of a stack holding n elements.
+static void BM_Stack_PushPopSteadyState(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Stack<int> stack;
+    for (std::size_t i = 0; i < size; ++i)
+        stack.push(static_cast<int>(i));
+
+    int value = 0;
+    for (auto _ : state) {
+        stack.push(value++);
+        benchmark::DoNotOptimize(stack.pop());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_Stack_PushPopSteadyState)->Apply(containerSizes);
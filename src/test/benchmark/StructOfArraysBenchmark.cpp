@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <tuple>
+
+#include "BenchmarkSupport.hpp"
+#include "DynamicArrayAlgorithms.hpp"
+#include "StructOfArrays.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::StructOfArrays;
+
+
+/// A 32-byte record of which the scans below read a single field.
+struct Order {
+    int quantity;
+    double price;
+    std::int64_t customer;
+    std::int64_t timestamp;
+};
+
+using OrderTable =
+    StructOfArrays<std::tuple<int, double, std::int64_t, std::int64_t>>;
+
+
+static DynamicArray<Order> makeOrders(const std::size_t size) {
+    const DynamicArray<int> keys = makeInput(size, Distribution::RANDOM);
+    DynamicArray<Order> orders;
+    orders.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto index = static_cast<std::int64_t>(i);
+        orders.addLast(Order{keys.get(i), 0.5, index, -index});
+    }
+    return orders;
+}
+
+
+static OrderTable makeOrderTable(const std::size_t size) {
+    OrderTable table;
+    table.reserve(size);
+    for (const Order& order : makeOrders(size))
+        table.addLast(order.quantity, order.price, order.customer,
+                      order.timestamp);
+    return table;
+}
+
+
+/// Summing one int field over an array of structs reads whole records.
+static void BM_StructOfArrays_SumFieldOfStructs(benchmark::State& state) {
+    const DynamicArray<Order> orders =
+        makeOrders(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const Order& order : orders)
+            sum += order.quantity;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StructOfArrays_SumFieldOfStructs)->Apply(containerSizes);
+
+
+/// The same sum over the column, which holds nothing but that field.
+static void BM_StructOfArrays_SumColumn(benchmark::State& state) {
+    const OrderTable table =
+        makeOrderTable(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const int quantity : table.column<0>())
+            sum += quantity;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StructOfArrays_SumColumn)->Apply(containerSizes);
+
+
+/// Sorting the rows by one column (key sort plus permutation).
+static void BM_StructOfArrays_SortByColumn(benchmark::State& state) {
+    const OrderTable input =
+        makeOrderTable(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        OrderTable table = input;
+        state.ResumeTiming();
+
+        algo::SortByColumn<0>(table);
+        benchmark::DoNotOptimize(table.column<0>().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StructOfArrays_SortByColumn)->Apply(treeSizes);
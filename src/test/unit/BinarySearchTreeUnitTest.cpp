@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "BinarySearchTree.hpp"
+#include "CountingAllocator.hpp"
 
 
 using data_structs::BinarySearchTree;
@@ -325,3 +327,27 @@ TEST_F(BinarySearchTreeUnitTest, EmptyTreeOperationsShouldWork) {
     tree.remove(5);
     EXPECT_TRUE(tree.isEmpty());
 }
+
+
+TEST_F(BinarySearchTreeUnitTest, NodesComeFromTheAllocator) {
+    AllocationStats stats;
+    {
+        const int values[] = {5, 3, 8, 1, 4};
+        BinarySearchTree<int, CountingAllocator<int>> tree(
+            values, 5, CountingAllocator<int>(stats));
+        tree.remove(3);
+        tree.insert(9);
+        // The removed node's slot is reused from the pool
+        EXPECT_EQ(stats.allocations, 1u);
+        EXPECT_EQ(stats.deallocations, 0u);
+        EXPECT_TRUE(tree.isValidBST());
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    data_structs::pmr::BinarySearchTree<std::string> words{&pool};
+    words.insert("m");
+    words.insert("a");
+    EXPECT_EQ(words.getAllocator().resource(), &pool);
+    EXPECT_EQ(words.findMinimum(), "a");
+}
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 
 #include "BinaryTree.hpp"
+#include "CountingAllocator.hpp"
 #include "Record.hpp"
 
 
@@ -301,3 +303,38 @@ TEST_F(BinaryTreeUnitTest, NullArrayWithZeroSizeSucceeds) {
     EXPECT_TRUE(tree.isEmpty());
     EXPECT_EQ(tree.size(), 0);
 }
+
+
+TEST_F(BinaryTreeUnitTest, NodesComeFromTheAllocator) {
+    AllocationStats stats;
+    AllocationStats other_stats;
+    {
+        using Tree = BinaryTree<int, CountingAllocator<int>>;
+        Tree tree{CountingAllocator<int>(stats)};
+        for (int i = 0; i < 7; ++i)
+            tree.insert(i);
+        // One pooled chunk holds all seven nodes
+        EXPECT_EQ(stats.allocations, 1u);
+
+        const Tree copy(tree);
+        EXPECT_EQ(stats.allocations, 2u);
+        EXPECT_EQ(copy.size(), 7u);
+
+        // Unequal, non-propagating allocators: the same shape is rebuilt
+        Tree other{CountingAllocator<int>(other_stats)};
+        other = std::move(tree);
+        EXPECT_TRUE(tree.isEmpty());
+        EXPECT_EQ(other.size(), 7u);
+        EXPECT_EQ(other.getRoot()->right->left->data, 5);
+        EXPECT_EQ(other_stats.allocations, 1u);
+        EXPECT_EQ(stats.allocations - stats.deallocations, 1u);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+    EXPECT_EQ(other_stats.bytes_in_use, 0u);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    data_structs::pmr::BinaryTree<int> pooled{&pool};
+    pooled.insert(1);
+    EXPECT_EQ(pooled.getAllocator().resource(), &pool);
+    EXPECT_TRUE(pooled.contains(1));
+}
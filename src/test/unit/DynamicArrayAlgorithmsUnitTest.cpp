@@ -0,0 +1,755 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DynamicArrayAlgorithms.hpp"
+#include "InputDistributions.hpp"
+
+
+using data_structs::DynamicArray;
+
+
+/// int wrapper that counts comparisons made through operator<.
+struct CountingInt {
+    static inline std::size_t comparisons = 0;
+    int value;
+
+    bool operator<(const CountingInt& other) const {
+        ++comparisons;
+        return value < other.value;
+    }
+};
+
+
+/// Record sorted by `key`; `order` remembers the original position.
+struct KeyedValue {
+    int key;
+    int order;
+
+    bool operator<(const KeyedValue& other) const { return key < other.key; }
+};
+
+
+/// Neither default constructible nor copyable.
+struct MoveOnlyKey {
+    std::unique_ptr<int> key;
+
+    explicit MoveOnlyKey(const int value)
+        : key(std::make_unique<int>(value)) {}
+
+    bool operator<(const MoveOnlyKey& other) const {
+        return *key < *other.key;
+    }
+};
+
+
+/// int wrapper whose operator< throws once `budget` comparisons are spent.
+struct ThrowingLess {
+    static inline long budget = -1;
+    int value;
+
+    bool operator<(const ThrowingLess& other) const {
+        if (budget == 0)
+            throw std::runtime_error("comparison budget exhausted");
+        if (budget > 0)
+            --budget;
+        return value < other.value;
+    }
+};
+
+
+class DynamicArrayAlgorithmsUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr Distribution DISTRIBUTIONS[] = {
+        Distribution::RANDOM, Distribution::SORTED, Distribution::REVERSED,
+        Distribution::FEW_UNIQUE, Distribution::ORGAN_PIPE,
+        Distribution::NEARLY_SORTED};
+
+    static constexpr std::size_t SIZES[] = {0, 1, 2, 3, 10, 31, 100, 1000};
+
+
+    static std::vector<int> sortedReference(const DynamicArray<int>& array) {
+        std::vector<int> reference(array.begin(), array.end());
+        std::sort(reference.begin(), reference.end());
+        return reference;
+    }
+
+
+    static void expectEqual(const DynamicArray<int>& array,
+                            const std::vector<int>& expected) {
+        ASSERT_EQ(array.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            ASSERT_EQ(array.get(i), expected[i]) << "at index " << i;
+    }
+
+
+    /// Runs `sorter` on every (size, distribution) combination and compares
+    /// against std::sort.
+    template <typename Sorter>
+    static void expectSortsAllInputs(Sorter sorter) {
+        for (const std::size_t size : SIZES) {
+            for (const Distribution distribution : DISTRIBUTIONS) {
+                SCOPED_TRACE(std::string(distributionName(distribution)) +
+                             " n=" + std::to_string(size));
+                DynamicArray<int> array = makeInput(size, distribution);
+                const std::vector<int> expected = sortedReference(array);
+                sorter(array);
+                expectEqual(array, expected);
+            }
+        }
+    }
+};
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BubbleSortSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::BubbleSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, ImprovedBubbleSortSortsAllInputs) {
+    expectSortsAllInputs(
+        [](DynamicArray<int>& a) { algo::ImprovedBubbleSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       InsertionSortWithLinearSearchSortsAllInputs) {
+    expectSortsAllInputs(
+        [](DynamicArray<int>& a) { algo::InsertionSortWithLinearSearch(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       InsertionSortWithBinarySearchSortsAllInputs) {
+    expectSortsAllInputs(
+        [](DynamicArray<int>& a) { algo::InsertionSortWithBinarySearch(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, QuickSortSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::QuickSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HeapSortSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::HeapSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       QuickSortIsLinearithmicOnAdversarialInputs) {
+    constexpr std::size_t size = 20000;
+    // 2 * n * log2(n) is a generous bound for introsort's comparison count
+    constexpr std::size_t budget = 2 * size * 15;
+
+    DynamicArray<int> all_equal;
+    DynamicArray<int> sorted_with_one_change;
+    DynamicArray<int> reversed;
+    for (std::size_t i = 0; i < size; ++i) {
+        all_equal.addLast(7);
+        sorted_with_one_change.addLast(static_cast<int>(i));
+        reversed.addLast(static_cast<int>(size - i));
+    }
+    sorted_with_one_change.get(size / 3) = -1;
+
+    for (DynamicArray<int>* input :
+         {&all_equal, &sorted_with_one_change, &reversed}) {
+        DynamicArray<CountingInt> counted;
+        for (const int value : *input)
+            counted.addLast(CountingInt{value});
+
+        CountingInt::comparisons = 0;
+        algo::QuickSort(counted);
+        EXPECT_LT(CountingInt::comparisons, budget);
+        EXPECT_TRUE(algo::isSorted(counted));
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       QuickSortHandlesManyDuplicatesAndNegatives) {
+    DynamicArray<int> array;
+    for (int i = 0; i < 5000; ++i)
+        array.addLast((i * 7919) % 13 - 6);
+    const std::vector<int> expected = sortedReference(array);
+    algo::QuickSort(array);
+    expectEqual(array, expected);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::MergeSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortIsStable) {
+    DynamicArray<KeyedValue> array;
+    for (int i = 0; i < 1000; ++i)
+        array.addLast(KeyedValue{(i * 7919) % 10, i});
+
+    algo::MergeSort(array);
+    for (std::size_t i = 1; i < array.size(); ++i) {
+        const KeyedValue& prev = array.get(i - 1);
+        const KeyedValue& cur = array.get(i);
+        ASSERT_LE(prev.key, cur.key);
+        if (prev.key == cur.key) {
+            ASSERT_LT(prev.order, cur.order) << "at index " << i;
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortWithCallerScratch) {
+    constexpr std::size_t size = 1000;
+    std::allocator<int> allocator;
+    int* scratch = allocator.allocate(algo::mergeSortScratchSize(size));
+
+    for (const Distribution distribution : DISTRIBUTIONS) {
+        SCOPED_TRACE(distributionName(distribution));
+        DynamicArray<int> array = makeInput(size, distribution);
+        const std::vector<int> expected = sortedReference(array);
+        algo::MergeSort(array.span(), scratch);
+        expectEqual(array, expected);
+    }
+
+    allocator.deallocate(scratch, algo::mergeSortScratchSize(size));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortSortsMoveOnlyTypes) {
+    static_assert(!std::is_default_constructible_v<MoveOnlyKey>);
+    static_assert(!std::is_copy_constructible_v<MoveOnlyKey>);
+
+    DynamicArray<MoveOnlyKey> array;
+    for (int i = 0; i < 200; ++i)
+        array.addLast(MoveOnlyKey((i * 37) % 101));
+
+    algo::MergeSort(array);
+    for (std::size_t i = 1; i < array.size(); ++i)
+        ASSERT_LE(*array.get(i - 1).key, *array.get(i).key);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       MergeSortKeepsElementsWhenComparisonThrows) {
+    const DynamicArray<int> input = makeInput(500, Distribution::RANDOM);
+    const std::vector<int> expected = sortedReference(input);
+
+    // Small budgets fail inside the insertion-sorted runs, large ones inside
+    // the merge passes
+    for (const long budget : {100L, 2000L, 4500L, 5000L, 5500L, 6000L}) {
+        SCOPED_TRACE("budget=" + std::to_string(budget));
+        DynamicArray<ThrowingLess> array;
+        for (const int value : input)
+            array.addLast(ThrowingLess{value});
+
+        ThrowingLess::budget = budget;
+        EXPECT_THROW(algo::MergeSort(array), std::runtime_error);
+        ThrowingLess::budget = -1;
+
+        std::vector<int> remaining;
+        for (const ThrowingLess& element : array)
+            remaining.push_back(element.value);
+        std::sort(remaining.begin(), remaining.end());
+        EXPECT_EQ(remaining, expected);
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TimSortSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::TimSort(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TimSortSortsLargeInputs) {
+    // Large enough for many runs, deep run stacks and galloping merges
+    for (const Distribution distribution : DISTRIBUTIONS) {
+        SCOPED_TRACE(distributionName(distribution));
+        DynamicArray<int> array = makeInput(100000, distribution);
+        const std::vector<int> expected = sortedReference(array);
+        algo::TimSort(array);
+        expectEqual(array, expected);
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TimSortIsStable) {
+    DynamicArray<KeyedValue> array;
+    for (int i = 0; i < 5000; ++i)
+        array.addLast(KeyedValue{(i * 7919) % 10, i});
+    // Descending block of distinct keys followed by equal keys
+    for (int i = 0; i < 300; ++i)
+        array.addLast(KeyedValue{300 - i, 5000 + i});
+    for (int i = 0; i < 300; ++i)
+        array.addLast(KeyedValue{5, 5300 + i});
+
+    algo::TimSort(array);
+    for (std::size_t i = 1; i < array.size(); ++i) {
+        const KeyedValue& prev = array.get(i - 1);
+        const KeyedValue& cur = array.get(i);
+        ASSERT_LE(prev.key, cur.key);
+        if (prev.key == cur.key) {
+            ASSERT_LT(prev.order, cur.order) << "at index " << i;
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TimSortIsLinearOnPresortedInputs) {
+    constexpr std::size_t size = 100000;
+
+    DynamicArray<CountingInt> sorted;
+    DynamicArray<CountingInt> reversed;
+    DynamicArray<CountingInt> appended;
+    for (std::size_t i = 0; i < size; ++i) {
+        sorted.addLast(CountingInt{static_cast<int>(i)});
+        reversed.addLast(CountingInt{static_cast<int>(size - i)});
+        appended.addLast(CountingInt{static_cast<int>(i)});
+    }
+    // A small unsorted batch appended to a long sorted series
+    for (int i = 0; i < 100; ++i)
+        appended.addLast(CountingInt{(i * 7919) % static_cast<int>(size)});
+
+    CountingInt::comparisons = 0;
+    algo::TimSort(sorted);
+    EXPECT_EQ(CountingInt::comparisons, size - 1);
+
+    CountingInt::comparisons = 0;
+    algo::TimSort(reversed);
+    EXPECT_EQ(CountingInt::comparisons, size - 1);
+    EXPECT_TRUE(algo::isSorted(reversed));
+
+    CountingInt::comparisons = 0;
+    algo::TimSort(appended);
+    EXPECT_LT(CountingInt::comparisons, 2 * size);
+    EXPECT_TRUE(algo::isSorted(appended));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TimSortSortsMoveOnlyTypes) {
+    DynamicArray<MoveOnlyKey> array;
+    for (int i = 0; i < 2000; ++i)
+        array.addLast(MoveOnlyKey((i * 37) % 1009));
+
+    algo::TimSort(array);
+    for (std::size_t i = 1; i < array.size(); ++i)
+        ASSERT_LE(*array.get(i - 1).key, *array.get(i).key);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest,
+       TimSortKeepsElementsWhenComparisonThrows) {
+    const DynamicArray<int> input = makeInput(2000, Distribution::RANDOM);
+    const std::vector<int> expected = sortedReference(input);
+
+    for (long budget = 500; budget < 18000; budget += 1500) {
+        SCOPED_TRACE("budget=" + std::to_string(budget));
+        DynamicArray<ThrowingLess> array;
+        for (const int value : input)
+            array.addLast(ThrowingLess{value});
+
+        ThrowingLess::budget = budget;
+        EXPECT_THROW(algo::TimSort(array), std::runtime_error);
+        ThrowingLess::budget = -1;
+
+        std::vector<int> remaining;
+        for (const ThrowingLess& element : array)
+            remaining.push_back(element.value);
+        std::sort(remaining.begin(), remaining.end());
+        EXPECT_EQ(remaining, expected);
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortUniverseSortsAllInputs) {
+    for (const std::size_t size : SIZES) {
+        for (const Distribution distribution : DISTRIBUTIONS) {
+            SCOPED_TRACE(std::string(distributionName(distribution)) +
+                         " n=" + std::to_string(size));
+            // Fold the keys into the dense universe [0, size)
+            DynamicArray<int> array = makeInput(size, distribution);
+            for (int& value : array)
+                value = static_cast<int>(static_cast<unsigned>(value) % size);
+
+            const std::vector<int> expected = sortedReference(array);
+            algo::BinSort(array, size);
+            expectEqual(array, expected);
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortRangeHandlesNegativeKeys) {
+    int data[] = {3, -2, 0, -5, 3, 1, -2};
+    DynamicArray array(data, 7);
+    algo::BinSort(array, -5, 3);
+    expectEqual(array, {-5, -2, -2, 0, 1, 3, 3});
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortThrowsOnValueOutsideUniverse) {
+    int data[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    DynamicArray array(data, 8);
+
+    EXPECT_THROW(algo::BinSort(array, 9), std::out_of_range);
+    EXPECT_THROW(algo::BinSort(array, 2, 9), std::out_of_range);
+    data[0] = -1;
+    DynamicArray negative(data, 8);
+    EXPECT_THROW(algo::BinSort(negative, 10), std::out_of_range);
+
+    // Validation happens before anything is written
+    expectEqual(array, {3, 1, 4, 1, 5, 9, 2, 6});
+    expectEqual(negative, {-1, 1, 4, 1, 5, 9, 2, 6});
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortHandlesExtremeRanges) {
+    DynamicArray<std::int8_t> array;
+    for (int i = 0; i < 1000; ++i)
+        array.addLast(static_cast<std::int8_t>((i * 37) % 256 - 128));
+    const std::vector<std::int8_t> before(array.begin(), array.end());
+
+    algo::BinSort(array, std::int8_t{-128}, std::int8_t{127});
+    std::vector<std::int8_t> expected = before;
+    std::sort(expected.begin(), expected.end());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(array.get(i), expected[i]) << "at index " << i;
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortByKeyIsStable) {
+    DynamicArray<KeyedValue> array;
+    for (int i = 0; i < 1000; ++i)
+        array.addLast(KeyedValue{(i * 7919) % 10, i});
+
+    algo::BinSort(array, 10, [](const KeyedValue& v) { return v.key; });
+    for (std::size_t i = 1; i < array.size(); ++i) {
+        const KeyedValue& prev = array.get(i - 1);
+        const KeyedValue& cur = array.get(i);
+        ASSERT_LE(prev.key, cur.key);
+        if (prev.key == cur.key) {
+            ASSERT_LT(prev.order, cur.order) << "at index " << i;
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortByKeyMovesRecords) {
+    DynamicArray<MoveOnlyKey> array;
+    for (int i = 0; i < 500; ++i)
+        array.addLast(MoveOnlyKey((i * 37) % 50));
+
+    algo::BinSort(array.span(), 50, [](const MoveOnlyKey& record) {
+        return *record.key;
+    });
+    for (std::size_t i = 1; i < array.size(); ++i)
+        ASSERT_LE(*array.get(i - 1).key, *array.get(i).key);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinSortByKeyThrowsOnKeyOutsideUniverse) {
+    DynamicArray<KeyedValue> array;
+    for (int i = 0; i < 10; ++i)
+        array.addLast(KeyedValue{9 - i, i});
+
+    EXPECT_THROW(
+        algo::BinSort(array, 9, [](const KeyedValue& v) { return v.key; }),
+        std::out_of_range);
+    for (std::size_t i = 0; i < array.size(); ++i)
+        EXPECT_EQ(array.get(i).order, static_cast<int>(i));
+
+    // A key extractor that fails half-way leaves every element in the range
+    int calls = 0;
+    EXPECT_THROW(algo::BinSort(array, 10,
+                               [&calls](const KeyedValue& v) {
+                                   if (++calls == 15)
+                                       throw std::runtime_error("key failed");
+                                   return v.key;
+                               }),
+                 std::runtime_error);
+    std::vector<int> orders;
+    for (const KeyedValue& v : array)
+        orders.push_back(v.order);
+    std::sort(orders.begin(), orders.end());
+    for (std::size_t i = 0; i < orders.size(); ++i)
+        EXPECT_EQ(orders[i], static_cast<int>(i));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortLSDSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::RadixSortLSD(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortMSDSortsAllInputs) {
+    expectSortsAllInputs([](DynamicArray<int>& a) { algo::RadixSortMSD(a); });
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortsHandleWideAndNarrowKeys) {
+    std::mt19937_64 engine(7);
+    DynamicArray<std::int64_t> wide;
+    DynamicArray<std::uint64_t> ids;
+    DynamicArray<std::int8_t> narrow;
+    for (int i = 0; i < 5000; ++i) {
+        wide.addLast(static_cast<std::int64_t>(engine()));
+        // Small IDs: the high digits are shared and get skipped
+        ids.addLast(engine() % 100000);
+        narrow.addLast(static_cast<std::int8_t>(engine()));
+    }
+    wide.addLast(std::numeric_limits<std::int64_t>::min());
+    wide.addLast(std::numeric_limits<std::int64_t>::max());
+
+    const auto expectRadixSorted = [](auto& array) {
+        std::vector expected(array.begin(), array.end());
+        std::sort(expected.begin(), expected.end());
+
+        auto lsd = array;
+        auto msd = array;
+        algo::RadixSortLSD(lsd);
+        algo::RadixSortMSD(msd);
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(lsd.get(i), expected[i]) << "LSD at index " << i;
+            ASSERT_EQ(msd.get(i), expected[i]) << "MSD at index " << i;
+        }
+    };
+
+    expectRadixSorted(wide);
+    expectRadixSorted(ids);
+    expectRadixSorted(narrow);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortsOrderFloatingPointKeys) {
+    std::mt19937 engine(11);
+    std::uniform_real_distribution<double> values(-1e6, 1e6);
+
+    DynamicArray<double> doubles;
+    DynamicArray<float> floats;
+    for (int i = 0; i < 3000; ++i) {
+        const double value = values(engine);
+        doubles.addLast(value);
+        floats.addLast(static_cast<float>(value / 1000));
+    }
+    for (const double special :
+         {0.0, -0.0, std::numeric_limits<double>::infinity(),
+          -std::numeric_limits<double>::infinity(),
+          std::numeric_limits<double>::denorm_min(),
+          -std::numeric_limits<double>::max()}) {
+        doubles.addLast(special);
+        floats.addLast(static_cast<float>(special));
+    }
+
+    const auto expectRadixSorted = [](auto& array) {
+        auto lsd = array;
+        auto msd = array;
+        algo::RadixSortLSD(lsd);
+        algo::RadixSortMSD(msd);
+        EXPECT_TRUE(algo::isSorted(lsd));
+        EXPECT_TRUE(algo::isSorted(msd));
+        using Value = std::decay_t<decltype(lsd.get(0))>;
+        EXPECT_EQ(lsd.get(0), -std::numeric_limits<Value>::infinity());
+    };
+
+    expectRadixSorted(doubles);
+    expectRadixSorted(floats);
+
+    // -0.0 is ordered before +0.0
+    DynamicArray<double> zeros;
+    for (int i = 0; i < 100; ++i)
+        zeros.addLast(i % 2 == 0 ? 0.0 : -0.0);
+    algo::RadixSortLSD(zeros);
+    EXPECT_TRUE(std::signbit(zeros.get(49)));
+    EXPECT_FALSE(std::signbit(zeros.get(50)));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortsOrderSmallFloatInputs) {
+    // Small inputs skip the radix passes but must end up in the same order
+    constexpr double NAN_VALUE = std::numeric_limits<double>::quiet_NaN();
+    const double values[] = {0.0,  NAN_VALUE, -0.0,
+                             1.5,  std::copysign(NAN_VALUE, -1.0),
+                             -2.0};
+
+    DynamicArray<double> lsd(values, 6);
+    DynamicArray<double> msd(values, 6);
+    algo::RadixSortLSD(lsd);
+    algo::RadixSortMSD(msd);
+    for (const DynamicArray<double>* sorted : {&lsd, &msd}) {
+        EXPECT_TRUE(std::isnan(sorted->get(0)));
+        EXPECT_TRUE(std::signbit(sorted->get(0)));
+        EXPECT_EQ(sorted->get(1), -2.0);
+        EXPECT_TRUE(std::signbit(sorted->get(2)));
+        EXPECT_EQ(sorted->get(2), 0.0);
+        EXPECT_FALSE(std::signbit(sorted->get(3)));
+        EXPECT_EQ(sorted->get(3), 0.0);
+        EXPECT_EQ(sorted->get(4), 1.5);
+        EXPECT_TRUE(std::isnan(sorted->get(5)));
+        EXPECT_FALSE(std::signbit(sorted->get(5)));
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, SortsWorkOnSpanSubranges) {
+    int data[] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    DynamicArray array(data, 10);
+
+    // Sort only the middle [2, 8) and leave the borders untouched
+    algo::QuickSort(array.span().subspan(2, 6));
+    expectEqual(array, {9, 8, 2, 3, 4, 5, 6, 7, 1, 0});
+
+    algo::MergeSort(array.span());
+    expectEqual(array, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, SortsStringsWithMoves) {
+    const std::string words[] = {"pear", "apple", "fig", "kiwi", "banana"};
+    DynamicArray<std::string> array(words, 5);
+    algo::QuickSort(array);
+    EXPECT_EQ(array.get(0), "apple");
+    EXPECT_EQ(array.get(4), "pear");
+
+    DynamicArray<std::string> other(words, 5);
+    algo::InsertionSortWithBinarySearch(other);
+    for (std::size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(other.get(i), array.get(i));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, IsSortedOnArrayAndSpan) {
+    int data[] = {1, 2, 2, 5};
+    DynamicArray array(data, 4);
+    EXPECT_TRUE(algo::isSorted(array));
+    EXPECT_TRUE(algo::isSorted(std::span<const int>(data)));
+    array.get(0) = 6;
+    EXPECT_FALSE(algo::isSorted(array));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, LinearSearchFindsFirstOccurrence) {
+    int data[] = {4, 1, 7, 1, 9};
+    const DynamicArray array(data, 5);
+    EXPECT_EQ(algo::LinearSearch(array, 1), 1u);
+    EXPECT_EQ(algo::LinearSearch(array, 9), 4u);
+    EXPECT_EQ(algo::LinearSearch(array, 3), 5u);
+    EXPECT_EQ(algo::LinearSearch(array.span(), 7), 2u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, LinearSearchOnLargeArrays) {
+    // Past the SIMD block size, with the match in the partial last block
+    DynamicArray<int> array = makeInput(1000, Distribution::SORTED);
+    EXPECT_EQ(algo::LinearSearch(array, 0), 0u);
+    EXPECT_EQ(algo::LinearSearch(array, 999), 999u);
+    EXPECT_EQ(algo::LinearSearch(array, -1), 1000u);
+    array.get(995) = 5;
+    EXPECT_EQ(algo::LinearSearch(array.span(), 5), 5u);
+
+    std::string words_data[] = {"b", "a", "b"};
+    const DynamicArray words(words_data, 3);
+    EXPECT_EQ(algo::LinearSearch(words, std::string("b")), 0u);
+    EXPECT_EQ(algo::LinearSearch(words, std::string("c")), 3u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, CountAndFindAllReportEveryMatch) {
+    const DynamicArray<int> array = makeInput(5000, Distribution::FEW_UNIQUE);
+    const int needle = array.get(4999);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < array.size(); ++i)
+        if (array.get(i) == needle)
+            expected.push_back(i);
+
+    EXPECT_EQ(algo::Count(array, needle), expected.size());
+    const DynamicArray<std::size_t> found = algo::FindAll(array, needle);
+    ASSERT_EQ(found.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(found.get(i), expected[i]);
+
+    EXPECT_EQ(algo::Count(array, -1), 0u);
+    EXPECT_TRUE(algo::FindAll(array.span(), -1).isEmpty());
+
+    std::string words_data[] = {"b", "a", "b"};
+    const DynamicArray words(words_data, 3);
+    EXPECT_EQ(algo::Count(words, std::string("b")), 2u);
+    EXPECT_EQ(algo::FindAll(words, std::string("b")).getLast(), 2u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MinMaxSum) {
+    const DynamicArray<int> array = makeInput(10000, Distribution::RANDOM);
+    const std::span<const int> values = array.span();
+
+    EXPECT_EQ(algo::Min(array), *std::min_element(values.begin(),
+                                                  values.end()));
+    EXPECT_EQ(algo::Max(array), *std::max_element(values.begin(),
+                                                  values.end()));
+    long long total = 0;
+    for (const int value : values)
+        total += value;
+    EXPECT_EQ(algo::Sum(array), static_cast<int>(total));
+
+    double reals_data[] = {2.5, -1.0, 4.0};
+    const DynamicArray reals(reals_data, 3);
+    EXPECT_EQ(algo::Min(reals), -1.0);
+    EXPECT_EQ(algo::Max(reals), 4.0);
+    EXPECT_EQ(algo::Sum(reals), 5.5);
+
+    std::string words_data[] = {"b", "a", "c"};
+    const DynamicArray words(words_data, 3);
+    EXPECT_EQ(algo::Min(words), "a");
+    EXPECT_EQ(algo::Max(words), "c");
+    EXPECT_EQ(algo::Sum(words), "bac");
+
+    const DynamicArray<int> empty;
+    EXPECT_THROW(algo::Min(empty), std::invalid_argument);
+    EXPECT_THROW(algo::Max(empty.span()), std::invalid_argument);
+    EXPECT_EQ(algo::Sum(empty), 0);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, LowerBoundMatchesStdLowerBound) {
+    for (std::size_t size = 0; size <= 130; ++size) {
+        DynamicArray<int> array = makeInput(size, Distribution::FEW_UNIQUE);
+        algo::QuickSort(array);
+        for (int value = -1; value <= static_cast<int>(size) + 1; ++value) {
+            const auto expected = static_cast<std::size_t>(
+                std::lower_bound(array.begin(), array.end(), value) -
+                array.begin());
+            ASSERT_EQ(algo::LowerBound(array, value), expected)
+                << "n=" << size << " value=" << value;
+        }
+    }
+
+    std::string words[] = {"ant", "bee", "cat"};
+    EXPECT_EQ(algo::LowerBound(std::span<std::string>(words), "bat"), 1u);
+    EXPECT_EQ(algo::LowerBound(std::span<std::string>(words), "dog"), 3u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinarySearchReturnsLowerBoundMatch) {
+    int data[] = {1, 3, 3, 3, 8, 10};
+    const DynamicArray array(data, 6);
+    EXPECT_EQ(algo::BinarySearch(array, 3), 1u);
+    EXPECT_EQ(algo::BinarySearch(array, 1), 0u);
+    EXPECT_EQ(algo::BinarySearch(array, 10), 5u);
+    EXPECT_EQ(algo::BinarySearch(array, 4), 6u);
+    EXPECT_EQ(algo::BinarySearch(array, 0), 6u);
+    EXPECT_EQ(algo::BinarySearch(array.span(), 8), 4u);
+
+    const DynamicArray<int> empty;
+    EXPECT_EQ(algo::BinarySearch(empty, 1), 0u);
+}
@@ -1,10 +1,15 @@
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 
+#include "CountingAllocator.hpp"
 #include "DynamicArray.hpp"
 #include "Record.hpp"
 #include "ThrowingType.hpp"
@@ -526,6 +531,24 @@ TEST_F(DynamicArrayUnitTest, GetInvalidIndex) {
 }
 
 
+TEST_F(DynamicArrayUnitTest, ContainsReturnsFirstIndexOrSize) {
+    DynamicArray<std::int16_t> arr;
+    for (int i = 0; i < 300; ++i)
+        arr.addLast(static_cast<std::int16_t>(i % 100));
+    EXPECT_EQ(arr.contains(42), 42u);
+    EXPECT_EQ(arr.contains(99), 99u);
+    EXPECT_EQ(arr.contains(100), 300u);
+    arr.get(299) = 100;
+    EXPECT_EQ(arr.contains(100), 299u);
+
+    DynamicArray<std::string> words;
+    words.addLast("a");
+    words.addLast("b");
+    EXPECT_EQ(words.contains("b"), 1u);
+    EXPECT_EQ(words.contains("c"), 2u);
+}
+
+
 TEST_F(DynamicArrayUnitTest, OperatorBracket) {
     int data[] = {10, 20, 30};
     DynamicArray arr(data, 3);
@@ -555,6 +578,46 @@ TEST_F(DynamicArrayUnitTest, BracketOperatorThrowsOutOfRange) {
 }
 
 
+TEST_F(DynamicArrayUnitTest, GetUncheckedReadsAndWrites) {
+    int data[] = {10, 20, 30};
+    DynamicArray arr(data, 3);
+    EXPECT_EQ(arr.getUnchecked(0), 10);
+    EXPECT_EQ(arr.getUnchecked(2), 30);
+    arr.getUnchecked(1) = 99;
+    EXPECT_EQ(arr.get(1), 99);
+
+    const DynamicArray carr(arr);
+    EXPECT_EQ(carr.getUnchecked(1), 99);
+}
+
+
+TEST_F(DynamicArrayUnitTest, DataAndSpanViewLiveElements) {
+    int data[] = {1, 2, 3, 4};
+    DynamicArray arr(data, 4);
+
+    EXPECT_EQ(arr.data(), arr.begin());
+    const std::span<int> view = arr.span();
+    ASSERT_EQ(view.size(), 4u);
+    EXPECT_EQ(view.data(), arr.data());
+    view[3] = 40;
+    EXPECT_EQ(arr.get(3), 40);
+
+    const DynamicArray carr(arr);
+    const std::span<const int> cview = carr.span();
+    ASSERT_EQ(cview.size(), 4u);
+    EXPECT_EQ(cview[3], 40);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SpanOfMovedFromIsEmpty) {
+    DynamicArray<int> a;
+    a.addLast(1);
+    DynamicArray<int> b(std::move(a));
+    EXPECT_TRUE(a.span().empty());
+    EXPECT_EQ(b.span().size(), 1u);
+}
+
+
 TEST_F(DynamicArrayUnitTest, GetFirst) {
     int data[] = {10, 20, 30};
     DynamicArray arr(data, 3);
@@ -1185,3 +1248,429 @@ TEST_F(DynamicArrayUnitTest, RemoveAllWithMoveOnly) {
     EXPECT_EQ(a.size(), 0u);
     EXPECT_GE(a.capacity(), 5u);
 }
+
+
+/// Owns a heap int and counts live instances. Relocating it bytewise is
+/// sound (it never points into itself), so it opts in to the trait.
+struct RelocatableHandle {
+    static inline int alive = 0;
+    int* value;
+
+    explicit RelocatableHandle(const int v) : value(new int(v)) { ++alive; }
+
+    RelocatableHandle(const RelocatableHandle& other)
+        : value(new int(*other.value)) {
+        ++alive;
+    }
+
+    RelocatableHandle& operator=(const RelocatableHandle& other) {
+        *value = *other.value;
+        return *this;
+    }
+
+    ~RelocatableHandle() {
+        delete value;
+        --alive;
+    }
+};
+
+namespace data_structs {
+template <>
+struct IsTriviallyRelocatable<RelocatableHandle> : std::true_type {};
+} // namespace data_structs
+
+
+TEST_F(DynamicArrayUnitTest, TriviallyRelocatableTraitDefaults) {
+    EXPECT_TRUE(data_structs::IS_TRIVIALLY_RELOCATABLE<int>);
+    EXPECT_TRUE(data_structs::IS_TRIVIALLY_RELOCATABLE<Point>);
+    EXPECT_FALSE(data_structs::IS_TRIVIALLY_RELOCATABLE<std::string>);
+    EXPECT_FALSE(data_structs::IS_TRIVIALLY_RELOCATABLE<ThrowingType>);
+    EXPECT_TRUE(data_structs::IS_TRIVIALLY_RELOCATABLE<RelocatableHandle>);
+}
+
+
+TEST_F(DynamicArrayUnitTest, RelocatableTypeGrowsInsertsAndRemoves) {
+    {
+        DynamicArray<RelocatableHandle> arr;
+        for (int i = 0; i < 100; ++i)
+            arr.emplaceLast(i);
+        arr.emplaceAt(50, -1);
+        arr.emplaceAt(0, -2);
+        arr.removeAt(10);
+        arr.shrinkToFit();
+
+        ASSERT_EQ(arr.size(), 101u);
+        EXPECT_EQ(RelocatableHandle::alive, 101);
+        EXPECT_EQ(*arr.get(0).value, -2);
+        EXPECT_EQ(*arr.get(9).value, 8);
+        EXPECT_EQ(*arr.get(10).value, 10);
+        EXPECT_EQ(*arr.get(50).value, -1);
+        EXPECT_EQ(*arr.get(100).value, 99);
+
+        const DynamicArray<RelocatableHandle> copy(arr);
+        EXPECT_EQ(RelocatableHandle::alive, 202);
+    }
+    EXPECT_EQ(RelocatableHandle::alive, 0);
+}
+
+
+TEST_F(DynamicArrayUnitTest, RelocatableInsertOfOwnElement) {
+    DynamicArray<int> arr;
+    arr.reserve(10);
+    for (int i = 0; i < 5; ++i)
+        arr.addLast(i);
+
+    // The argument lives in the suffix that is shifted right
+    arr.insert(arr.get(4), 1);
+    arr.insert(arr.get(0), 3);
+    const int expected[] = {0, 4, 1, 0, 2, 3, 4};
+    ASSERT_EQ(arr.size(), 7u);
+    for (std::size_t i = 0; i < 7; ++i)
+        EXPECT_EQ(arr.get(i), expected[i]);
+}
+
+
+TEST_F(DynamicArrayUnitTest, MiddleInsertShiftsInPlaceWithSpareCapacity) {
+    DynamicArray<std::string> arr;
+    arr.reserve(10);
+    arr.addLast("b");
+    arr.addLast("d");
+    const std::string* storage = arr.data();
+
+    arr.addFirst("a");
+    arr.emplaceAt(2, "c");
+    arr.insert(std::string("e"), 4);
+
+    EXPECT_EQ(arr.data(), storage);
+    ASSERT_EQ(arr.size(), 5u);
+    for (std::size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(arr.get(i), std::string(1, static_cast<char>('a' + i)));
+}
+
+
+TEST_F(DynamicArrayUnitTest, MiddleInsertThrowLeavesArrayUnchanged) {
+    DynamicArray<ThrowingType> arr;
+    arr.emplaceLast(1);
+    arr.emplaceLast(2);
+    ThrowingType::should_throw = true;
+
+    EXPECT_THROW(arr.emplaceAt(1, 9), std::runtime_error);
+    ASSERT_EQ(arr.size(), 2u);
+    EXPECT_EQ(arr.get(0).value, 1);
+    EXPECT_EQ(arr.get(1).value, 2);
+}
+
+
+TEST_F(DynamicArrayUnitTest, InsertRangeAtFrontMiddleAndEnd) {
+    const int batch[] = {-1, -2, -3};
+
+    DynamicArray<int> ints;
+    DynamicArray<std::string> strings;
+    for (int i = 0; i < 4; ++i) {
+        ints.addLast(i);
+        strings.addLast(std::to_string(i));
+    }
+
+    ints.insertRange(2, std::begin(batch), std::end(batch));
+    ints.insertRange(0, std::begin(batch), std::begin(batch) + 1);
+    ints.insertRange(ints.size(), std::begin(batch), std::end(batch));
+    ints.insertRange(1, std::begin(batch), std::begin(batch));
+
+    const int expected[] = {-1, 0, 1, -1, -2, -3, 2, 3, -1, -2, -3};
+    ASSERT_EQ(ints.size(), 11u);
+    for (std::size_t i = 0; i < 11; ++i)
+        EXPECT_EQ(ints.get(i), expected[i]);
+
+    const std::string words[] = {"x", "y"};
+    strings.insertRange(1, std::begin(words), std::end(words));
+    const std::string expected_strings[] = {"0", "x", "y", "1", "2", "3"};
+    ASSERT_EQ(strings.size(), 6u);
+    for (std::size_t i = 0; i < 6; ++i)
+        EXPECT_EQ(strings.get(i), expected_strings[i]);
+
+    EXPECT_THROW(ints.insertRange(12, std::begin(batch), std::end(batch)),
+                 std::out_of_range);
+}
+
+
+TEST_F(DynamicArrayUnitTest, InsertRangeOfRelocatableAndThrowingTypes) {
+    {
+        DynamicArray<RelocatableHandle> handles;
+        for (int i = 0; i < 3; ++i)
+            handles.emplaceLast(i);
+        DynamicArray<RelocatableHandle> batch;
+        for (int i = 10; i < 20; ++i)
+            batch.emplaceLast(i);
+
+        handles.insertRange(1, batch.begin(), batch.end());
+        ASSERT_EQ(handles.size(), 13u);
+        EXPECT_EQ(*handles.get(0).value, 0);
+        EXPECT_EQ(*handles.get(1).value, 10);
+        EXPECT_EQ(*handles.get(10).value, 19);
+        EXPECT_EQ(*handles.get(11).value, 1);
+        EXPECT_EQ(RelocatableHandle::alive, 23);
+    }
+    EXPECT_EQ(RelocatableHandle::alive, 0);
+
+    DynamicArray<ThrowingType> arr;
+    arr.emplaceLast(1);
+    arr.emplaceLast(2);
+    const ThrowingType batch[] = {ThrowingType(7), ThrowingType(8)};
+    arr.insertRange(1, std::begin(batch), std::end(batch));
+    ASSERT_EQ(arr.size(), 4u);
+    EXPECT_EQ(arr.get(1).value, 7);
+    EXPECT_EQ(arr.get(3).value, 2);
+
+    ThrowingType::should_throw = true;
+    EXPECT_THROW(arr.insertRange(2, std::begin(batch), std::end(batch)),
+                 std::runtime_error);
+    ASSERT_EQ(arr.size(), 4u);
+    EXPECT_EQ(arr.get(2).value, 8);
+}
+
+
+/// Copyable but not assignable, so erasing relocates by construct+destroy.
+struct Unassignable {
+    const int value;
+    explicit Unassignable(const int v) : value(v) {}
+    Unassignable& operator=(const Unassignable&) = delete;
+};
+
+
+TEST_F(DynamicArrayUnitTest, EraseRangeShiftsOnceForEveryKindOfType) {
+    DynamicArray<int> ints;
+    DynamicArray<std::string> strings;
+    DynamicArray<Unassignable> unassignables;
+    for (int i = 0; i < 10; ++i) {
+        ints.addLast(i);
+        strings.addLast(std::to_string(i));
+        unassignables.emplaceLast(i);
+    }
+
+    ints.eraseRange(2, 5);
+    strings.eraseRange(2, 5);
+    unassignables.eraseRange(2, 5);
+    ints.eraseRange(3, 3);
+
+    const int expected[] = {0, 1, 5, 6, 7, 8, 9};
+    ASSERT_EQ(ints.size(), 7u);
+    ASSERT_EQ(strings.size(), 7u);
+    ASSERT_EQ(unassignables.size(), 7u);
+    for (std::size_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(ints.get(i), expected[i]);
+        EXPECT_EQ(strings.get(i), std::to_string(expected[i]));
+        EXPECT_EQ(unassignables.get(i).value, expected[i]);
+    }
+
+    ints.eraseRange(5, 7);
+    EXPECT_EQ(ints.getLast(), 7);
+    ints.eraseRange(0, ints.size());
+    EXPECT_TRUE(ints.isEmpty());
+
+    EXPECT_THROW(strings.eraseRange(3, 2), std::out_of_range);
+    EXPECT_THROW(strings.eraseRange(0, 8), std::out_of_range);
+}
+
+
+TEST_F(DynamicArrayUnitTest, StorageComesFromTheAllocator) {
+    AllocationStats stats;
+    {
+        using Array = DynamicArray<std::string, CountingAllocator<std::string>>;
+        Array arr{CountingAllocator<std::string>(stats)};
+        for (int i = 0; i < 100; ++i)
+            arr.addLast(std::to_string(i));
+        EXPECT_GT(stats.allocations, 1u);
+        EXPECT_EQ(stats.bytes_in_use, arr.capacity() * sizeof(std::string));
+
+        const Array copy(arr);
+        EXPECT_EQ(copy.getAllocator(), arr.getAllocator());
+        EXPECT_EQ(copy.get(99), "99");
+    }
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, MoveAssignBetweenUnequalAllocatorsMovesElements) {
+    AllocationStats first_stats;
+    AllocationStats second_stats;
+    {
+        using Array = DynamicArray<int, CountingAllocator<int>>;
+        Array first{CountingAllocator<int>(first_stats)};
+        Array second{CountingAllocator<int>(second_stats)};
+        for (int i = 0; i < 20; ++i)
+            second.addLast(i);
+
+        first = std::move(second);
+        EXPECT_EQ(first.getAllocator(), CountingAllocator<int>(first_stats));
+        ASSERT_EQ(first.size(), 20u);
+        EXPECT_EQ(first.get(19), 19);
+        EXPECT_TRUE(second.isEmpty());
+        EXPECT_GE(first_stats.bytes_in_use, 20 * sizeof(int));
+    }
+    EXPECT_EQ(first_stats.bytes_in_use, 0u);
+    EXPECT_EQ(second_stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, PmrArrayUsesTheMemoryResource) {
+    unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+
+    data_structs::pmr::DynamicArray<double> arr{&arena};
+    for (int i = 0; i < 100; ++i)
+        arr.addLast(i * 0.5);
+    EXPECT_EQ(arr.getAllocator().resource(), &arena);
+    EXPECT_GE(static_cast<const void*>(arr.data()),
+              static_cast<const void*>(buffer));
+    EXPECT_LT(static_cast<const void*>(arr.data()),
+              static_cast<const void*>(buffer + sizeof(buffer)));
+    EXPECT_EQ(arr.getLast(), 49.5);
+
+    // The arena is exhausted long before this
+    EXPECT_THROW(arr.reserve(10000), std::bad_alloc);
+    EXPECT_EQ(arr.size(), 100u);
+}
+
+
+/// Lazy first allocation, 1.5x growth, never shrinks.
+struct LazyNoShrinkPolicy : data_structs::DefaultGrowthPolicy {
+    static constexpr std::size_t INITIAL_CAPACITY = 0;
+    static constexpr std::size_t MIN_CAPACITY = 4;
+    static constexpr std::size_t GROWTH_NUMERATOR = 3;
+    static constexpr std::size_t GROWTH_DENOMINATOR = 2;
+    static constexpr bool SHRINKS = false;
+};
+
+
+TEST_F(DynamicArrayUnitTest, LazyPolicyAllocatesOnFirstInsert) {
+    AllocationStats stats;
+    {
+        using Array =
+            DynamicArray<int, CountingAllocator<int>, LazyNoShrinkPolicy>;
+        Array arr{CountingAllocator<int>(stats)};
+        EXPECT_EQ(arr.capacity(), 0u);
+        EXPECT_EQ(arr.begin(), arr.end());
+        EXPECT_FALSE(arr.contains(1));
+        EXPECT_EQ(stats.allocations, 0u);
+
+        arr.addLast(1);
+        EXPECT_EQ(arr.capacity(), 4u);
+        EXPECT_EQ(stats.allocations, 1u);
+
+        arr.clear();
+        EXPECT_EQ(arr.capacity(), 0u);
+        EXPECT_EQ(stats.bytes_in_use, 0u);
+
+        const Array empty(nullptr, 0, CountingAllocator<int>(stats));
+        EXPECT_EQ(empty.capacity(), 0u);
+        EXPECT_EQ(stats.allocations, 1u);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, PolicyGrowthFactor) {
+    DynamicArray<int, std::allocator<int>, LazyNoShrinkPolicy> arr;
+    std::vector<std::size_t> capacities;
+    for (int i = 0; i < 30; ++i) {
+        arr.addLast(i);
+        if (capacities.empty() || capacities.back() != arr.capacity())
+            capacities.push_back(arr.capacity());
+    }
+    EXPECT_EQ(capacities, (std::vector<std::size_t>{4, 6, 9, 13, 19, 28, 42}));
+
+    // Bulk inserts grow by one step at least
+    const std::vector<int> more(20, 7);
+    arr.insertRange(0, more.begin(), more.end());
+    EXPECT_EQ(arr.capacity(), 63u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, NonShrinkingPolicyKeepsCapacity) {
+    DynamicArray<int, std::allocator<int>, LazyNoShrinkPolicy> arr;
+    for (int i = 0; i < 1000; ++i)
+        arr.addLast(i);
+    const std::size_t capacity = arr.capacity();
+
+    while (!arr.isEmpty())
+        arr.removeLast();
+    EXPECT_EQ(arr.capacity(), capacity);
+
+    arr.shrinkToFit();
+    EXPECT_EQ(arr.capacity(), 4u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, DefaultPolicyShrinkHasHysteresis) {
+    AllocationStats stats;
+    DynamicArray<int, CountingAllocator<int>> arr{
+        CountingAllocator<int>(stats)};
+    for (int i = 0; i < 80; ++i)
+        arr.addLast(i);
+    ASSERT_EQ(arr.capacity(), 80u);
+
+    // Shrinks to 40 at size 20, then push/pop around that size is free
+    while (arr.size() > 20)
+        arr.removeLast();
+    EXPECT_EQ(arr.capacity(), 40u);
+    const std::size_t allocations = stats.allocations;
+    for (int i = 0; i < 100; ++i) {
+        arr.addLast(i);
+        arr.removeLast();
+        arr.removeLast();
+        arr.addLast(i);
+    }
+    EXPECT_EQ(stats.allocations, allocations);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SizeClassPolicyRoundsAllocations) {
+    using data_structs::SizeClassGrowthPolicy;
+    using Array = DynamicArray<int, std::allocator<int>, SizeClassGrowthPolicy>;
+
+    // 5 ints (20 bytes) round up to a 32-byte size class
+    Array arr;
+    EXPECT_EQ(arr.capacity(), 8u);
+    for (int i = 0; i < 9; ++i)
+        arr.addLast(i);
+    EXPECT_EQ(arr.capacity(), 16u);
+
+    // Whole pages, then whole huge pages
+    arr.reserve(5000);
+    EXPECT_EQ(arr.capacity() * sizeof(int), 5u * 4096);
+    arr.reserve(600'000);
+    EXPECT_EQ(arr.capacity() * sizeof(int), std::size_t{2} << 21);
+    EXPECT_EQ(arr.get(8), 8);
+
+    // Odd element sizes never get less than they asked for
+    struct Triple {
+        char bytes[3];
+    };
+    DynamicArray<Triple, std::allocator<Triple>, SizeClassGrowthPolicy> triples;
+    triples.reserve(1000);
+    EXPECT_GE(triples.capacity(), 1000u);
+    EXPECT_LE(triples.capacity() * sizeof(Triple), 4096u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SizeClassPolicyRoundsRangeInserts) {
+    // ThrowingType may throw on move, so a middle insert rebuilds the array
+    DynamicArray<ThrowingType, std::allocator<ThrowingType>,
+                 data_structs::SizeClassGrowthPolicy>
+        arr;
+    arr.emplaceLast(1);
+    arr.emplaceLast(2);
+    DynamicArray<ThrowingType> batch;
+    for (int i = 0; i < 20; ++i)
+        batch.emplaceLast(7);
+
+    // 22 elements (88 bytes) round up to a 128-byte size class
+    arr.insertRange(1, batch.begin(), batch.end());
+    ASSERT_EQ(arr.size(), 22u);
+    EXPECT_EQ(arr.capacity(), 32u);
+    EXPECT_EQ(arr.get(0).value, 1);
+    EXPECT_EQ(arr.get(20).value, 7);
+    EXPECT_EQ(arr.get(21).value, 2);
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "DynamicArrayAlgorithms.hpp"
+#include "ExternalSort.hpp"
+
+
+using algo::ExternalSort;
+using algo::ExternalSortOptions;
+
+
+/// A trivially copyable record ordered by its key only.
+struct KeyedEntry {
+    std::int32_t key;
+    std::int32_t sequence;
+
+    bool operator<(const KeyedEntry& other) const { return key < other.key; }
+};
+
+
+class ExternalSortUnitTest : public testing::Test {
+  protected:
+    std::filesystem::path directory;
+    std::filesystem::path input;
+    std::filesystem::path output;
+
+    void SetUp() override {
+        const std::string name =
+            testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory = std::filesystem::temp_directory_path() /
+                    ("external_sort_" + name);
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directory(directory);
+        input = directory / "input.bin";
+        output = directory / "output.bin";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    template <typename Type>
+    void write(const std::filesystem::path& path,
+               const std::vector<Type>& values) {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(values.data()),
+                   static_cast<std::streamsize>(values.size() * sizeof(Type)));
+    }
+
+    template <typename Type>
+    std::vector<Type> read(const std::filesystem::path& path) {
+        std::vector<Type> values(std::filesystem::file_size(path) /
+                                 sizeof(Type));
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(values.data()),
+                  static_cast<std::streamsize>(values.size() * sizeof(Type)));
+        return values;
+    }
+
+    /// Only the input and output are left in the directory.
+    void expectNoRunFiles() {
+        for (const auto& entry :
+             std::filesystem::directory_iterator(directory))
+            EXPECT_TRUE(entry.path() == input || entry.path() == output)
+                << entry.path();
+    }
+};
+
+
+TEST_F(ExternalSortUnitTest, SortsWithinASingleChunk) {
+    write<int>(input, {5, 3, 9, 1, 7, 3});
+
+    ExternalSort<int>(input, output, {.temp_directory = directory});
+
+    EXPECT_EQ(read<int>(output), (std::vector<int>{1, 3, 3, 5, 7, 9}));
+    expectNoRunFiles();
+}
+
+
+TEST_F(ExternalSortUnitTest, MergesManyRunsInSeveralPasses) {
+    std::vector<std::int64_t> values(100'003);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<std::int64_t>((i * 7919) % 65'521) - 30'000;
+    write(input, values);
+
+    // 300 elements per chunk gives 334 runs, merged 4 at a time
+    const ExternalSortOptions options{.memory_budget = 900 * 8,
+                                      .temp_directory = directory,
+                                      .max_fan_in = 4};
+    ExternalSort<std::int64_t>(input, output, options);
+
+    std::ranges::sort(values);
+    EXPECT_EQ(read<std::int64_t>(output), values);
+    expectNoRunFiles();
+}
+
+
+TEST_F(ExternalSortUnitTest, StableWithAStableChunkSort) {
+    std::vector<KeyedEntry> values;
+    for (std::int32_t i = 0; i < 5000; ++i)
+        values.push_back(KeyedEntry{(i * 31) % 17, i});
+    write(input, values);
+
+    const ExternalSortOptions options{.memory_budget = 64 * sizeof(KeyedEntry),
+                                      .temp_directory = directory,
+                                      .max_fan_in = 3};
+    ExternalSort<KeyedEntry>(
+        input, output, options,
+        [](const std::span<KeyedEntry> chunk) { algo::MergeSort(chunk); });
+
+    std::ranges::stable_sort(values, {}, &KeyedEntry::key);
+    const std::vector<KeyedEntry> sorted = read<KeyedEntry>(output);
+    ASSERT_EQ(sorted.size(), values.size());
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        EXPECT_EQ(sorted[i].key, values[i].key);
+        EXPECT_EQ(sorted[i].sequence, values[i].sequence);
+    }
+}
+
+
+TEST_F(ExternalSortUnitTest, SortsAFileInPlace) {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i)
+        values.push_back(1000.0 / (i + 1) - 3.5);
+    write(input, values);
+
+    ExternalSort<double>(input, input,
+                         {.memory_budget = 240 * sizeof(double),
+                          .temp_directory = directory});
+
+    std::ranges::sort(values);
+    EXPECT_EQ(read<double>(input), values);
+}
+
+
+TEST_F(ExternalSortUnitTest, EmptyAndChunkSizedInputs) {
+    write<int>(input, {});
+    ExternalSort<int>(input, output, {.temp_directory = directory});
+    EXPECT_TRUE(std::filesystem::exists(output));
+    EXPECT_EQ(std::filesystem::file_size(output), 0u);
+
+    // Exactly two full chunks of 10 elements
+    std::vector<int> values(20);
+    for (int i = 0; i < 20; ++i)
+        values[i] = 20 - i;
+    write(input, values);
+    ExternalSort<int>(input, output,
+                      {.memory_budget = 30 * sizeof(int),
+                       .temp_directory = directory});
+
+    std::ranges::sort(values);
+    EXPECT_EQ(read<int>(output), values);
+    expectNoRunFiles();
+}
+
+
+TEST_F(ExternalSortUnitTest, RejectsBadInputs) {
+    EXPECT_THROW(ExternalSort<int>(directory / "missing.bin", output,
+                                   {.temp_directory = directory}),
+                 std::filesystem::filesystem_error);
+
+    write<char>(input, {'a', 'b', 'c', 'd', 'e'});
+    EXPECT_THROW(
+        ExternalSort<int>(input, output, {.temp_directory = directory}),
+        std::invalid_argument);
+
+    // A failing chunk sort removes the runs already written
+    std::vector<int> values(100, 1);
+    write(input, values);
+    int calls = 0;
+    EXPECT_THROW(ExternalSort<int>(input, output,
+                                   {.memory_budget = 30 * sizeof(int),
+                                    .temp_directory = directory},
+                                   [&calls](std::span<int>) {
+                                       if (++calls == 3)
+                                           throw std::runtime_error("sort");
+                                   }),
+                 std::runtime_error);
+    expectNoRunFiles();
+}
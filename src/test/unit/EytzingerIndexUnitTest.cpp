@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "EytzingerIndex.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::EytzingerIndex;
+
+
+/// Ordered int whose copy constructor throws once its budget runs out, and
+/// which counts live instances.
+struct LimitedCopy {
+    static inline int copies_left = 0;
+    static inline int alive = 0;
+    int value;
+
+    explicit LimitedCopy(const int v) : value(v) { ++alive; }
+
+    LimitedCopy(const LimitedCopy& other) : value(other.value) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy budget exhausted");
+        ++alive;
+    }
+
+    ~LimitedCopy() { --alive; }
+
+    bool operator<(const LimitedCopy& other) const {
+        return value < other.value;
+    }
+};
+
+
+class EytzingerIndexUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+
+    /// Sorted even numbers with runs of duplicates.
+    static DynamicArray<int> makeSorted(const std::size_t size) {
+        DynamicArray<int> sorted;
+        sorted.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+            sorted.addLast(static_cast<int>(i - i % 3 + i / 3 % 2) * 2);
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+};
+
+
+TEST_F(EytzingerIndexUnitTest, DefaultConstructedIsEmpty) {
+    const EytzingerIndex<int> index;
+    EXPECT_TRUE(index.isEmpty());
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.lowerBound(5), 0u);
+    EXPECT_EQ(index.find(5), 0u);
+    EXPECT_FALSE(index.contains(5));
+}
+
+
+TEST_F(EytzingerIndexUnitTest, LowerBoundMatchesStdLowerBoundForEverySize) {
+    // Perfect trees (2^h - 1), one more and one less, and larger sizes
+    for (std::size_t size = 0; size <= 300; ++size) {
+        const DynamicArray<int> sorted = makeSorted(size);
+        const EytzingerIndex<int> index(sorted);
+        ASSERT_EQ(index.size(), size);
+
+        const int largest = size == 0 ? 0 : sorted.getLast();
+        for (int value = -1; value <= largest + 1; ++value) {
+            const auto expected = static_cast<std::size_t>(
+                std::lower_bound(sorted.begin(), sorted.end(), value) -
+                sorted.begin());
+            ASSERT_EQ(index.lowerBound(value), expected)
+                << "n=" << size << " value=" << value;
+        }
+    }
+}
+
+
+TEST_F(EytzingerIndexUnitTest, FindReturnsFirstOccurrenceOrSize) {
+    int data[] = {1, 3, 3, 3, 8, 10};
+    const DynamicArray array(data, 6);
+    const EytzingerIndex<int> index(array);
+
+    EXPECT_EQ(index.find(3), 1u);
+    EXPECT_EQ(index.find(1), 0u);
+    EXPECT_EQ(index.find(10), 5u);
+    EXPECT_EQ(index.find(4), 6u);
+    EXPECT_EQ(index.find(0), 6u);
+    EXPECT_EQ(index.find(11), 6u);
+    EXPECT_TRUE(index.contains(8));
+    EXPECT_FALSE(index.contains(9));
+}
+
+
+TEST_F(EytzingerIndexUnitTest, WorksWithNonTrivialTypes) {
+    std::string data[] = {"apple", "banana", "cherry", "date", "fig"};
+    const EytzingerIndex<std::string> index{std::span<const std::string>(data)};
+
+    EXPECT_EQ(index.find("cherry"), 2u);
+    EXPECT_EQ(index.lowerBound("coconut"), 3u);
+    EXPECT_EQ(index.lowerBound("zebra"), 5u);
+    EXPECT_FALSE(index.contains("grape"));
+}
+
+
+TEST_F(EytzingerIndexUnitTest, UnsortedInputThrows) {
+    int data[] = {1, 3, 2};
+    EXPECT_THROW(EytzingerIndex<int>(std::span<const int>(data)),
+                 std::invalid_argument);
+}
+
+
+TEST_F(EytzingerIndexUnitTest, CopyAndMove) {
+    const DynamicArray<int> sorted = makeSorted(100);
+    EytzingerIndex<int> original(sorted);
+
+    EytzingerIndex<int> copy(original);
+    EXPECT_EQ(copy.size(), 100u);
+    EXPECT_EQ(copy.find(sorted.get(50)), original.find(sorted.get(50)));
+
+    EytzingerIndex<int> moved(std::move(original));
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_TRUE(original.isEmpty());
+    EXPECT_FALSE(original.contains(sorted.get(0)));
+    EXPECT_TRUE(moved.contains(sorted.get(0)));
+
+    EytzingerIndex<int> assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.lowerBound(sorted.get(99)),
+              copy.lowerBound(sorted.get(99)));
+    assigned = EytzingerIndex<int>();
+    EXPECT_TRUE(assigned.isEmpty());
+}
+
+
+TEST_F(EytzingerIndexUnitTest, CopyThrowDuringBuildReleasesEverything) {
+    {
+        DynamicArray<LimitedCopy> sorted;
+        sorted.reserve(20);
+        for (int i = 0; i < 20; ++i)
+            sorted.emplaceLast(i);
+
+        LimitedCopy::copies_left = 10;
+        EXPECT_THROW(EytzingerIndex<LimitedCopy> index(sorted),
+                     std::runtime_error);
+        EXPECT_EQ(LimitedCopy::alive, 20);
+
+        LimitedCopy::copies_left = 20;
+        const EytzingerIndex<LimitedCopy> index(sorted);
+        EXPECT_EQ(LimitedCopy::alive, 40);
+        EXPECT_EQ(index.find(LimitedCopy(7)), 7u);
+    }
+    EXPECT_EQ(LimitedCopy::alive, 0);
+}
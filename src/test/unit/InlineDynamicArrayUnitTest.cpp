@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "CountingAllocator.hpp"
+#include "DynamicArrayAlgorithms.hpp"
+#include "InlineDynamicArray.hpp"
+
+
+using data_structs::DynamicArray;
+using data_structs::InlineDynamicArray;
+
+
+/// String wrapper whose copy constructor throws on demand; moves never do.
+struct CopyThrows {
+    static inline bool should_throw = false;
+    std::string value;
+
+    explicit CopyThrows(std::string v) : value(std::move(v)) {}
+
+    CopyThrows(const CopyThrows& other) : value(other.value) {
+        if (should_throw)
+            throw std::runtime_error("copy failed");
+    }
+
+    CopyThrows(CopyThrows&&) noexcept = default;
+    CopyThrows& operator=(const CopyThrows&) = default;
+    CopyThrows& operator=(CopyThrows&&) noexcept = default;
+};
+
+
+class InlineDynamicArrayUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override { CopyThrows::should_throw = false; }
+
+    using Array = InlineDynamicArray<int, 16, CountingAllocator<int>>;
+
+    AllocationStats stats;
+
+    Array makeArray() { return Array(CountingAllocator<int>(stats)); }
+
+    /// Strings long enough to live on the heap themselves, so that a
+    /// bytewise move of them would be caught by the sanitizers.
+    static std::string text(const int i) {
+        return "element number " + std::to_string(i) + " of the array";
+    }
+};
+
+
+TEST_F(InlineDynamicArrayUnitTest, NoStorageOverheadWithoutInlineBuffer) {
+    EXPECT_EQ(sizeof(DynamicArray<int>), 3 * sizeof(void*));
+    EXPECT_GE(sizeof(InlineDynamicArray<int, 16>),
+              3 * sizeof(void*) + 16 * sizeof(int));
+    EXPECT_FALSE(DynamicArray<int>().isInline());
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, StaysInlineUpToN) {
+    Array array = makeArray();
+    EXPECT_TRUE(array.isInline());
+    EXPECT_EQ(array.capacity(), 16u);
+
+    for (int i = 0; i < 15; ++i)
+        array.addLast(i);
+    array.insert(-1, 0);
+    array.removeAt(0);
+    array.addLast(15);
+
+    EXPECT_TRUE(array.isInline());
+    EXPECT_EQ(array.capacity(), 16u);
+    EXPECT_EQ(stats.allocations, 0u);
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(array.get(i), i);
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, SpillsToTheHeapBeyondN) {
+    {
+        Array array = makeArray();
+        for (int i = 0; i < 17; ++i)
+            array.addLast(i);
+
+        EXPECT_FALSE(array.isInline());
+        EXPECT_EQ(array.capacity(), 32u);
+        EXPECT_EQ(stats.allocations, 1u);
+        for (int i = 0; i < 17; ++i)
+            EXPECT_EQ(array.get(i), i);
+
+        // One growth step at a time, as for any DynamicArray
+        for (int i = 17; i < 33; ++i)
+            array.addLast(i);
+        EXPECT_EQ(array.capacity(), 64u);
+        EXPECT_EQ(stats.allocations, 2u);
+    }
+    EXPECT_EQ(stats.deallocations, 2u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, ReturnsInlineWhenItShrinks) {
+    Array array = makeArray();
+    for (int i = 0; i < 40; ++i)
+        array.addLast(i);
+    while (array.size() > 8)
+        array.removeLast();
+
+    // 64 slots shrank to 32, then to the inline 16
+    EXPECT_TRUE(array.isInline());
+    EXPECT_EQ(array.capacity(), 16u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(array.get(i), i);
+
+    InlineDynamicArray<int, 4> small;
+    for (int i = 0; i < 5; ++i)
+        small.addLast(i);
+    small.removeLast();
+    EXPECT_FALSE(small.isInline());
+    small.shrinkToFit();
+    EXPECT_TRUE(small.isInline());
+    EXPECT_EQ(small.getLast(), 3);
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, ClearReturnsToTheInlineBuffer) {
+    Array array = makeArray();
+    for (int i = 0; i < 100; ++i)
+        array.addLast(i);
+    array.clear();
+
+    EXPECT_TRUE(array.isInline());
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(array.capacity(), 16u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    array.addLast(7);
+    EXPECT_EQ(array.getFirst(), 7);
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, MoveRelocatesInlineElements) {
+    InlineDynamicArray<std::string, 8> source;
+    for (int i = 0; i < 5; ++i)
+        source.addLast(text(i));
+
+    InlineDynamicArray<std::string, 8> moved(std::move(source));
+    EXPECT_TRUE(moved.isInline());
+    EXPECT_TRUE(source.isInline());
+    EXPECT_TRUE(source.isEmpty());
+    ASSERT_EQ(moved.size(), 5u);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(moved.get(i), text(i));
+
+    // The moved-from array is usable
+    source.addLast(text(9));
+    EXPECT_EQ(source.getFirst(), text(9));
+
+    InlineDynamicArray<std::string, 8> assigned;
+    assigned.addLast(text(42));
+    assigned = std::move(moved);
+    EXPECT_TRUE(assigned.isInline());
+    EXPECT_EQ(assigned.size(), 5u);
+    EXPECT_EQ(assigned.getLast(), text(4));
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, MoveStealsHeapStorage) {
+    {
+        Array source = makeArray();
+        for (int i = 0; i < 20; ++i)
+            source.addLast(i);
+        const int* storage = source.data();
+
+        Array moved(std::move(source));
+        EXPECT_EQ(moved.data(), storage);
+        EXPECT_TRUE(source.isInline());
+        EXPECT_TRUE(source.isEmpty());
+
+        // Moving inline elements into an array on the heap frees its buffer
+        Array small = makeArray();
+        small.addLast(1);
+        moved = std::move(small);
+        EXPECT_TRUE(moved.isInline());
+        EXPECT_EQ(moved.getFirst(), 1);
+        EXPECT_EQ(stats.bytes_in_use, 0u);
+
+        source.addLast(5);
+        EXPECT_EQ(stats.allocations, 1u);
+    }
+    EXPECT_EQ(stats.deallocations, 1u);
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, CopyKeepsSmallArraysInline) {
+    InlineDynamicArray<std::string, 8> original;
+    for (int i = 0; i < 3; ++i)
+        original.addLast(text(i));
+
+    InlineDynamicArray<std::string, 8> copy(original);
+    EXPECT_TRUE(copy.isInline());
+    EXPECT_EQ(copy.getLast(), text(2));
+    EXPECT_EQ(original.getLast(), text(2));
+
+    InlineDynamicArray<std::string, 8> large;
+    for (int i = 0; i < 20; ++i)
+        large.addLast(text(i));
+    copy = large;
+    EXPECT_FALSE(copy.isInline());
+    EXPECT_EQ(copy.size(), 20u);
+
+    copy = original;
+    EXPECT_TRUE(copy.isInline());
+    EXPECT_EQ(copy.size(), 3u);
+
+    const InlineDynamicArray<std::string, 8> cloned = large.clone();
+    EXPECT_EQ(cloned.getLast(), text(19));
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, FailedCopyLeavesTargetUnchanged) {
+    using Strings = InlineDynamicArray<CopyThrows, 4>;
+    Strings original;
+    for (int i = 0; i < 3; ++i)
+        original.emplaceLast(text(i));
+    Strings target;
+    target.emplaceLast(text(7));
+
+    CopyThrows::should_throw = true;
+    EXPECT_THROW(target = original, std::runtime_error);
+    EXPECT_THROW(Strings copy(original), std::runtime_error);
+    ASSERT_EQ(target.size(), 1u);
+    EXPECT_EQ(target.getFirst().value, text(7));
+    EXPECT_EQ(original.getLast().value, text(2));
+
+    // Growing past the inline buffer moves, which cannot throw
+    for (int i = 3; i < 10; ++i)
+        original.emplaceLast(text(i));
+    EXPECT_EQ(original.get(5).value, text(5));
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, WorksWithTheAlgorithms) {
+    InlineDynamicArray<int, 16> array;
+    for (const int value : {5, 3, 9, 1, 7})
+        array.addLast(value);
+    algo::HeapSort(array);
+
+    EXPECT_TRUE(array.isInline());
+    for (std::size_t i = 1; i < array.size(); ++i)
+        EXPECT_LE(array.get(i - 1), array.get(i));
+}
+
+
+TEST_F(InlineDynamicArrayUnitTest, SpillsIntoAMemoryResource) {
+    std::pmr::monotonic_buffer_resource arena;
+    data_structs::pmr::InlineDynamicArray<int, 4> array{&arena};
+    for (int i = 0; i < 10; ++i)
+        array.addLast(i);
+
+    EXPECT_FALSE(array.isInline());
+    EXPECT_EQ(array.getAllocator().resource(), &arena);
+    EXPECT_EQ(array.getLast(), 9);
+}
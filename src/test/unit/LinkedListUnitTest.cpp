@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 
+#include "CountingAllocator.hpp"
 #include "LinkedList.hpp"
 #include "Record.hpp"
 #include "ThrowingType.hpp"
@@ -805,3 +807,43 @@ TEST_F(LinkedListUnitTest, RecordsReflectExternalChanges) {
     EXPECT_EQ(list.get(0).value, 42);
     EXPECT_EQ(list.get(1).value, -7);
 }
+
+
+TEST_F(LinkedListUnitTest, NodesComeFromTheAllocator) {
+    AllocationStats stats;
+    AllocationStats other_stats;
+    {
+        using List = LinkedList<std::string, CountingAllocator<std::string>>;
+        List list{CountingAllocator<std::string>(stats)};
+        for (int i = 0; i < 10; ++i)
+            list.addLast(std::to_string(i));
+        list.removeFirst();
+        // Nodes are carved out of pooled chunks; removal keeps the slot
+        EXPECT_LT(stats.allocations, 10u);
+        EXPECT_EQ(stats.deallocations, 0u);
+
+        const std::size_t chunks = stats.allocations;
+        for (int i = 0; i < 100; ++i) {
+            list.removeLast();
+            list.addFirst("again");
+        }
+        EXPECT_EQ(stats.allocations, chunks);
+
+        // Unequal, non-propagating allocators: the nodes cannot change hands
+        List other{CountingAllocator<std::string>(other_stats)};
+        other = std::move(list);
+        EXPECT_EQ(other.size(), 9u);
+        EXPECT_EQ(other.get(0), "again");
+        EXPECT_TRUE(list.isEmpty());
+        EXPECT_EQ(stats.bytes_in_use, 0u);
+        EXPECT_LT(other_stats.allocations, 9u);
+    }
+    EXPECT_EQ(other_stats.bytes_in_use, 0u);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    data_structs::pmr::LinkedList<int> pooled{&pool};
+    pooled.addLast(1);
+    pooled.addFirst(0);
+    EXPECT_EQ(pooled.getAllocator().resource(), &pool);
+    EXPECT_EQ(pooled.get(1), 1);
+}
@@ -0,0 +1,189 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "DynamicArrayAlgorithms.hpp"
+#include "MappedDynamicArray.hpp"
+
+
+using data_structs::AccessPattern;
+using data_structs::MappedDynamicArray;
+
+
+/// A trivially copyable record.
+struct Coordinate {
+    std::int32_t x;
+    std::int32_t y;
+};
+
+
+class MappedDynamicArrayUnitTest : public testing::Test {
+  protected:
+    std::filesystem::path path;
+
+    void SetUp() override {
+        const std::string name =
+            testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = std::filesystem::temp_directory_path() /
+               ("mapped_array_" + name + ".bin");
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+
+TEST_F(MappedDynamicArrayUnitTest, CreateMakesAnEmptyFile) {
+    auto array = MappedDynamicArray<int>::create(path);
+    EXPECT_TRUE(array.isOpen());
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(array.capacity(), 0u);
+    EXPECT_EQ(array.begin(), array.end());
+    EXPECT_EQ(array.path(), path);
+    EXPECT_TRUE(std::filesystem::exists(path));
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, GrowsThroughThePages) {
+    auto array = MappedDynamicArray<std::int64_t>::create(path);
+    for (std::int64_t i = 0; i < 100'000; ++i)
+        array.addLast(i * 3);
+
+    ASSERT_EQ(array.size(), 100'000u);
+    EXPECT_GE(array.capacity(), 100'000u);
+    EXPECT_GE(std::filesystem::file_size(path), 100'000u * 8);
+    for (std::size_t i = 0; i < array.size(); i += 997)
+        EXPECT_EQ(array.get(i), static_cast<std::int64_t>(i) * 3);
+    EXPECT_THROW(array.get(100'000), std::out_of_range);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, CloseTrimsTheFileAndOpenMapsItBack) {
+    {
+        auto array = MappedDynamicArray<Coordinate>::create(path);
+        for (std::int32_t i = 0; i < 1000; ++i)
+            array.emplaceLast(Coordinate{i, -i});
+        array.sync();
+        array.close();
+        EXPECT_FALSE(array.isOpen());
+        EXPECT_TRUE(array.isEmpty());
+        EXPECT_THROW(array.addLast(Coordinate{0, 0}), std::logic_error);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 1000 * sizeof(Coordinate));
+
+    auto reopened = MappedDynamicArray<Coordinate>::open(path);
+    ASSERT_EQ(reopened.size(), 1000u);
+    EXPECT_EQ(reopened.get(999).x, 999);
+    EXPECT_EQ(reopened.getUnchecked(500).y, -500);
+
+    // Appending to a reopened file grows it again
+    reopened.addLast(Coordinate{7, 7});
+    EXPECT_EQ(reopened.size(), 1001u);
+    EXPECT_EQ(reopened[1000].x, 7);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, OpensFilesWrittenByOtherPrograms) {
+    {
+        std::ofstream file(path, std::ios::binary);
+        const std::int32_t values[] = {4, 8, 15, 16, 23, 42};
+        file.write(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+
+    const auto array = MappedDynamicArray<std::int32_t>::open(path);
+    ASSERT_EQ(array.size(), 6u);
+    EXPECT_EQ(array.get(5), 42);
+
+    EXPECT_THROW(MappedDynamicArray<std::int64_t>::open(path.string() + "x"),
+                 std::system_error);
+
+    // A size that is not a whole number of elements is rejected
+    std::filesystem::resize_file(path, 7);
+    EXPECT_THROW(MappedDynamicArray<std::int32_t>::open(path),
+                 std::invalid_argument);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, RejectedOpenLeavesTheFileUntouched) {
+    const std::string bytes = "hello";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << bytes;
+    }
+
+    EXPECT_THROW(MappedDynamicArray<std::int32_t>::open(path),
+                 std::invalid_argument);
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    EXPECT_EQ(contents, bytes);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, AlgorithmsRunOnTheMapping) {
+    auto array = MappedDynamicArray<int>::create(path);
+    for (int i = 0; i < 50'000; ++i)
+        array.addLast((i * 7919) % 50'000);
+    array.advise(AccessPattern::RANDOM);
+
+    algo::QuickSort(array.span());
+    for (std::size_t i = 1; i < array.size(); ++i)
+        ASSERT_LE(array.get(i - 1), array.get(i));
+
+    array.advise(AccessPattern::SEQUENTIAL);
+    EXPECT_EQ(algo::BinarySearch(array.span(), 12'345), 12'345u);
+    EXPECT_EQ(algo::LinearSearch(array.span(), 49'999), 49'999u);
+    EXPECT_EQ(algo::Max(array.span()), 49'999);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, RemoveAndShrink) {
+    auto array = MappedDynamicArray<int>::create(path);
+    array.reserve(100'000);
+    EXPECT_GE(array.capacity(), 100'000u);
+    for (int i = 0; i < 10; ++i)
+        array.addLast(i);
+
+    EXPECT_EQ(array.removeLast(), 9);
+    array.shrinkToFit();
+    EXPECT_LT(array.capacity(), 100'000u);
+    EXPECT_LE(std::filesystem::file_size(path), 64u * 1024);
+    EXPECT_EQ(array.getUnchecked(8), 8);
+
+    array.removeAll();
+    array.shrinkToFit();
+    EXPECT_EQ(array.capacity(), 0u);
+    EXPECT_THROW(array.removeLast(), std::out_of_range);
+    array.addLast(1);
+    EXPECT_EQ(array.get(0), 1);
+}
+
+
+TEST_F(MappedDynamicArrayUnitTest, MoveTransfersTheFile) {
+    auto array = MappedDynamicArray<int>::create(path);
+    array.addLast(5);
+
+    MappedDynamicArray<int> moved(std::move(array));
+    EXPECT_FALSE(array.isOpen());
+    EXPECT_EQ(moved.get(0), 5);
+
+    const std::filesystem::path other_path = path.string() + ".other";
+    auto other = MappedDynamicArray<int>::create(other_path);
+    other.addLast(1);
+    other.addLast(2);
+    moved = std::move(other);
+    EXPECT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved.path(), other_path);
+    EXPECT_EQ(std::filesystem::file_size(path), sizeof(int));
+
+    moved.close();
+    EXPECT_EQ(std::filesystem::file_size(other_path), 2 * sizeof(int));
+    std::filesystem::remove(other_path);
+}
@@ -1,10 +1,12 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "CountingAllocator.hpp"
 #include "MaxHeap.hpp"
 
 
@@ -240,3 +242,24 @@ TEST_F(MaxHeapUnitTest, HeightShouldBeLogarithmic) {
     EXPECT_EQ(heap.getHeight(), 4);
     EXPECT_TRUE(heap.isValidHeap());
 }
+
+
+TEST_F(MaxHeapUnitTest, NodesComeFromTheAllocator) {
+    AllocationStats stats;
+    {
+        const int values[] = {4, 9, 1, 7};
+        MaxHeap<int, CountingAllocator<int>> heap(values, 4,
+                                              CountingAllocator<int>(stats));
+        EXPECT_EQ(heap.extractRoot(), 9);
+        EXPECT_EQ(stats.allocations, 1u);
+        EXPECT_EQ(stats.deallocations, 0u);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    data_structs::pmr::MaxHeap<int> pooled{&pool};
+    pooled.insert(2);
+    pooled.insert(3);
+    EXPECT_EQ(pooled.getAllocator().resource(), &pool);
+    EXPECT_TRUE(pooled.isValidHeap());
+}
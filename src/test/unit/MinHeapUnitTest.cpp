@@ -1,10 +1,12 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "CountingAllocator.hpp"
 #include "MinHeap.hpp"
 
 
@@ -279,3 +281,24 @@ TEST_F(MinHeapUnitTest, EmptyHeapOperationsShouldWork) {
     EXPECT_THROW(heap.peekRoot(), std::out_of_range);
     EXPECT_THROW(heap.extractRoot(), std::out_of_range);
 }
+
+
+TEST_F(MinHeapUnitTest, NodesComeFromTheAllocator) {
+    AllocationStats stats;
+    {
+        const int values[] = {4, 9, 1, 7};
+        MinHeap<int, CountingAllocator<int>> heap(values, 4,
+                                              CountingAllocator<int>(stats));
+        EXPECT_EQ(heap.extractRoot(), 1);
+        EXPECT_EQ(stats.allocations, 1u);
+        EXPECT_EQ(stats.deallocations, 0u);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    data_structs::pmr::MinHeap<int> pooled{&pool};
+    pooled.insert(2);
+    pooled.insert(3);
+    EXPECT_EQ(pooled.getAllocator().resource(), &pool);
+    EXPECT_TRUE(pooled.isValidHeap());
+}
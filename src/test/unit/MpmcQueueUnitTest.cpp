@@ -0,0 +1,303 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CountingAllocator.hpp"
+#include "MpmcQueue.hpp"
+
+
+using data_structs::BoundedMpmcQueue;
+using data_structs::UnboundedMpmcQueue;
+using namespace std::chrono_literals;
+
+
+/// Cannot be built from a negative number.
+struct NonNegative {
+    int value;
+
+    explicit NonNegative(const int v) : value(v) {
+        if (v < 0)
+            throw std::invalid_argument("negative");
+    }
+};
+
+
+/**
+ * Runs `producers` threads that each enqueue `per_producer` values tagged
+ * with their index, and `consumers` threads that each take `per_producer`
+ * values. Checks that every value arrives exactly once and that the values
+ * of each producer arrive in order at every consumer.
+ */
+template <typename Enqueue, typename Dequeue>
+void transferConcurrently(const std::uint64_t producers,
+                          const std::uint64_t consumers,
+                          const std::uint64_t per_producer, Enqueue enqueue,
+                          Dequeue dequeue) {
+    const std::uint64_t total = producers * per_producer;
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<bool> in_order = true;
+    std::atomic<std::uint64_t> taken = 0;
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t p = 0; p < producers; ++p)
+        threads.emplace_back([&, p] {
+            for (std::uint64_t i = 0; i < per_producer; ++i)
+                enqueue(p << 32 | i);
+        });
+    for (std::uint64_t c = 0; c < consumers; ++c)
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> last(producers, -1);
+            while (taken.fetch_add(1) < total) {
+                const std::uint64_t value = dequeue();
+                const std::uint64_t producer = value >> 32;
+                const auto index =
+                    static_cast<std::int64_t>(value & 0xFFFFFFFF);
+                if (index <= last[producer])
+                    in_order = false;
+                last[producer] = index;
+                seen[producer * per_producer + index].fetch_add(1);
+            }
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(in_order);
+    std::uint64_t exactly_once = 0;
+    for (const std::atomic<int>& count : seen)
+        exactly_once += count.load() == 1;
+    EXPECT_EQ(exactly_once, total);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedCapacityIsRoundedToAPowerOfTwo) {
+    EXPECT_EQ(BoundedMpmcQueue<int>(0).capacity(), 2u);
+    EXPECT_EQ(BoundedMpmcQueue<int>(1).capacity(), 2u);
+    EXPECT_EQ(BoundedMpmcQueue<int>(5).capacity(), 8u);
+    EXPECT_EQ(BoundedMpmcQueue<int>(64).capacity(), 64u);
+    EXPECT_THROW(BoundedMpmcQueue<int>(SIZE_MAX), std::length_error);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedFillsUpAndDrainsInOrder) {
+    BoundedMpmcQueue<int> queue(4);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryDequeue().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.tryEnqueue(i));
+    EXPECT_FALSE(queue.tryEnqueue(4));
+    EXPECT_EQ(queue.size(), 4u);
+
+    // Wrap around the ring many times
+    for (int i = 4; i < 1000; ++i) {
+        ASSERT_EQ(queue.tryDequeue(), i - 4);
+        ASSERT_TRUE(queue.tryEnqueue(i));
+    }
+    for (int i = 996; i < 1000; ++i)
+        EXPECT_EQ(queue.dequeue(), i);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedFailedConstructionClaimsNoSlot) {
+    BoundedMpmcQueue<NonNegative> queue(2);
+    EXPECT_TRUE(queue.tryEmplace(1));
+    EXPECT_THROW(queue.tryEmplace(-1), std::invalid_argument);
+    EXPECT_THROW(queue.emplace(-2), std::invalid_argument);
+    EXPECT_EQ(queue.size(), 1u);
+
+    EXPECT_TRUE(queue.tryEmplace(2));
+    EXPECT_FALSE(queue.tryEmplace(3));
+    EXPECT_EQ(queue.dequeue().value, 1);
+    EXPECT_EQ(queue.dequeue().value, 2);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedDestroysLeftoversWithTheAllocator) {
+    AllocationStats stats;
+    const auto shared = std::make_shared<int>(1);
+    {
+        using Element = std::shared_ptr<int>;
+        BoundedMpmcQueue<Element, CountingAllocator<Element>> queue(
+            16, CountingAllocator<Element>(stats));
+        for (int i = 0; i < 10; ++i)
+            queue.tryEnqueue(shared);
+        queue.tryDequeue();
+        EXPECT_EQ(shared.use_count(), 10);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedTimedDequeueGivesUpOnAnEmptyQueue) {
+    BoundedMpmcQueue<int> queue(4);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.tryDequeueFor(20ms).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+    queue.tryEnqueue(7);
+    EXPECT_EQ(queue.tryDequeueUntil(std::chrono::steady_clock::now()), 7);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedBlockingCallsWakeEachOther) {
+    BoundedMpmcQueue<std::string> queue(2);
+
+    // Consumers wait for elements...
+    std::string first;
+    std::thread consumer([&] { first = queue.dequeue(); });
+    std::this_thread::sleep_for(10ms);
+    queue.enqueue("woken");
+    consumer.join();
+    EXPECT_EQ(first, "woken");
+
+    // ...and producers for free slots
+    queue.enqueue("a");
+    queue.enqueue("b");
+    std::thread producer([&] { queue.enqueue("c"); });
+    std::this_thread::sleep_for(10ms);
+    EXPECT_EQ(queue.dequeue(), "a");
+    producer.join();
+    EXPECT_EQ(queue.dequeue(), "b");
+    EXPECT_EQ(queue.dequeue(), "c");
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedBlockingEnqueueMovesTheElement) {
+    BoundedMpmcQueue<std::unique_ptr<int>> queue(2);
+    queue.enqueue(std::make_unique<int>(1));
+    auto second = std::make_unique<int>(2);
+    queue.emplace(std::move(second));
+    EXPECT_EQ(second, nullptr);
+
+    // A waiting enqueue keeps its element until a slot frees up
+    auto third = std::make_unique<int>(3);
+    std::thread producer([&] { queue.enqueue(std::move(third)); });
+    std::this_thread::sleep_for(10ms);
+    EXPECT_EQ(*queue.dequeue(), 1);
+    producer.join();
+    EXPECT_EQ(third, nullptr);
+    EXPECT_EQ(*queue.dequeue(), 2);
+    EXPECT_EQ(*queue.dequeue(), 3);
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedTransfersBetweenManyThreads) {
+    BoundedMpmcQueue<std::uint64_t> queue(64);
+    transferConcurrently(
+        4, 4, 20'000, [&](const std::uint64_t value) { queue.enqueue(value); },
+        [&] { return queue.dequeue(); });
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST(MpmcQueueUnitTest, BoundedTryCallsTransferBetweenManyThreads) {
+    BoundedMpmcQueue<std::uint64_t> queue(8);
+    transferConcurrently(
+        3, 5, 20'000,
+        [&](const std::uint64_t value) {
+            while (!queue.tryEnqueue(value))
+                std::this_thread::yield();
+        },
+        [&] {
+            std::optional<std::uint64_t> value;
+            while (!(value = queue.tryDequeue()))
+                std::this_thread::yield();
+            return *value;
+        });
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedKeepsOrderAcrossSegments) {
+    UnboundedMpmcQueue<std::string, 4> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryDequeue().has_value());
+
+    for (int i = 0; i < 100; ++i)
+        queue.enqueue(std::to_string(i));
+    EXPECT_FALSE(queue.isEmpty());
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(queue.dequeue(), std::to_string(i));
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryDequeue().has_value());
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedReusesDrainedSegments) {
+    AllocationStats stats;
+    {
+        const CountingAllocator<int> allocator(stats);
+        UnboundedMpmcQueue<int, 8, CountingAllocator<int>> queue(allocator);
+
+        // A backlog of up to 40 elements needs at most 6 segments
+        for (int round = 0; round < 100; ++round) {
+            for (int i = 0; i < 40; ++i)
+                queue.enqueue(i);
+            for (int i = 0; i < 40; ++i)
+                ASSERT_EQ(queue.tryDequeue(), i);
+        }
+        EXPECT_LE(stats.allocations, 7u);
+    }
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedDestroysLeftovers) {
+    const auto shared = std::make_shared<int>(1);
+    {
+        UnboundedMpmcQueue<std::shared_ptr<int>, 4> queue;
+        for (int i = 0; i < 10; ++i)
+            queue.enqueue(shared);
+        for (int i = 0; i < 5; ++i)
+            queue.tryDequeue();
+        EXPECT_EQ(shared.use_count(), 6);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedFailedConstructionClaimsNoSlot) {
+    UnboundedMpmcQueue<NonNegative, 2> queue;
+    queue.emplace(1);
+    EXPECT_THROW(queue.emplace(-1), std::invalid_argument);
+    queue.emplace(2);
+    queue.emplace(3);
+    for (int expected = 1; expected <= 3; ++expected)
+        EXPECT_EQ(queue.dequeue().value, expected);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedTimedAndBlockingDequeue) {
+    UnboundedMpmcQueue<int> queue;
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.tryDequeueFor(20ms).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+    int value = 0;
+    std::thread consumer([&] { value = queue.dequeue(); });
+    std::this_thread::sleep_for(10ms);
+    queue.enqueue(42);
+    consumer.join();
+    EXPECT_EQ(value, 42);
+}
+
+
+TEST(MpmcQueueUnitTest, UnboundedTransfersBetweenManyThreads) {
+    // Small segments, so they are linked, drained and reused constantly
+    UnboundedMpmcQueue<std::uint64_t, 16> queue;
+    transferConcurrently(
+        4, 4, 20'000, [&](const std::uint64_t value) { queue.enqueue(value); },
+        [&] { return queue.dequeue(); });
+    EXPECT_TRUE(queue.isEmpty());
+}
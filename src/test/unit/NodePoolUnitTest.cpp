@@ -0,0 +1,166 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "CountingAllocator.hpp"
+#include "NodePool.hpp"
+
+
+using data_structs::NodePool;
+
+
+/// A list-node sized payload.
+struct SmallNode {
+    std::int64_t value;
+    SmallNode* next;
+    SmallNode* prev;
+};
+
+/// A node that does not fit into one page.
+struct HugeNode {
+    char payload[5000];
+};
+
+/// A node with a stricter alignment than the allocator's default.
+struct alignas(64) AlignedNode {
+    int value;
+};
+
+
+class NodePoolUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    template <typename Node>
+    using Pool = NodePool<Node, CountingAllocator<Node>>;
+
+    AllocationStats stats;
+
+    template <typename Node>
+    Pool<Node> makePool() {
+        return Pool<Node>(CountingAllocator<Node>(stats));
+    }
+};
+
+
+TEST_F(NodePoolUnitTest, NewPoolDoesNotAllocate) {
+    {
+        Pool<SmallNode> pool = makePool<SmallNode>();
+        pool.release();
+    }
+    EXPECT_EQ(stats.allocations, 0u);
+    EXPECT_EQ(stats.deallocations, 0u);
+}
+
+
+TEST_F(NodePoolUnitTest, ConsecutiveNodesAreAdjacent) {
+    Pool<SmallNode> pool = makePool<SmallNode>();
+    SmallNode* first = pool.allocate();
+    SmallNode* second = pool.allocate();
+    SmallNode* third = pool.allocate();
+
+    EXPECT_EQ(second, first + 1);
+    EXPECT_EQ(third, second + 1);
+    EXPECT_EQ(stats.allocations, 1u);
+}
+
+
+TEST_F(NodePoolUnitTest, FreedSlotsAreReusedWithoutAllocating) {
+    Pool<SmallNode> pool = makePool<SmallNode>();
+    std::vector<SmallNode*> nodes;
+    for (int i = 0; i < 1000; ++i)
+        nodes.push_back(pool.allocate());
+    const std::size_t chunks = stats.allocations;
+
+    // Remove and insert in a steady state: every slot comes from the list
+    for (int round = 0; round < 100; ++round) {
+        SmallNode* freed = nodes[static_cast<std::size_t>(round * 7)];
+        pool.deallocate(freed);
+        EXPECT_EQ(pool.allocate(), freed);
+    }
+    EXPECT_EQ(stats.allocations, chunks);
+    EXPECT_EQ(stats.deallocations, 0u);
+}
+
+
+TEST_F(NodePoolUnitTest, ChunksGrowToAPage) {
+    {
+        Pool<SmallNode> pool = makePool<SmallNode>();
+        for (int i = 0; i < 10000; ++i)
+            ASSERT_NE(pool.allocate(), nullptr);
+
+        // A few small chunks first, then page-sized ones
+        EXPECT_GT(stats.allocations, 10000 * sizeof(SmallNode) / 4096);
+        EXPECT_LT(stats.allocations, 10000 * sizeof(SmallNode) / 4096 + 10);
+        EXPECT_LE(stats.bytes_in_use, 10000 * sizeof(SmallNode) + 2 * 4096);
+
+        // Bulk release: one deallocation per chunk
+        pool.release();
+        EXPECT_EQ(stats.deallocations, stats.allocations);
+        EXPECT_EQ(stats.bytes_in_use, 0u);
+
+        // The pool is usable again afterwards
+        EXPECT_NE(pool.allocate(), nullptr);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(NodePoolUnitTest, NodesLargerThanAPage) {
+    Pool<HugeNode> pool = makePool<HugeNode>();
+    HugeNode* first = pool.allocate();
+    HugeNode* second = pool.allocate();
+    first->payload[4999] = 'a';
+    second->payload[0] = 'b';
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(first->payload[4999], 'a');
+    EXPECT_EQ(stats.allocations, 2u);
+}
+
+
+TEST_F(NodePoolUnitTest, OverAlignedNodes) {
+    Pool<AlignedNode> pool = makePool<AlignedNode>();
+    for (int i = 0; i < 200; ++i) {
+        const AlignedNode* node = pool.allocate();
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(node) % 64, 0u);
+    }
+}
+
+
+TEST_F(NodePoolUnitTest, MoveAndAdoptTransferTheChunks) {
+    {
+        Pool<SmallNode> source = makePool<SmallNode>();
+        SmallNode* node = source.allocate();
+        source.deallocate(node);
+
+        Pool<SmallNode> moved(std::move(source));
+        EXPECT_EQ(moved.allocate(), node);
+
+        Pool<SmallNode> target = makePool<SmallNode>();
+        EXPECT_NE(target.allocate(), nullptr);
+        target.adopt(moved);
+        EXPECT_EQ(stats.deallocations, 1u);
+
+        // The adopted chunk continues where the moved pool left off
+        EXPECT_EQ(target.allocate(), node + 1);
+        EXPECT_EQ(stats.allocations, 2u);
+    }
+    EXPECT_EQ(stats.deallocations, 2u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(NodePoolUnitTest, ChunksComeFromAMemoryResource) {
+    std::pmr::monotonic_buffer_resource arena;
+    NodePool<SmallNode, std::pmr::polymorphic_allocator<SmallNode>> pool{
+        &arena};
+    SmallNode* node = pool.allocate();
+    node->value = 42;
+
+    EXPECT_EQ(pool.getAllocator().resource(), &arena);
+    EXPECT_EQ(node->value, 42);
+}
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "InputDistributions.hpp"
+#include "ParallelAlgorithms.hpp"
+
+
+using algo::ThreadPool;
+using data_structs::DynamicArray;
+
+
+class ParallelAlgorithmsUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr Distribution DISTRIBUTIONS[] = {
+        Distribution::RANDOM, Distribution::SORTED, Distribution::REVERSED,
+        Distribution::FEW_UNIQUE, Distribution::ORGAN_PIPE,
+        Distribution::NEARLY_SORTED};
+
+    // Around and well above the sequential cutoff, including odd sizes
+    static constexpr std::size_t SIZES[] = {
+        0, 1, 1000, algo::PARALLEL_SORT_CUTOFF + 1,
+        4 * algo::PARALLEL_SORT_CUTOFF + 7, 300001};
+
+
+    /// Runs `sorter` on every (size, distribution) combination and compares
+    /// against std::sort.
+    template <typename Sorter>
+    static void expectSortsAllInputs(Sorter sorter) {
+        for (const std::size_t size : SIZES) {
+            for (const Distribution distribution : DISTRIBUTIONS) {
+                SCOPED_TRACE(std::string(distributionName(distribution)) +
+                             " n=" + std::to_string(size));
+                DynamicArray<int> array = makeInput(size, distribution);
+                std::vector<int> expected(array.begin(), array.end());
+                std::sort(expected.begin(), expected.end());
+
+                sorter(array);
+                ASSERT_EQ(array.size(), expected.size());
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                    ASSERT_EQ(array.get(i), expected[i]) << "at index " << i;
+            }
+        }
+    }
+};
+
+
+/// Record sorted by `key`; `order` remembers the original position.
+struct OrderedKey {
+    int key;
+    int order;
+
+    bool operator<(const OrderedKey& other) const { return key < other.key; }
+};
+
+
+TEST_F(ParallelAlgorithmsUnitTest, CoRankSplitsStableMerge) {
+    const int a[] = {1, 3, 3, 5, 9};
+    const int b[] = {2, 3, 4, 9, 10, 11};
+
+    // Merged (ties from a first): 1 2 3a 3a 3b 4 5 9a 9b 10 11
+    const std::size_t expected_from_a[] = {0, 1, 1, 2, 3, 3, 3,
+                                           4, 5, 5, 5, 5};
+    for (std::size_t k = 0; k <= 11; ++k)
+        EXPECT_EQ(algo::coRank(k, a, 5, b, 6), expected_from_a[k])
+            << "k=" << k;
+}
+
+
+TEST_F(ParallelAlgorithmsUnitTest, ParallelMergeSortSortsAllInputs) {
+    ThreadPool pool(3);
+    expectSortsAllInputs(
+        [&](DynamicArray<int>& a) { algo::ParallelMergeSort(a, pool); });
+}
+
+
+TEST_F(ParallelAlgorithmsUnitTest, ParallelQuickSortSortsAllInputs) {
+    ThreadPool pool(3);
+    expectSortsAllInputs(
+        [&](DynamicArray<int>& a) { algo::ParallelQuickSort(a, pool); });
+}
+
+
+TEST_F(ParallelAlgorithmsUnitTest, ThreadCountOverloads) {
+    const DynamicArray<int> input =
+        makeInput(4 * algo::PARALLEL_SORT_CUTOFF + 7, Distribution::RANDOM);
+    std::vector<int> expected(input.begin(), input.end());
+    std::sort(expected.begin(), expected.end());
+
+    for (const std::size_t threads : {0u, 1u, 2u, 5u}) {
+        SCOPED_TRACE("threads=" + std::to_string(threads));
+        DynamicArray<int> merged = input;
+        DynamicArray<int> quick = input;
+        algo::ParallelMergeSort(merged.span(), threads);
+        algo::ParallelQuickSort(quick, threads);
+
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(merged.get(i), expected[i]) << "at index " << i;
+            ASSERT_EQ(quick.get(i), expected[i]) << "at index " << i;
+        }
+    }
+}
+
+
+TEST_F(ParallelAlgorithmsUnitTest, ParallelMergeSortIsStable) {
+    DynamicArray<OrderedKey> array;
+    for (int i = 0; i < 200000; ++i)
+        array.addLast(OrderedKey{(i * 7919) % 100, i});
+
+    algo::ParallelMergeSort(array, 4);
+    for (std::size_t i = 1; i < array.size(); ++i) {
+        const OrderedKey& prev = array.get(i - 1);
+        const OrderedKey& cur = array.get(i);
+        ASSERT_LE(prev.key, cur.key);
+        if (prev.key == cur.key) {
+            ASSERT_LT(prev.order, cur.order) << "at index " << i;
+        }
+    }
+}
+
+
+TEST_F(ParallelAlgorithmsUnitTest, ParallelSortsMoveStrings) {
+    DynamicArray<std::string> array;
+    for (int i = 0; i < 100000; ++i)
+        array.addLast("key" + std::to_string((i * 7919) % 100003));
+    std::vector<std::string> expected(array.begin(), array.end());
+    std::sort(expected.begin(), expected.end());
+
+    DynamicArray<std::string> copy = array;
+    ThreadPool pool(2);
+    algo::ParallelMergeSort(array, pool);
+    algo::ParallelQuickSort(copy, pool);
+
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(array.get(i), expected[i]);
+        ASSERT_EQ(copy.get(i), expected[i]);
+    }
+}
@@ -1,10 +1,16 @@
+#include <bit>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "CountingAllocator.hpp"
 #include "Queue.hpp"
 #include "ThrowingType.hpp"
 
@@ -868,3 +874,407 @@ TEST_F(QueueUnitTest, EmplaceLastConstructsInPlace) {
 
     EXPECT_EQ(queue.size(), 0);
 }
+
+
+TEST_F(QueueUnitTest, StorageComesFromTheAllocator) {
+    AllocationStats stats;
+    {
+        Queue<int, CountingAllocator<int>> queue{CountingAllocator<int>(stats)};
+        for (int i = 0; i < 100; ++i)
+            queue.enqueue(i);
+        for (int i = 0; i < 90; ++i)
+            EXPECT_EQ(queue.dequeue(), i);
+
+        const Queue<int, CountingAllocator<int>> copy(queue);
+        EXPECT_EQ(copy.getAllocator(), CountingAllocator<int>(stats));
+        EXPECT_EQ(copy.size(), 10u);
+        EXPECT_EQ(copy.front(), 90);
+        EXPECT_GT(stats.bytes_in_use, 0u);
+    }
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::monotonic_buffer_resource arena;
+    data_structs::pmr::Queue<int> queue{&arena};
+    queue.enqueue(1);
+    queue.enqueue(2);
+    EXPECT_EQ(queue.getAllocator().resource(), &arena);
+    EXPECT_EQ(queue.dequeue(), 1);
+}
+
+
+TEST_F(QueueUnitTest, CapacityIsAlwaysAPowerOfTwo) {
+    const Queue<int> sized(50);
+    EXPECT_EQ(sized.capacity(), 64u);
+
+    const int initial[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const Queue<int> filled(initial, 9);
+    EXPECT_EQ(filled.capacity(), 16u);
+
+    Queue<int> queue;
+    for (int i = 0; i < 1000; ++i) {
+        queue.enqueue(i);
+        ASSERT_TRUE(std::has_single_bit(queue.capacity()));
+    }
+    for (int i = 0; i < 990; ++i) {
+        queue.dequeue();
+        ASSERT_TRUE(std::has_single_bit(queue.capacity()));
+    }
+    EXPECT_LT(queue.capacity(), 1024u);
+    EXPECT_EQ(queue.front(), 990);
+}
+
+
+TEST_F(QueueUnitTest, WrapsAroundManyTimesWithoutGrowing) {
+    Queue<std::string> queue(8);
+    for (int i = 0; i < 5; ++i)
+        queue.enqueue(std::to_string(i));
+
+    // The counters run far past the capacity while the slots are reused
+    for (int i = 5; i < 10'000; ++i) {
+        queue.enqueue(std::to_string(i));
+        ASSERT_EQ(queue.dequeue(), std::to_string(i - 5));
+    }
+    EXPECT_EQ(queue.capacity(), 8u);
+    EXPECT_EQ(queue.front(), "9995");
+    EXPECT_EQ(queue.back(), "9999");
+
+    std::size_t count = 0;
+    for (const std::string& element : queue)
+        EXPECT_EQ(element, std::to_string(9995 + count++));
+    EXPECT_EQ(count, 5u);
+
+    // Growth while wrapped keeps FIFO order
+    for (int i = 10'000; i < 10'020; ++i)
+        queue.enqueue(std::to_string(i));
+    EXPECT_EQ(queue.capacity(), 32u);
+    for (int i = 9995; i < 10'020; ++i)
+        EXPECT_EQ(queue.dequeue(), std::to_string(i));
+}
+
+
+/// Counts the copies and moves made of it, to show where a queue builds
+/// temporaries.
+struct CopyCounter {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    int id;
+
+    explicit CopyCounter(const int id) : id(id) {}
+    CopyCounter(const CopyCounter& other) : id(other.id) { ++copies; }
+    CopyCounter(CopyCounter&& other) noexcept : id(other.id) { ++moves; }
+    CopyCounter& operator=(const CopyCounter&) = delete;
+    CopyCounter& operator=(CopyCounter&&) = delete;
+};
+
+
+TEST_F(QueueUnitTest, EmplaceBackConstructsWithoutTemporaries) {
+    Queue<CopyCounter> queue(16);
+    for (int i = 0; i < 100; ++i) {
+        CopyCounter::copies = 0;
+        CopyCounter::moves = 0;
+
+        queue.emplaceBack(i);
+        EXPECT_EQ(CopyCounter::copies, 0);
+        EXPECT_EQ(CopyCounter::moves, 0);
+        EXPECT_EQ(queue.back().id, i);
+        if (queue.size() > 10) {
+            EXPECT_EQ(queue.dequeue().id, i - 10);
+        }
+    }
+    EXPECT_EQ(queue.capacity(), 16u);
+}
+
+
+TEST_F(QueueUnitTest, NonAssignableTypeReusesFreedSlots) {
+    AllocationStats stats;
+    int target = 0;
+    Queue<Record, CountingAllocator<Record>> queue{
+        CountingAllocator<Record>(stats)};
+    for (int i = 0; i < 4; ++i)
+        queue.enqueue(Record{target});
+
+    const std::size_t allocations = stats.allocations;
+    for (int i = 0; i < 1000; ++i) {
+        queue.enqueue(Record{target});
+        queue.dequeue().value = i;
+    }
+    EXPECT_EQ(stats.allocations, allocations);
+    EXPECT_EQ(target, 999);
+}
+
+
+TEST_F(QueueUnitTest, DequeueReleasesTheElementImmediately) {
+    const auto shared = std::make_shared<int>(7);
+    Queue<std::shared_ptr<int>> queue;
+    queue.enqueue(shared);
+    queue.enqueue(shared);
+    EXPECT_EQ(shared.use_count(), 3);
+
+    queue.dequeue();
+    EXPECT_EQ(shared.use_count(), 2);
+    queue.dequeue();
+    EXPECT_EQ(shared.use_count(), 1);
+
+    queue.enqueue(shared);
+    queue.clear();
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+
+TEST_F(QueueUnitTest, FailedEnqueueLeavesTheQueueUnchanged) {
+    ThrowingType::reset();
+    {
+        Queue<ThrowingType> queue;
+        queue.emplaceBack(1);
+        queue.emplaceBack(2);
+
+        ThrowingType::should_throw = true;
+        EXPECT_THROW(queue.emplaceBack(3), std::runtime_error);
+        EXPECT_EQ(queue.size(), 2u);
+        EXPECT_EQ(queue.back().value, 2);
+        ThrowingType::should_throw = false;
+
+        // A failure while growing keeps the old buffer and its elements
+        for (int i = 3; i <= 8; ++i)
+            queue.emplaceBack(i);
+        ThrowingType::should_throw = true;
+        EXPECT_THROW(queue.emplaceBack(9), std::runtime_error);
+        ThrowingType::should_throw = false;
+        EXPECT_EQ(queue.capacity(), 8u);
+        EXPECT_EQ(queue.size(), 8u);
+        EXPECT_EQ(queue.front().value, 1);
+        EXPECT_EQ(queue.back().value, 8);
+    }
+    EXPECT_EQ(ThrowingType::construction_count, 0);
+    ThrowingType::reset();
+}
+
+
+TEST_F(QueueUnitTest, MoveAssignmentBetweenUnequalAllocators) {
+    AllocationStats source_stats;
+    AllocationStats target_stats;
+    {
+        Queue<std::string, CountingAllocator<std::string>> source{
+            CountingAllocator<std::string>(source_stats)};
+        Queue<std::string, CountingAllocator<std::string>> target{
+            CountingAllocator<std::string>(target_stats)};
+        for (int i = 0; i < 12; ++i)
+            source.enqueue(std::string(40, static_cast<char>('a' + i)));
+        for (int i = 0; i < 5; ++i)
+            source.dequeue();
+        target.enqueue("old");
+
+        target = std::move(source);
+        EXPECT_TRUE(source.isEmpty());
+        EXPECT_EQ(target.getAllocator(),
+                  CountingAllocator<std::string>(target_stats));
+        ASSERT_EQ(target.size(), 7u);
+        EXPECT_EQ(target.front(), std::string(40, 'f'));
+        EXPECT_EQ(target.back(), std::string(40, 'l'));
+
+        source.enqueue("reused");
+        EXPECT_EQ(source.front(), "reused");
+    }
+    EXPECT_EQ(source_stats.bytes_in_use, 0u);
+    EXPECT_EQ(target_stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(QueueUnitTest, EnqueueRangeFillsTheWrappedFreeSlots) {
+    Queue<std::string> queue;
+    for (int i = 0; i < 6; ++i)
+        queue.enqueue(std::to_string(i));
+    for (int i = 0; i < 5; ++i)
+        queue.dequeue();
+
+    // Back slot 6 of 8: two slots before the end, then four from the start
+    const std::vector<std::string> batch = {"a", "b", "c", "d", "e", "f"};
+    queue.enqueueRange(batch.begin(), batch.end());
+    EXPECT_EQ(queue.capacity(), 8u);
+    ASSERT_EQ(queue.size(), 7u);
+
+    const auto [first, second] = queue.segments();
+    EXPECT_EQ(first.size(), 3u);
+    EXPECT_EQ(second.size(), 4u);
+
+    std::vector<std::string> drained;
+    EXPECT_EQ(queue.dequeueInto(std::back_inserter(drained), 100), 7u);
+    EXPECT_EQ(drained, (std::vector<std::string>{"5", "a", "b", "c", "d",
+                                                 "e", "f"}));
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST_F(QueueUnitTest, EnqueueRangeGrowsOnceForTheWholeBatch) {
+    AllocationStats stats;
+    {
+        Queue<int, CountingAllocator<int>> queue{CountingAllocator<int>(stats)};
+        queue.enqueue(-1);
+        std::vector<int> batch(100);
+        for (int i = 0; i < 100; ++i)
+            batch[i] = i;
+
+        queue.enqueueRange(batch.begin(), batch.end());
+        EXPECT_EQ(stats.allocations, 2u);
+        EXPECT_EQ(queue.capacity(), 128u);
+        ASSERT_EQ(queue.size(), 101u);
+        EXPECT_EQ(queue.front(), -1);
+        EXPECT_EQ(queue.back(), 99);
+
+        queue.enqueueRange(batch.begin(), batch.begin());
+        EXPECT_EQ(queue.size(), 101u);
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST_F(QueueUnitTest, EnqueueRangeAcceptsSinglePassIterators) {
+    std::istringstream input("1 2 3 4 5 6 7 8 9 10");
+    Queue<int> queue;
+    queue.enqueue(0);
+    queue.enqueueRange(std::istream_iterator<int>(input),
+                       std::istream_iterator<int>());
+    ASSERT_EQ(queue.size(), 11u);
+    for (int i = 0; i <= 10; ++i)
+        EXPECT_EQ(queue.dequeue(), i);
+}
+
+
+TEST_F(QueueUnitTest, EnqueueRangeMovesFromMoveIterators) {
+    std::vector<std::unique_ptr<int>> batch;
+    for (int i = 0; i < 5; ++i)
+        batch.push_back(std::make_unique<int>(i));
+
+    Queue<std::unique_ptr<int>> queue;
+    queue.enqueueRange(std::make_move_iterator(batch.begin()),
+                       std::make_move_iterator(batch.end()));
+    EXPECT_EQ(batch[0], nullptr);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(*queue.dequeue(), i);
+}
+
+
+/// Copies succeed until the shared budget runs out.
+struct CopyBudget {
+    static inline int remaining = 0;
+    static inline int alive = 0;
+    int value;
+
+    explicit CopyBudget(const int v) : value(v) { ++alive; }
+
+    CopyBudget(const CopyBudget& other) : value(other.value) {
+        if (remaining-- == 0)
+            throw std::runtime_error("copy budget exhausted");
+        ++alive;
+    }
+
+    ~CopyBudget() { --alive; }
+};
+
+
+TEST_F(QueueUnitTest, FailedEnqueueRangeLeavesTheQueueUnchanged) {
+    CopyBudget::remaining = 100;
+    {
+        Queue<CopyBudget> queue;
+        for (int i = 0; i < 6; ++i)
+            queue.emplaceBack(i);
+        for (int i = 0; i < 5; ++i)
+            queue.dequeue();
+        std::vector<CopyBudget> batch;
+        batch.reserve(6);
+        for (int i = 10; i < 16; ++i)
+            batch.emplace_back(i);
+
+        // Fails in the wrapped part, after the run up to the buffer's end
+        CopyBudget::remaining = 4;
+        EXPECT_THROW(queue.enqueueRange(batch.begin(), batch.end()),
+                     std::runtime_error);
+        EXPECT_EQ(CopyBudget::alive, 7);
+        ASSERT_EQ(queue.size(), 1u);
+        EXPECT_EQ(queue.front().value, 5);
+
+        CopyBudget::remaining = 6;
+        queue.enqueueRange(batch.begin(), batch.end());
+        EXPECT_EQ(queue.size(), 7u);
+        EXPECT_EQ(queue.back().value, 15);
+    }
+    EXPECT_EQ(CopyBudget::alive, 0);
+}
+
+
+TEST_F(QueueUnitTest, DequeueIntoCopiesBothRunsToAnArray) {
+    Queue<int> queue;
+    for (int i = 0; i < 8; ++i)
+        queue.enqueue(i);
+    for (int i = 0; i < 5; ++i)
+        queue.dequeue();
+    for (int i = 8; i < 13; ++i)
+        queue.enqueue(i);
+
+    int values[16] = {};
+    EXPECT_EQ(queue.dequeueInto(values, 4), 4u);
+    EXPECT_EQ(queue.front(), 9);
+    EXPECT_EQ(queue.dequeueInto(values + 4, 16), 4u);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(values[i], 5 + i);
+
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.dequeueInto(values, 16), 0u);
+}
+
+
+TEST_F(QueueUnitTest, DequeueIntoConvertsToAnotherElementType) {
+    Queue<int> queue;
+    for (int i = 0; i < 5; ++i)
+        queue.enqueue(-i);
+
+    long values[5] = {};
+    EXPECT_EQ(queue.dequeueInto(values, 5), 5u);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(values[i], -i);
+}
+
+
+TEST_F(QueueUnitTest, DequeueIntoShrinksOncePerBatch) {
+    Queue<int> queue;
+    for (int i = 0; i < 1000; ++i)
+        queue.enqueue(i);
+    EXPECT_EQ(queue.capacity(), 1024u);
+
+    std::vector<int> drained;
+    EXPECT_EQ(queue.dequeueInto(std::back_inserter(drained), 990), 990u);
+    EXPECT_EQ(queue.capacity(), 32u);
+    ASSERT_EQ(queue.size(), 10u);
+    EXPECT_EQ(queue.front(), 990);
+    EXPECT_EQ(drained.back(), 989);
+}
+
+
+TEST_F(QueueUnitTest, SegmentsAndDiscardFrontConsumeInPlace) {
+    const auto shared = std::make_shared<int>(0);
+    Queue<std::shared_ptr<int>> queue;
+    for (int i = 0; i < 8; ++i)
+        queue.enqueue(shared);
+    for (int i = 0; i < 6; ++i)
+        queue.dequeue();
+    for (int i = 0; i < 4; ++i)
+        queue.enqueue(shared);
+
+    const Queue<std::shared_ptr<int>>& view = queue;
+    const auto [first, second] = view.segments();
+    EXPECT_EQ(first.size(), 2u);
+    EXPECT_EQ(second.size(), 4u);
+    EXPECT_EQ(first.data(), &queue.front());
+    EXPECT_EQ(&second.back(), &queue.back());
+
+    // The elements are destroyed in place
+    EXPECT_EQ(queue.discardFront(first.size()), 2u);
+    EXPECT_EQ(shared.use_count(), 5);
+    EXPECT_EQ(queue.segments().first.size(), 4u);
+    EXPECT_TRUE(queue.segments().second.empty());
+    EXPECT_EQ(queue.discardFront(10), 4u);
+    EXPECT_EQ(shared.use_count(), 1);
+    EXPECT_TRUE(queue.segments().first.empty());
+}
@@ -0,0 +1,298 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "BinarySearchTree.hpp"
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "MaxHeap.hpp"
+#include "MinHeap.hpp"
+#include "Queue.hpp"
+#include "Serialization.hpp"
+#include "Stack.hpp"
+
+
+using namespace data_structs;
+
+
+/// A record with a custom Serializer, so it is not stored raw.
+struct Label {
+    std::string text;
+    int weight;
+
+    bool operator==(const Label&) const = default;
+};
+
+template <>
+struct data_structs::Serializer<Label> {
+    static void write(std::ostream& out, const Label& label) {
+        Serializer<std::string>::write(out, label.text);
+        Serializer<int>::write(out, label.weight);
+    }
+
+    static Label read(std::istream& in) {
+        std::string text = Serializer<std::string>::read(in);
+        return Label{std::move(text), Serializer<int>::read(in)};
+    }
+};
+
+
+static_assert(serialization::IS_RAW<double>);
+static_assert(!serialization::IS_RAW<std::string>);
+static_assert(!serialization::IS_RAW<Label>);
+
+
+TEST(SerializationUnitTest, DynamicArrayRoundTripsRawElements) {
+    DynamicArray<std::int64_t> array;
+    for (std::int64_t i = 0; i < 1000; ++i)
+        array.addLast(i * i - 500);
+
+    std::stringstream stream;
+    array.serialize(stream);
+    EXPECT_EQ(stream.str().size(), 32 + 1000 * sizeof(std::int64_t));
+
+    const auto loaded = DynamicArray<std::int64_t>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 1000u);
+    for (std::size_t i = 0; i < loaded.size(); ++i)
+        EXPECT_EQ(loaded[i], array[i]);
+}
+
+
+TEST(SerializationUnitTest, DynamicArrayRoundTripsStrings) {
+    DynamicArray<std::string> array;
+    array.addLast("");
+    array.addLast("alpha");
+    array.addLast(std::string(300, 'x'));
+
+    std::stringstream stream;
+    array.serialize(stream);
+    const auto loaded = DynamicArray<std::string>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 3u);
+    EXPECT_EQ(loaded[0], "");
+    EXPECT_EQ(loaded[1], "alpha");
+    EXPECT_EQ(loaded[2], std::string(300, 'x'));
+}
+
+
+TEST(SerializationUnitTest, StackKeepsItsOrder) {
+    Stack<Label> stack;
+    stack.push(Label{"bottom", 1});
+    stack.push(Label{"top", 2});
+
+    std::stringstream stream;
+    stack.serialize(stream);
+    auto loaded = Stack<Label>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded.pop(), (Label{"top", 2}));
+    EXPECT_EQ(loaded.pop(), (Label{"bottom", 1}));
+}
+
+
+TEST(SerializationUnitTest, WrappedQueueIsWrittenFrontToBack) {
+    Queue<int> queue;
+    for (int i = 0; i < 8; ++i)
+        queue.enqueue(i);
+    for (int i = 0; i < 5; ++i)
+        queue.dequeue();
+    for (int i = 8; i < 12; ++i)
+        queue.enqueue(i);
+
+    std::stringstream stream;
+    queue.serialize(stream);
+    auto loaded = Queue<int>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 7u);
+    for (int i = 5; i < 12; ++i)
+        EXPECT_EQ(loaded.dequeue(), i);
+
+    // The loaded queue keeps working as a ring
+    loaded.enqueue(42);
+    EXPECT_EQ(loaded.front(), 42);
+}
+
+
+TEST(SerializationUnitTest, LinkedListRoundTrips) {
+    LinkedList<std::string> list;
+    list.addLast("b");
+    list.addFirst("a");
+    list.addLast("c");
+
+    std::stringstream stream;
+    list.serialize(stream);
+    const auto loaded = LinkedList<std::string>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 3u);
+    EXPECT_EQ(loaded.get(0), "a");
+    EXPECT_EQ(loaded.get(2), "c");
+}
+
+
+TEST(SerializationUnitTest, BinaryTreeKeepsItsShape) {
+    BinaryTree<int> tree;
+    tree.insert(1);
+    tree.insertLeft(2);
+    tree.insertLeft(3);
+    tree.insertRight(4);
+    tree.insertRight(5);
+
+    std::stringstream stream;
+    tree.serialize(stream);
+    const auto loaded = BinaryTree<int>::deserialize(stream);
+    ASSERT_EQ(loaded.size(), 5u);
+    const Node<int>* root = loaded.getRoot();
+    EXPECT_EQ(root->data, 1);
+    EXPECT_EQ(root->left->left->data, 3);
+    EXPECT_EQ(root->left->left->parent, root->left);
+    EXPECT_EQ(root->right->right->data, 5);
+    EXPECT_EQ(root->right->left, nullptr);
+    EXPECT_EQ(loaded.getHeight(), tree.getHeight());
+}
+
+
+TEST(SerializationUnitTest, BinarySearchTreeRestoresTheSameTree) {
+    BinarySearchTree<int> tree;
+    for (const int value : {50, 30, 70, 20, 40, 60, 80, 35, 45, 65})
+        tree.insert(value);
+
+    std::stringstream stream;
+    tree.serialize(stream);
+    const std::string image = stream.str();
+
+    const auto loaded = BinarySearchTree<int>::deserialize(stream);
+    EXPECT_TRUE(loaded.isValidBST());
+    EXPECT_EQ(loaded.size(), tree.size());
+    EXPECT_EQ(loaded.getHeight(), tree.getHeight());
+    EXPECT_EQ(loaded.findMinimum(), 20);
+    EXPECT_TRUE(loaded.contains(45));
+
+    std::stringstream again;
+    loaded.serialize(again);
+    EXPECT_EQ(again.str(), image);
+}
+
+
+TEST(SerializationUnitTest, DegenerateTreeDoesNotRecurse) {
+    BinarySearchTree<int> tree;
+    for (int i = 0; i < 2000; ++i)
+        tree.insert(i);
+
+    std::stringstream stream;
+    tree.serialize(stream);
+    const auto loaded = BinarySearchTree<int>::deserialize(stream);
+    EXPECT_EQ(loaded.size(), 2000u);
+    EXPECT_EQ(loaded.findMaximum(), 1999);
+}
+
+
+TEST(SerializationUnitTest, HeapsLoadWithoutReheapifying) {
+    MinHeap<int> min_heap;
+    MaxHeap<int> max_heap;
+    for (const int value : {9, 4, 7, 1, 8, 2, 6, 3, 5}) {
+        min_heap.insert(value);
+        max_heap.insert(value);
+    }
+
+    std::stringstream min_stream;
+    std::stringstream max_stream;
+    min_heap.serialize(min_stream);
+    max_heap.serialize(max_stream);
+
+    auto loaded_min = MinHeap<int>::deserialize(min_stream);
+    auto loaded_max = MaxHeap<int>::deserialize(max_stream);
+    EXPECT_TRUE(loaded_min.isCompleteTree());
+    EXPECT_EQ(loaded_min.getRoot()->data, min_heap.getRoot()->data);
+    EXPECT_EQ(loaded_min.getRoot()->left->data, min_heap.getRoot()->left->data);
+    for (int expected = 1; expected <= 9; ++expected)
+        EXPECT_EQ(loaded_min.extractRoot(), expected);
+    EXPECT_EQ(loaded_max.extractRoot(), 9);
+    EXPECT_EQ(loaded_max.size(), 8u);
+}
+
+
+TEST(SerializationUnitTest, RejectsMismatchedAndCorruptData) {
+    DynamicArray<int> array;
+    array.addLast(1);
+    array.addLast(2);
+    std::stringstream stream;
+    array.serialize(stream);
+    const std::string image = stream.str();
+
+    // Another container kind or element type
+    std::istringstream as_stack(image);
+    EXPECT_THROW(Stack<int>::deserialize(as_stack), std::runtime_error);
+    std::istringstream as_long(image);
+    EXPECT_THROW(DynamicArray<long long>::deserialize(as_long),
+                 std::runtime_error);
+
+    // Truncated payload and garbage
+    std::istringstream truncated(image.substr(0, image.size() - 1));
+    EXPECT_THROW(DynamicArray<int>::deserialize(truncated),
+                 std::runtime_error);
+    std::istringstream garbage(std::string(64, 'z'));
+    EXPECT_THROW(DynamicArray<int>::deserialize(garbage), std::runtime_error);
+
+    // A search tree whose order was tampered with
+    BinarySearchTree<int> tree;
+    tree.insert(2);
+    tree.insert(1);
+    std::stringstream tree_stream;
+    tree.serialize(tree_stream);
+    std::string tampered = tree_stream.str();
+    // The records are {flags, 2} then {flags, 1}; swap the values
+    tampered[32 + 1] = 1;
+    tampered[32 + 1 + sizeof(int) + 1] = 2;
+    std::istringstream tampered_stream(tampered);
+    EXPECT_THROW(BinarySearchTree<int>::deserialize(tampered_stream),
+                 std::runtime_error);
+}
+
+
+TEST(SerializationUnitTest, ImageViewsArraysWithoutCopying) {
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "serialized_image_test.bin";
+
+    DynamicArray<double> array;
+    for (int i = 0; i < 10'000; ++i)
+        array.addLast(i * 0.5);
+    MinHeap<int> heap;
+    heap.insert(3);
+    heap.insert(1);
+    {
+        std::ofstream file(path, std::ios::binary);
+        array.serialize(file);
+    }
+
+    {
+        const SerializedImage image = SerializedImage::open(path);
+        const auto elements =
+            image.elements<double>(SerializedKind::DYNAMIC_ARRAY);
+        ASSERT_EQ(elements.size(), 10'000u);
+        EXPECT_EQ(elements[9'999], 4999.5);
+        EXPECT_EQ(static_cast<const void*>(elements.data()),
+                  static_cast<const void*>(image.bytes().data() + 32));
+
+        EXPECT_THROW((void)image.elements<double>(SerializedKind::QUEUE),
+                     std::runtime_error);
+        EXPECT_THROW((void)image.elements<double>(SerializedKind::MIN_HEAP),
+                     std::invalid_argument);
+
+        auto stream = image.stream();
+        const auto loaded = DynamicArray<double>::deserialize(stream);
+        EXPECT_EQ(loaded.size(), 10'000u);
+    }
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        heap.serialize(file);
+    }
+    SerializedImage image = SerializedImage::open(path);
+    SerializedImage moved(std::move(image));
+    EXPECT_TRUE(image.bytes().empty());
+    auto stream = moved.stream();
+    EXPECT_EQ(MinHeap<int>::deserialize(stream).peekRoot(), 1);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(SerializedImage::open(path), std::system_error);
+}
@@ -0,0 +1,242 @@
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SimdKernels.hpp"
+
+
+namespace simd = data_structs::simd;
+using simd::Isa;
+
+
+class SimdKernelsUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // Below, at and around multiples of the block size and the reduction
+    // lane counts, so both the partial last block and the tails are hit
+    static constexpr std::size_t SIZES[] = {0,   1,   7,   63,  64,  65,
+                                            127, 128, 129, 255, 256, 257,
+                                            300, 511, 512, 1000, 4099};
+
+
+    /// Every instruction set this CPU can run.
+    static std::vector<Isa> runnableIsas() {
+        std::vector<Isa> isas;
+        for (int level = 0; level <= static_cast<int>(simd::supportedIsa());
+             ++level)
+            isas.push_back(static_cast<Isa>(level));
+        return isas;
+    }
+
+
+    /// Values drawn from a small set, so every array has repeated matches.
+    template <typename Type>
+    static std::vector<Type> makeValues(const std::size_t size,
+                                        const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> pick(0, 9);
+        std::vector<Type> values(size);
+        for (Type& value : values)
+            value = static_cast<Type>(pick(generator) - 3);
+        return values;
+    }
+
+
+    /// Compares findFirst, count and findAll with a plain loop for every
+    /// size, instruction set and needle.
+    template <typename Type>
+    static void expectSearchesMatchLoop() {
+        for (const std::size_t size : SIZES) {
+            const std::vector<Type> values =
+                makeValues<Type>(size, static_cast<unsigned>(size));
+            for (const Isa isa : runnableIsas()) {
+                for (int n = -4; n <= 7; ++n) {
+                    const auto needle = static_cast<Type>(n);
+                    SCOPED_TRACE("n=" + std::to_string(size) + " isa=" +
+                                 std::to_string(static_cast<int>(isa)) +
+                                 " needle=" + std::to_string(n));
+
+                    std::vector<std::size_t> expected;
+                    for (std::size_t i = 0; i < size; ++i)
+                        if (values[i] == needle)
+                            expected.push_back(i);
+
+                    const std::size_t first =
+                        expected.empty() ? size : expected.front();
+                    EXPECT_EQ(simd::findFirst(values.data(), size, needle,
+                                              isa),
+                              first);
+                    EXPECT_EQ(simd::count(values.data(), size, needle, isa),
+                              expected.size());
+
+                    std::vector<std::size_t> found;
+                    simd::findAll(
+                        values.data(), size, needle,
+                        [&found](const std::size_t i) { found.push_back(i); },
+                        isa);
+                    EXPECT_EQ(found, expected);
+                }
+            }
+        }
+    }
+
+
+    /// Compares minimum, maximum and sum with a plain loop for every size
+    /// and instruction set.
+    template <typename Type>
+    static void expectReductionsMatchLoop() {
+        for (const std::size_t size : SIZES) {
+            const std::vector<Type> values =
+                makeValues<Type>(size, static_cast<unsigned>(size) + 1);
+            for (const Isa isa : runnableIsas()) {
+                SCOPED_TRACE("n=" + std::to_string(size) + " isa=" +
+                             std::to_string(static_cast<int>(isa)));
+
+                Type total{};
+                for (const Type value : values)
+                    total = static_cast<Type>(total + value);
+                EXPECT_EQ(simd::sum(values.data(), size, isa), total);
+
+                if (size == 0)
+                    continue;
+                Type smallest = values[0];
+                Type largest = values[0];
+                for (const Type value : values) {
+                    smallest = value < smallest ? value : smallest;
+                    largest = largest < value ? value : largest;
+                }
+                EXPECT_EQ(simd::minimum(values.data(), size, isa), smallest);
+                EXPECT_EQ(simd::maximum(values.data(), size, isa), largest);
+            }
+        }
+    }
+};
+
+
+TEST_F(SimdKernelsUnitTest, VectorizableTypes) {
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<std::int8_t>);
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<std::uint16_t>);
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<int>);
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<std::uint64_t>);
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<float>);
+    EXPECT_TRUE(simd::IS_VECTORIZABLE<double>);
+    EXPECT_FALSE(simd::IS_VECTORIZABLE<bool>);
+    EXPECT_FALSE(simd::IS_VECTORIZABLE<long double>);
+    EXPECT_FALSE(simd::IS_VECTORIZABLE<std::string>);
+}
+
+
+TEST_F(SimdKernelsUnitTest, SearchesMatchLoopForEveryElementSize) {
+    expectSearchesMatchLoop<std::int8_t>();
+    expectSearchesMatchLoop<std::uint8_t>();
+    expectSearchesMatchLoop<std::int16_t>();
+    expectSearchesMatchLoop<std::uint16_t>();
+    expectSearchesMatchLoop<std::int32_t>();
+    expectSearchesMatchLoop<std::uint32_t>();
+    expectSearchesMatchLoop<std::int64_t>();
+    expectSearchesMatchLoop<std::uint64_t>();
+    expectSearchesMatchLoop<float>();
+    expectSearchesMatchLoop<double>();
+}
+
+
+TEST_F(SimdKernelsUnitTest, ReductionsMatchLoopForEveryElementSize) {
+    expectReductionsMatchLoop<std::int8_t>();
+    expectReductionsMatchLoop<std::uint8_t>();
+    expectReductionsMatchLoop<std::int16_t>();
+    expectReductionsMatchLoop<std::uint16_t>();
+    expectReductionsMatchLoop<std::int32_t>();
+    expectReductionsMatchLoop<std::uint32_t>();
+    expectReductionsMatchLoop<std::int64_t>();
+    expectReductionsMatchLoop<std::uint64_t>();
+    // Small integers: every partial sum is exact, whatever the order
+    expectReductionsMatchLoop<float>();
+    expectReductionsMatchLoop<double>();
+}
+
+
+TEST_F(SimdKernelsUnitTest, SixtyFourBitCompareNeedsBothHalves) {
+    // Equal low halves, different high halves, and vice versa
+    std::vector<std::uint64_t> values(200, 0x1'0000'0005ULL);
+    values[150] = 0x2'0000'0005ULL;
+    values[170] = 0x1'0000'0006ULL;
+
+    for (const Isa isa : runnableIsas()) {
+        EXPECT_EQ(simd::findFirst(values.data(), values.size(),
+                                  std::uint64_t{0x2'0000'0005ULL}, isa),
+                  150u);
+        EXPECT_EQ(simd::count(values.data(), values.size(),
+                              std::uint64_t{0x1'0000'0005ULL}, isa),
+                  198u);
+        EXPECT_EQ(simd::count(values.data(), values.size(),
+                              std::uint64_t{0x0'0000'0005ULL}, isa),
+                  0u);
+    }
+}
+
+
+TEST_F(SimdKernelsUnitTest, FloatingPointUsesEqualitySemantics) {
+    std::vector<double> values(300, 1.0);
+    values[10] = std::numeric_limits<double>::quiet_NaN();
+    values[100] = -0.0;
+    values[299] = 0.0;
+
+    for (const Isa isa : runnableIsas()) {
+        // NaN never compares equal, not even to itself
+        EXPECT_EQ(simd::findFirst(values.data(), values.size(),
+                                  std::numeric_limits<double>::quiet_NaN(),
+                                  isa),
+                  values.size());
+        // -0.0 == 0.0
+        EXPECT_EQ(simd::findFirst(values.data(), values.size(), 0.0, isa),
+                  100u);
+        EXPECT_EQ(simd::count(values.data(), values.size(), -0.0, isa), 2u);
+    }
+}
+
+
+TEST_F(SimdKernelsUnitTest, IntegerSumWrapsAround) {
+    const std::vector<std::int8_t> values(1000, 100);
+    const auto expected = static_cast<std::int8_t>(100 * 1000 % 256);
+    for (const Isa isa : runnableIsas())
+        EXPECT_EQ(simd::sum(values.data(), values.size(), isa), expected);
+}
+
+
+TEST_F(SimdKernelsUnitTest, FloatingPointSumIsTheSameForEveryIsa) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> pick(-1.0f, 1.0f);
+    std::vector<float> values(10007);
+    for (float& value : values)
+        value = pick(generator);
+
+    const float reference =
+        simd::sum(values.data(), values.size(), Isa::SCALAR);
+    double exact = 0.0;
+    for (const float value : values)
+        exact += value;
+
+    EXPECT_NEAR(reference, exact, 1e-2);
+    for (const Isa isa : runnableIsas())
+        EXPECT_EQ(simd::sum(values.data(), values.size(), isa), reference);
+}
+
+
+TEST_F(SimdKernelsUnitTest, ExtremesAtEitherEnd) {
+    std::vector<std::int32_t> values(777, 0);
+    values.front() = std::numeric_limits<std::int32_t>::min();
+    values.back() = std::numeric_limits<std::int32_t>::max();
+
+    for (const Isa isa : runnableIsas()) {
+        EXPECT_EQ(simd::minimum(values.data(), values.size(), isa),
+                  std::numeric_limits<std::int32_t>::min());
+        EXPECT_EQ(simd::maximum(values.data(), values.size(), isa),
+                  std::numeric_limits<std::int32_t>::max());
+    }
+}
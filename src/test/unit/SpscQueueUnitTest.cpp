@@ -0,0 +1,183 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CountingAllocator.hpp"
+#include "SpscQueue.hpp"
+
+
+using data_structs::SpscQueue;
+
+
+TEST(SpscQueueUnitTest, CapacityIsRoundedToAPowerOfTwo) {
+    EXPECT_EQ(SpscQueue<int>(0).capacity(), 1u);
+    EXPECT_EQ(SpscQueue<int>(5).capacity(), 8u);
+    EXPECT_EQ(SpscQueue<int>(64).capacity(), 64u);
+    EXPECT_THROW(SpscQueue<int>(SIZE_MAX), std::length_error);
+}
+
+
+TEST(SpscQueueUnitTest, FillsUpAndDrainsInOrder) {
+    SpscQueue<int> queue(4);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.front(), nullptr);
+    EXPECT_FALSE(queue.tryDequeue().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.tryEnqueue(i));
+    EXPECT_FALSE(queue.tryEnqueue(4));
+    EXPECT_EQ(queue.size(), 4u);
+
+    // Wrap around the ring many times
+    for (int i = 4; i < 1000; ++i) {
+        ASSERT_EQ(*queue.front(), i - 4);
+        ASSERT_EQ(queue.tryDequeue(), i - 4);
+        ASSERT_TRUE(queue.tryEnqueue(i));
+    }
+    for (int i = 996; i < 1000; ++i)
+        EXPECT_EQ(queue.tryDequeue(), i);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST(SpscQueueUnitTest, BatchesStopAtTheEdges) {
+    SpscQueue<std::string> queue(8);
+    std::vector<std::string> input;
+    for (int i = 0; i < 12; ++i)
+        input.push_back(std::to_string(i));
+
+    EXPECT_EQ(queue.tryEnqueueN(input.begin(), 5), 5u);
+    std::vector<std::string> output;
+    EXPECT_EQ(queue.tryDequeueN(std::back_inserter(output), 3), 3u);
+
+    // Only 6 slots are free; the batch wraps around the end of the buffer
+    EXPECT_EQ(queue.tryEnqueueN(std::make_move_iterator(input.begin() + 5), 7),
+              6u);
+    EXPECT_EQ(input[5], "");
+    EXPECT_EQ(input[11], "11");
+    EXPECT_EQ(queue.size(), 8u);
+
+    EXPECT_EQ(queue.tryDequeueN(std::back_inserter(output), 100), 8u);
+    ASSERT_EQ(output.size(), 11u);
+    for (int i = 0; i < 11; ++i)
+        EXPECT_EQ(output[i], std::to_string(i));
+    EXPECT_EQ(queue.tryDequeueN(std::back_inserter(output), 1), 0u);
+}
+
+
+/// Cannot be built from a negative number.
+struct NonNegative {
+    int value;
+
+    explicit NonNegative(const int v) : value(v) {
+        if (v < 0)
+            throw std::invalid_argument("negative");
+    }
+};
+
+
+TEST(SpscQueueUnitTest, FailedConstructionPublishesNothing) {
+    SpscQueue<NonNegative> queue(8);
+    EXPECT_TRUE(queue.tryEmplace(1));
+    EXPECT_THROW(queue.tryEmplace(-1), std::invalid_argument);
+    EXPECT_EQ(queue.size(), 1u);
+
+    // A batch keeps the elements built before the failure
+    const int values[] = {2, 3, -4, 5};
+    EXPECT_THROW(queue.tryEnqueueN(values, 4), std::invalid_argument);
+    ASSERT_EQ(queue.size(), 3u);
+    for (int expected = 1; expected <= 3; ++expected)
+        EXPECT_EQ(queue.tryDequeue()->value, expected);
+    EXPECT_TRUE(queue.tryEmplace(6));
+}
+
+
+TEST(SpscQueueUnitTest, DestroysLeftoversWithTheAllocator) {
+    AllocationStats stats;
+    const auto shared = std::make_shared<int>(1);
+    {
+        using Element = std::shared_ptr<int>;
+        SpscQueue<Element, CountingAllocator<Element>> queue(
+            16, CountingAllocator<Element>(stats));
+        for (int i = 0; i < 10; ++i)
+            queue.tryEnqueue(shared);
+        queue.tryDequeue();
+        EXPECT_EQ(shared.use_count(), 10);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+}
+
+
+TEST(SpscQueueUnitTest, TransfersBetweenTwoThreadsInOrder) {
+    constexpr std::uint64_t COUNT = 1'000'000;
+    SpscQueue<std::uint64_t> queue(1024);
+
+    std::thread producer([&queue] {
+        for (std::uint64_t i = 0; i < COUNT; ++i)
+            while (!queue.tryEnqueue(i))
+                std::this_thread::yield();
+    });
+
+    std::uint64_t expected = 0;
+    bool in_order = true;
+    while (expected < COUNT) {
+        if (const auto value = queue.tryDequeue()) {
+            in_order = in_order && *value == expected;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST(SpscQueueUnitTest, TransfersBatchesOfOwningElements) {
+    constexpr std::size_t COUNT = 200'000;
+    constexpr std::size_t BATCH = 37;
+    SpscQueue<std::unique_ptr<std::size_t>> queue(256);
+
+    std::thread producer([&queue] {
+        std::vector<std::unique_ptr<std::size_t>> batch;
+        std::size_t next = 0;
+        while (next < COUNT) {
+            batch.clear();
+            for (std::size_t i = 0; i < BATCH && next + i < COUNT; ++i)
+                batch.push_back(std::make_unique<std::size_t>(next + i));
+
+            auto first = std::make_move_iterator(batch.begin());
+            std::size_t sent = 0;
+            while (sent < batch.size()) {
+                const std::size_t done = queue.tryEnqueueN(
+                    first + static_cast<std::ptrdiff_t>(sent),
+                    batch.size() - sent);
+                if (done == 0)
+                    std::this_thread::yield();
+                sent += done;
+            }
+            next += batch.size();
+        }
+    });
+
+    std::vector<std::unique_ptr<std::size_t>> received;
+    received.reserve(COUNT);
+    while (received.size() < COUNT)
+        if (queue.tryDequeueN(std::back_inserter(received), BATCH) == 0)
+            std::this_thread::yield();
+    producer.join();
+
+    bool in_order = true;
+    for (std::size_t i = 0; i < COUNT; ++i)
+        in_order = in_order && *received[i] == i;
+    EXPECT_TRUE(in_order);
+}
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <iostream>
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 
+#include "CountingAllocator.hpp"
 #include "Stack.hpp"
 #include "ThrowingType.hpp"
 
@@ -543,3 +545,47 @@ TEST_F(StackUnitTest, EmplaceConstructsInPlace) {
     EXPECT_EQ(stack.top().x, 3);
     EXPECT_EQ(stack.top().y, 4);
 }
+
+
+TEST_F(StackUnitTest, StorageComesFromTheAllocator) {
+    AllocationStats stats;
+    {
+        Stack<int, CountingAllocator<int>> stack(64,
+                                                 CountingAllocator<int>(stats));
+        for (int i = 0; i < 64; ++i)
+            stack.push(i);
+        EXPECT_EQ(stats.bytes_in_use, 64 * sizeof(int));
+        EXPECT_EQ(stack.pop(), 63);
+    }
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::monotonic_buffer_resource arena;
+    data_structs::pmr::Stack<std::string> stack{&arena};
+    stack.emplace("bottom");
+    stack.push("top");
+    EXPECT_EQ(stack.getAllocator().resource(), &arena);
+    EXPECT_EQ(stack.top(), "top");
+}
+
+
+struct NoShrinkPolicy : data_structs::DefaultGrowthPolicy {
+    static constexpr bool SHRINKS = false;
+};
+
+
+TEST_F(StackUnitTest, GrowthPolicyWithoutShrinking) {
+    AllocationStats stats;
+    Stack<int, CountingAllocator<int>, NoShrinkPolicy> stack{
+        CountingAllocator<int>(stats)};
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            stack.push(i);
+        while (!stack.isEmpty())
+            stack.pop();
+    }
+
+    // Only the first round grows the buffer; later rounds reuse it
+    EXPECT_EQ(stats.allocations, 9u);
+    EXPECT_EQ(stats.bytes_in_use, 1280 * sizeof(int));
+}
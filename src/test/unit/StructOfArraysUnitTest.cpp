@@ -0,0 +1,282 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "CountingAllocator.hpp"
+#include "DynamicArrayAlgorithms.hpp"
+#include "StructOfArrays.hpp"
+
+
+using data_structs::StructOfArrays;
+
+
+/// Field whose copy constructor throws on demand, and whose move constructor
+/// may throw (so that permute has to copy it).
+struct FragileField {
+    static inline bool should_throw = false;
+    int value;
+
+    explicit FragileField(const int v) : value(v) {}
+
+    FragileField(const FragileField& other) : value(other.value) {
+        if (should_throw)
+            throw std::runtime_error("copy failed");
+    }
+
+    FragileField(FragileField&& other) : value(other.value) {}
+
+    FragileField& operator=(const FragileField&) = default;
+    FragileField& operator=(FragileField&&) = default;
+};
+
+
+class StructOfArraysUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override { FragileField::should_throw = false; }
+
+    using Table = StructOfArrays<std::tuple<int, double, std::string>>;
+
+    /// Rows (i, i / 2.0, "row i") for i in [0, size).
+    static Table makeTable(const int size) {
+        Table table;
+        for (int i = 0; i < size; ++i)
+            table.addLast(i, i / 2.0, "row " + std::to_string(i));
+        return table;
+    }
+};
+
+
+TEST_F(StructOfArraysUnitTest, DefaultConstructedIsEmpty) {
+    const Table table;
+    EXPECT_TRUE(table.isEmpty());
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table.column<0>().size(), 0u);
+    EXPECT_EQ(table.begin(), table.end());
+}
+
+
+TEST_F(StructOfArraysUnitTest, AddLastFillsEveryColumn) {
+    Table table = makeTable(100);
+    ASSERT_EQ(table.size(), 100u);
+    EXPECT_GE(table.capacity(), 100u);
+
+    const std::span<const int> ids = std::as_const(table).column<0>();
+    const std::span<const double> halves = std::as_const(table).column<1>();
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ids[i], i);
+        EXPECT_EQ(halves[i], i / 2.0);
+    }
+    EXPECT_EQ(table.column<2>()[42], "row 42");
+}
+
+
+TEST_F(StructOfArraysUnitTest, ProxyRowsReadAndWriteTheColumns) {
+    Table table = makeTable(5);
+
+    auto [id, half, name] = table.get(3);
+    EXPECT_EQ(id, 3);
+    EXPECT_EQ(name, "row 3");
+
+    id = 30;
+    half = -1.0;
+    std::get<2>(table.get(4)) = "changed";
+    EXPECT_EQ(table.column<0>()[3], 30);
+    EXPECT_EQ(table.column<1>()[3], -1.0);
+    EXPECT_EQ(table.column<2>()[4], "changed");
+
+    const Table& view = table;
+    EXPECT_EQ(std::get<0>(view.get(3)), 30);
+    EXPECT_THROW(table.get(5), std::out_of_range);
+    EXPECT_THROW(view.get(5), std::out_of_range);
+}
+
+
+TEST_F(StructOfArraysUnitTest, IterationVisitsRowsInOrder) {
+    Table table = makeTable(10);
+
+    int expected = 0;
+    for (auto [id, half, name] : table) {
+        EXPECT_EQ(id, expected);
+        half = 0.0;
+        ++expected;
+    }
+    EXPECT_EQ(expected, 10);
+    EXPECT_EQ(table.column<1>()[7], 0.0);
+
+    int sum = 0;
+    for (const auto& row : std::as_const(table))
+        sum += std::get<0>(row);
+    EXPECT_EQ(sum, 45);
+}
+
+
+TEST_F(StructOfArraysUnitTest, RemoveLastReturnsTheRow) {
+    Table table = makeTable(3);
+
+    const auto [id, half, name] = table.removeLast();
+    EXPECT_EQ(id, 2);
+    EXPECT_EQ(half, 1.0);
+    EXPECT_EQ(name, "row 2");
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.column<2>().size(), 2u);
+
+    table.removeAll();
+    EXPECT_TRUE(table.isEmpty());
+    EXPECT_THROW(table.removeLast(), std::out_of_range);
+}
+
+
+TEST_F(StructOfArraysUnitTest, FailedRemoveLastLeavesTheRow) {
+    StructOfArrays<std::tuple<std::string, FragileField>> table;
+    table.addLast("first", FragileField(1));
+    table.addLast("second", FragileField(2));
+
+    // The string could be moved without throwing, but must not be before
+    // the copy of the other field succeeds
+    FragileField::should_throw = true;
+    EXPECT_THROW(table.removeLast(), std::runtime_error);
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.column<0>()[1], "second");
+    EXPECT_EQ(table.column<1>()[1].value, 2);
+
+    FragileField::should_throw = false;
+    const auto [name, field] = table.removeLast();
+    EXPECT_EQ(name, "second");
+    EXPECT_EQ(field.value, 2);
+    EXPECT_EQ(table.size(), 1u);
+}
+
+
+TEST_F(StructOfArraysUnitTest, FailedAppendLeavesColumnsAligned) {
+    StructOfArrays<std::tuple<int, FragileField>> table;
+    const FragileField field(1);
+    table.addLast(1, field);
+
+    FragileField::should_throw = true;
+    EXPECT_THROW(table.addLast(2, field), std::runtime_error);
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.column<0>().size(), 1u);
+    EXPECT_EQ(table.column<1>().size(), 1u);
+
+    FragileField::should_throw = false;
+    table.addLast(3, field);
+    EXPECT_EQ(table.column<0>()[1], 3);
+}
+
+
+TEST_F(StructOfArraysUnitTest, PermuteReordersEveryColumn) {
+    Table table = makeTable(4);
+    const std::size_t order[] = {2, 0, 3, 1};
+    table.permute(order);
+
+    EXPECT_EQ(table.column<0>()[0], 2);
+    EXPECT_EQ(table.column<1>()[2], 1.5);
+    EXPECT_EQ(table.column<2>()[3], "row 1");
+
+    const std::size_t short_order[] = {0, 1};
+    EXPECT_THROW(table.permute(short_order), std::invalid_argument);
+}
+
+
+TEST_F(StructOfArraysUnitTest, FailedPermuteLeavesTableUnchanged) {
+    StructOfArrays<std::tuple<std::string, FragileField>> table;
+    for (int i = 0; i < 4; ++i)
+        table.addLast("row " + std::to_string(i), FragileField(i));
+
+    FragileField::should_throw = true;
+    const std::size_t order[] = {3, 2, 1, 0};
+    EXPECT_THROW(table.permute(order), std::runtime_error);
+
+    // The strings (moved without throwing) were not touched yet
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(table.column<0>()[i], "row " + std::to_string(i));
+        EXPECT_EQ(table.column<1>()[i].value, i);
+    }
+}
+
+
+TEST_F(StructOfArraysUnitTest, SortByColumnKeepsRowsTogether) {
+    Table table;
+    const int keys[] = {5, 3, 9, 3, 1, 5, 0};
+    for (int i = 0; i < 7; ++i)
+        table.addLast(keys[i], static_cast<double>(i), std::to_string(i));
+
+    algo::SortByColumn<0>(table);
+
+    const int sorted[] = {0, 1, 3, 3, 5, 5, 9};
+    const double rows[] = {6, 4, 1, 3, 0, 5, 2};
+    for (std::size_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(table.column<0>()[i], sorted[i]);
+        // Equal keys keep their order, and the rows stay intact
+        EXPECT_EQ(table.column<1>()[i], rows[i]);
+        EXPECT_EQ(table.column<2>()[i],
+                  std::to_string(static_cast<int>(rows[i])));
+    }
+}
+
+
+TEST_F(StructOfArraysUnitTest, SortByColumnWithAnySort) {
+    Table table = makeTable(200);
+    for (auto [id, half, name] : table)
+        half = -half;
+
+    algo::SortByColumn<1>(table,
+                          [](const auto keys) { algo::HeapSort(keys); });
+    for (std::size_t i = 0; i < 200; ++i)
+        EXPECT_EQ(table.column<0>()[i], 199 - static_cast<int>(i));
+
+    // Keys that are not trivially copyable are compared in place
+    algo::SortByColumn<2>(table,
+                          [](const auto keys) { algo::MergeSort(keys); });
+    EXPECT_EQ(table.column<2>()[0], "row 0");
+    EXPECT_EQ(table.column<2>()[1], "row 1");
+    EXPECT_EQ(table.column<2>()[2], "row 10");
+    EXPECT_EQ(table.column<0>()[2], 10);
+}
+
+
+TEST_F(StructOfArraysUnitTest, CopyAndMove) {
+    Table original = makeTable(20);
+
+    Table copy(original);
+    std::get<0>(copy.get(0)) = -1;
+    EXPECT_EQ(original.column<0>()[0], 0);
+
+    Table moved(std::move(original));
+    EXPECT_TRUE(original.isEmpty());
+    EXPECT_EQ(moved.size(), 20u);
+
+    Table assigned = makeTable(3);
+    assigned = copy;
+    EXPECT_EQ(assigned.size(), 20u);
+    EXPECT_EQ(assigned.column<0>()[0], -1);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.column<0>()[0], 0);
+}
+
+
+TEST_F(StructOfArraysUnitTest, ColumnsComeFromTheAllocator) {
+    AllocationStats stats;
+    {
+        using CountingTable = StructOfArrays<std::tuple<int, double>,
+                                             CountingAllocator<std::byte>>;
+        CountingTable table{CountingAllocator<std::byte>(stats)};
+        for (int i = 0; i < 10; ++i)
+            table.addLast(i, 1.0);
+        EXPECT_GT(stats.allocations, 2u);
+        EXPECT_EQ(stats.bytes_in_use,
+                  table.capacity() * (sizeof(int) + sizeof(double)));
+    }
+    EXPECT_EQ(stats.bytes_in_use, 0u);
+
+    std::pmr::monotonic_buffer_resource arena;
+    data_structs::pmr::StructOfArrays<std::tuple<int, std::pmr::string>>
+        table{&arena};
+    table.addLast(1, "one");
+    EXPECT_EQ(table.getAllocator().resource(), &arena);
+}
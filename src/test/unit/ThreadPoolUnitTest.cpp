@@ -0,0 +1,127 @@
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+
+using algo::ThreadPool;
+
+
+class ThreadPoolUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+
+    /// Recursive fork-join sum of [begin, end), forking down to single
+    /// elements to stress nested waits.
+    static long forkJoinSum(ThreadPool& pool, const long begin,
+                            const long end) {
+        if (end - begin == 1)
+            return begin;
+
+        const long mid = begin + (end - begin) / 2;
+        long left = 0;
+        long right = 0;
+        pool.parallelInvoke([&] { left = forkJoinSum(pool, begin, mid); },
+                            [&] { right = forkJoinSum(pool, mid, end); });
+        return left + right;
+    }
+};
+
+
+TEST_F(ThreadPoolUnitTest, ReportsWorkerCount) {
+    const ThreadPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+}
+
+
+TEST_F(ThreadPoolUnitTest, SubmitReturnsResult) {
+    ThreadPool pool(2);
+    auto answer = pool.submit([] { return 42; });
+    auto text = pool.submit([] { return std::string("done"); });
+
+    EXPECT_EQ(answer.get(), 42);
+    EXPECT_EQ(text.get(), "done");
+}
+
+
+TEST_F(ThreadPoolUnitTest, SubmitStoresException) {
+    ThreadPool pool(1);
+    auto result = pool.submit([]() -> int {
+        throw std::runtime_error("task failed");
+    });
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+
+TEST_F(ThreadPoolUnitTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i)
+            (void)pool.submit([&counter] { ++counter; });
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+
+TEST_F(ThreadPoolUnitTest, NestedParallelInvokeDoesNotDeadlock) {
+    for (const std::size_t workers : {0u, 1u, 4u}) {
+        SCOPED_TRACE("workers=" + std::to_string(workers));
+        ThreadPool pool(workers);
+        EXPECT_EQ(forkJoinSum(pool, 0, 10000), 10000L * 9999 / 2);
+    }
+}
+
+
+TEST_F(ThreadPoolUnitTest, ParallelInvokeUsesOtherThreads) {
+    ThreadPool pool(4);
+    std::vector<std::thread::id> ids(64);
+
+    pool.parallelFor(ids.size(), [&](const std::size_t i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ids[i] = std::this_thread::get_id();
+    });
+
+    bool helped = false;
+    for (const std::thread::id id : ids)
+        helped = helped || id != std::this_thread::get_id();
+    EXPECT_TRUE(helped);
+}
+
+
+TEST_F(ThreadPoolUnitTest, ParallelInvokeRethrowsAfterBothFinish) {
+    ThreadPool pool(2);
+    std::atomic<bool> second_ran{false};
+
+    EXPECT_THROW(pool.parallelInvoke(
+                     [] { throw std::logic_error("first failed"); },
+                     [&] { second_ran = true; }),
+                 std::logic_error);
+    EXPECT_TRUE(second_ran.load());
+
+    EXPECT_THROW(
+        pool.parallelInvoke([] {},
+                            [] { throw std::out_of_range("second failed"); }),
+        std::out_of_range);
+}
+
+
+TEST_F(ThreadPoolUnitTest, ParallelForVisitsEveryIndexOnce) {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> visits(1000);
+
+    pool.parallelFor(visits.size(),
+                     [&](const std::size_t i) { ++visits[i]; });
+
+    for (std::size_t i = 0; i < visits.size(); ++i)
+        ASSERT_EQ(visits[i].load(), 1) << "at index " << i;
+
+    pool.parallelFor(0, [](std::size_t) { FAIL(); });
+}
@@ -0,0 +1,57 @@
+#ifndef COUNTING_ALLOCATOR_HPP
+#define COUNTING_ALLOCATOR_HPP
+
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+
+/// Allocation statistics shared by all copies (and rebinds) of an allocator.
+struct AllocationStats {
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes_in_use = 0;
+};
+
+
+/**
+ * Test utility allocator that records every allocation in an AllocationStats
+ * object. Allocators are equal only if they share the same stats, so the
+ * containers' handling of unequal allocators can be exercised. Like
+ * std::pmr::polymorphic_allocator, it does not propagate on copy/move
+ * assignment or swap.
+ */
+template <typename Type>
+class CountingAllocator {
+  public:
+    using value_type = Type;
+
+    AllocationStats* stats;
+
+    explicit CountingAllocator(AllocationStats& s) noexcept : stats(&s) {}
+
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>& other) noexcept
+        : stats(other.stats) {}
+
+    Type* allocate(const std::size_t n) {
+        ++stats->allocations;
+        stats->bytes_in_use += n * sizeof(Type);
+        return std::allocator<Type>().allocate(n);
+    }
+
+    void deallocate(Type* p, const std::size_t n) noexcept {
+        ++stats->deallocations;
+        stats->bytes_in_use -= n * sizeof(Type);
+        std::allocator<Type>().deallocate(p, n);
+    }
+
+    template <typename Other>
+    bool operator==(const CountingAllocator<Other>& other) const noexcept {
+        return stats == other.stats;
+    }
+};
+
+
+#endif // COUNTING_ALLOCATOR_HPP
@@ -0,0 +1,105 @@
+#ifndef INPUT_DISTRIBUTIONS_HPP
+#define INPUT_DISTRIBUTIONS_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "DynamicArray.hpp"
+
+
+/**
+ * @brief Shapes of input used by the benchmarks.
+ *
+ * - RANDOM: uniformly distributed values over the full int range.
+ * - SORTED: 0, 1, ..., n-1.
+ * - REVERSED: n-1, n-2, ..., 0.
+ * - FEW_UNIQUE: uniformly distributed values drawn from 16 distinct keys.
+ * - ORGAN_PIPE: ascending to the middle, then descending (0, 1, .., 1, 0).
+ * - NEARLY_SORTED: 0, 1, ..., n-1 with about 1% of the positions overwritten
+ *   by random values in [0, n).
+ */
+enum class Distribution {
+    RANDOM = 0,
+    SORTED,
+    REVERSED,
+    FEW_UNIQUE,
+    ORGAN_PIPE,
+    NEARLY_SORTED,
+};
+
+
+/// Human-readable name of a distribution, used as the benchmark label.
+inline const char* distributionName(const Distribution distribution) {
+    switch (distribution) {
+    case Distribution::RANDOM:
+        return "random";
+    case Distribution::SORTED:
+        return "sorted";
+    case Distribution::REVERSED:
+        return "reversed";
+    case Distribution::FEW_UNIQUE:
+        return "few_unique";
+    case Distribution::ORGAN_PIPE:
+        return "organ_pipe";
+    case Distribution::NEARLY_SORTED:
+        return "nearly_sorted";
+    }
+    return "unknown";
+}
+
+
+/**
+ * @brief Build a DynamicArray<int> of the given size and shape.
+ *
+ * The generator is seeded with a fixed value, so repeated runs (and runs on
+ * different releases) see exactly the same input.
+ *
+ * @param size Number of elements to generate.
+ * @param distribution Shape of the generated data.
+ * @param seed Seed for the pseudo-random distributions.
+ * @return The generated array.
+ */
+inline data_structs::DynamicArray<int>
+makeInput(const std::size_t size, const Distribution distribution,
+          const std::uint32_t seed = 42) {
+    data_structs::DynamicArray<int> array;
+    array.reserve(size);
+
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> any_value;
+    std::uniform_int_distribution<int> few_values(0, 15);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> position(
+        0, size == 0 ? 0 : static_cast<int>(size - 1));
+
+    for (std::size_t i = 0; i < size; ++i) {
+        switch (distribution) {
+        case Distribution::RANDOM:
+            array.addLast(any_value(engine));
+            break;
+        case Distribution::SORTED:
+            array.addLast(static_cast<int>(i));
+            break;
+        case Distribution::REVERSED:
+            array.addLast(static_cast<int>(size - 1 - i));
+            break;
+        case Distribution::FEW_UNIQUE:
+            array.addLast(few_values(engine));
+            break;
+        case Distribution::ORGAN_PIPE:
+            array.addLast(static_cast<int>(i < size / 2 ? i : size - 1 - i));
+            break;
+        case Distribution::NEARLY_SORTED:
+            array.addLast(percent(engine) == 0 ? position(engine)
+                                               : static_cast<int>(i));
+            break;
+        }
+    }
+
+    return array;
+}
+
+
+#endif // INPUT_DISTRIBUTIONS_HPP